@@ -24,10 +24,44 @@
  */
 
 #define CC_QUICK_COMPILE
+#define _GNU_SOURCE //mremap
 #include "Allocator.h"
 #include "Assertion_Private.h"
 #include "CallbackAllocator.h"
 #include "DebugAllocator.h"
+#include "SamplingAllocator.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__has_include)
+
+#if __has_include(<threads.h>)
+#define CC_ALLOCATOR_USING_STDTHREADS 1
+#include <threads.h>
+#elif CC_PLATFORM_POSIX_COMPLIANT
+#define CC_ALLOCATOR_USING_PTHREADS 1
+#include <pthread.h>
+#else
+#error No thread support
+#endif
+
+#elif CC_PLATFORM_POSIX_COMPLIANT
+#define CC_ALLOCATOR_USING_PTHREADS 1
+#include <pthread.h>
+#else
+#define CC_ALLOCATOR_USING_STDTHREADS 1
+#include <threads.h>
+#endif
+
+#if CC_PLATFORM_POSIX_COMPLIANT
+#define CC_LARGE_PAGE_ALLOCATOR_USING_MMAP 1
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if CC_PLATFORM_UNIX
+#include <sys/syscall.h>
+#endif
+#endif
 
 #pragma mark - Standard Allocator Implementation
 static void *StandardAllocator(void *Data, size_t Size)
@@ -139,14 +173,17 @@ static void *AlignedReallocator(void *Data, void *Ptr, size_t Size)
 {
     CCAlignedMemoryHeader *Header = Ptr - sizeof(CCAlignedMemoryHeader);
     size_t Alignment = Header->alignment;
-    int Allocator = *(int*)Ptr;
+    const size_t Offset = Ptr - Header->head;
     
     void *Head = realloc(Header->head, Size + Alignment + sizeof(CCAlignedMemoryHeader));
     if (Head)
     {
         Ptr = (void*)((uintptr_t)(Head + sizeof(CCAlignedMemoryHeader) + sizeof(CCAllocatorHeader) + Alignment - 1) & ~(Alignment - 1)) - sizeof(CCAllocatorHeader);
+        
+        //The new allocation may require a different offset to be aligned, in which case the contents need to be moved
+        if ((size_t)(Ptr - Head) != Offset) memmove(Ptr, Head + Offset, Size);
+        
         ((CCAlignedMemoryHeader*)Ptr)[-1] = (CCAlignedMemoryHeader){ .head = Head, .alignment = Alignment };
-        *(int*)Ptr = Allocator;
         
         return Ptr;
     }
@@ -246,6 +283,210 @@ static void DebugDeallocator(void *Ptr)
 }
 
 
+#pragma mark - Sampling Allocator Implementation
+typedef struct {
+    void *sample;
+    size_t size;
+} CCSamplingMemoryHeader;
+
+static void *SamplingAllocator(void *Data, size_t Size)
+{
+    CCSamplingMemoryHeader *Ptr = malloc(Size + sizeof(CCSamplingMemoryHeader));
+    if (Ptr) *Ptr++ = (CCSamplingMemoryHeader){ .sample = CCSamplingAllocatorSample(Size), .size = Size };
+    
+    return Ptr;
+}
+
+static void *SamplingReallocator(void *Data, void *Ptr, size_t Size)
+{
+    CCSamplingMemoryHeader *Header = realloc((CCSamplingMemoryHeader*)Ptr - 1, Size + sizeof(CCSamplingMemoryHeader));
+    if (Header)
+    {
+        if (Header->sample) CCSamplingAllocatorRelease(Header->sample, Header->size);
+        
+        *Header++ = (CCSamplingMemoryHeader){ .sample = CCSamplingAllocatorSample(Size), .size = Size };
+    }
+    
+    return Header;
+}
+
+static void SamplingDeallocator(void *Ptr)
+{
+    CCSamplingMemoryHeader *Header = (CCSamplingMemoryHeader*)Ptr - 1;
+    if (Header->sample) CCSamplingAllocatorRelease(Header->sample, Header->size);
+    
+    free(Header);
+}
+
+
+#pragma mark - Large Page Allocator Implementation
+
+#ifndef CC_LARGE_PAGE_ALLOCATOR_THRESHOLD
+#define CC_LARGE_PAGE_ALLOCATOR_THRESHOLD (256 * 1024)
+#endif
+
+#ifndef CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE
+#define CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#endif
+
+typedef struct {
+    size_t size;
+    int node;
+    _Bool mapped;
+} CCLargePageMemoryHeader;
+
+#if CC_LARGE_PAGE_ALLOCATOR_USING_MMAP
+static size_t LargePageMappingSize(size_t Size)
+{
+    static size_t PageSize = 0;
+    if (!PageSize) PageSize = sysconf(_SC_PAGESIZE);
+    
+    const size_t Alignment = Size >= CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE ? CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE : PageSize;
+    
+    return (Size + (Alignment - 1)) & ~(Alignment - 1);
+}
+
+static void LargePageAdvise(void *Ptr, size_t Size, int Node)
+{
+    //Both are only hints, if huge pages or the node are unavailable the mapping is still usable
+#ifdef MADV_HUGEPAGE
+    if (Size >= CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE) madvise(Ptr, Size, MADV_HUGEPAGE);
+#endif
+    
+#ifdef SYS_mbind
+    if ((Node >= 0) && (Node < (int)(sizeof(unsigned long) * 8)))
+    {
+        const unsigned long NodeMask = 1UL << Node;
+        syscall(SYS_mbind, Ptr, Size, 2 /* MPOL_BIND */, &NodeMask, sizeof(NodeMask) * 8 + 1, 0);
+    }
+#endif
+}
+
+static void *LargePageMap(size_t Size)
+{
+    if (Size < CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE)
+    {
+        void *Ptr = mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return Ptr != MAP_FAILED ? Ptr : NULL;
+    }
+    
+    //Over map so the region can be trimmed to a huge page boundary
+    uint8_t *Ptr = mmap(NULL, Size + CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Ptr == MAP_FAILED) return NULL;
+    
+    uint8_t *Aligned = (uint8_t*)(((uintptr_t)Ptr + (CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE - 1)) & ~(uintptr_t)(CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE - 1));
+    
+    if (Aligned != Ptr) munmap(Ptr, Aligned - Ptr);
+    
+    const size_t Tail = CC_LARGE_PAGE_ALLOCATOR_HUGE_PAGE_SIZE - (Aligned - Ptr);
+    if (Tail) munmap(Aligned + Size, Tail);
+    
+    return Aligned;
+}
+#endif
+
+static void *LargePageAllocator(int *Data, size_t Size)
+{
+    const size_t Length = Size + sizeof(CCLargePageMemoryHeader);
+    if (Length < Size) return NULL;
+    
+    const int Node = Data ? *Data : -1;
+    
+#if CC_LARGE_PAGE_ALLOCATOR_USING_MMAP
+    if (Length >= CC_LARGE_PAGE_ALLOCATOR_THRESHOLD)
+    {
+        const size_t MappingSize = LargePageMappingSize(Length);
+        CCLargePageMemoryHeader *Header = LargePageMap(MappingSize);
+        if (Header)
+        {
+            LargePageAdvise(Header, MappingSize, Node);
+            
+            *Header++ = (CCLargePageMemoryHeader){ .size = Length, .node = Node, .mapped = TRUE };
+            
+            return Header;
+        }
+    }
+#endif
+    
+    CCLargePageMemoryHeader *Header = malloc(Length);
+    if (Header) *Header++ = (CCLargePageMemoryHeader){ .size = Length, .node = Node, .mapped = FALSE };
+    
+    return Header;
+}
+
+static void *LargePageReallocator(void *Data, void *Ptr, size_t Size)
+{
+    const size_t Length = Size + sizeof(CCLargePageMemoryHeader);
+    if (Length < Size) return NULL;
+    
+    CCLargePageMemoryHeader *Header = (CCLargePageMemoryHeader*)Ptr - 1;
+    
+#if CC_LARGE_PAGE_ALLOCATOR_USING_MMAP
+    if ((Header->mapped) && (Length >= CC_LARGE_PAGE_ALLOCATOR_THRESHOLD))
+    {
+        const size_t PrevMappingSize = LargePageMappingSize(Header->size), MappingSize = LargePageMappingSize(Length);
+        if (PrevMappingSize != MappingSize)
+        {
+#ifdef MREMAP_MAYMOVE
+            CCLargePageMemoryHeader *NewHeader = mremap(Header, PrevMappingSize, MappingSize, MREMAP_MAYMOVE);
+            if (NewHeader == MAP_FAILED) return NULL;
+            
+            Header = NewHeader;
+#else
+            CCLargePageMemoryHeader *NewHeader = LargePageMap(MappingSize);
+            if (!NewHeader) return NULL;
+            
+            memcpy(NewHeader, Header, (Header->size < Length ? Header->size : Length));
+            munmap(Header, PrevMappingSize);
+            
+            Header = NewHeader;
+#endif
+            if (MappingSize > PrevMappingSize) LargePageAdvise(Header, MappingSize, Header->node);
+        }
+        
+        Header->size = Length;
+        
+        return Header + 1;
+    }
+    
+    if ((Header->mapped) || (Length >= CC_LARGE_PAGE_ALLOCATOR_THRESHOLD))
+    {
+        //Moving between the heap and a mapping
+        int Node = Header->node;
+        void *NewPtr = LargePageAllocator(&Node, Size);
+        if (!NewPtr) return NULL;
+        
+        memcpy(NewPtr, Ptr, (Header->size < Length ? Header->size : Length) - sizeof(CCLargePageMemoryHeader));
+        
+        if (Header->mapped) munmap(Header, LargePageMappingSize(Header->size));
+        else free(Header);
+        
+        return NewPtr;
+    }
+#endif
+    
+    Header = realloc(Header, Length);
+    if (Header) Header++->size = Length;
+    
+    return Header;
+}
+
+static void LargePageDeallocator(void *Ptr)
+{
+    CCLargePageMemoryHeader *Header = (CCLargePageMemoryHeader*)Ptr - 1;
+    
+#if CC_LARGE_PAGE_ALLOCATOR_USING_MMAP
+    if (Header->mapped)
+    {
+        munmap(Header, LargePageMappingSize(Header->size));
+        return;
+    }
+#endif
+    
+    free(Header);
+}
+
+
 #pragma mark - Static Allocator Implementation
 static void *StaticAllocator(void *Data, size_t Size)
 {
@@ -274,7 +515,7 @@ static void StaticDeallocator(void *Ptr)
 #ifndef CC_ALLOCATORS_MAX
 #define CC_ALLOCATORS_MAX 20 //If more is needed just recompile.
 #endif
-_Static_assert(CC_ALLOCATORS_MAX >= 7, "Allocator max too small, must allow for the default allocators.");
+_Static_assert(CC_ALLOCATORS_MAX >= 9, "Allocator max too small, must allow for the default allocators.");
 
 
 
@@ -293,7 +534,9 @@ static struct {
         { .allocator = (CCAllocatorFunction)CallbackAllocator, .reallocator = (CCReallocatorFunction)CallbackReallocator, .deallocator = CallbackDeallocator },
         { .allocator = (CCAllocatorFunction)AlignedAllocator, .reallocator = AlignedReallocator, .deallocator = AlignedDeallocator },
         { .allocator = (CCAllocatorFunction)BoundsCheckAllocator, .reallocator = BoundsCheckReallocator, .deallocator = BoundsCheckDeallocator },
-        { .allocator = (CCAllocatorFunction)DebugAllocator, .reallocator = (CCReallocatorFunction)DebugReallocator, .deallocator = DebugDeallocator }
+        { .allocator = (CCAllocatorFunction)DebugAllocator, .reallocator = (CCReallocatorFunction)DebugReallocator, .deallocator = DebugDeallocator },
+        { .allocator = SamplingAllocator, .reallocator = SamplingReallocator, .deallocator = SamplingDeallocator },
+        { .allocator = (CCAllocatorFunction)LargePageAllocator, .reallocator = LargePageReallocator, .deallocator = LargePageDeallocator }
     }
 };
 
@@ -405,21 +648,19 @@ int32_t CCMemoryRefCount(void *Ptr)
 #endif
 }
 
-void CCMemoryDeallocate(void *Ptr)
+static void CCMemoryRelease(void *Ptr, int32_t Releases)
 {
-    CCAssertLog(Ptr, "Ptr must not be null");
-    
     CCAllocatorHeader *Header = (CCAllocatorHeader*)Ptr - 1;
     
     const int Index = Header->allocator;
     if (Index < 0) return;
     
 #if CC_ALLOCATOR_USING_STDATOMIC
-    const int32_t Count = atomic_fetch_sub_explicit(&Header->refCount, 1, memory_order_release) - 1;
+    const int32_t Count = atomic_fetch_sub_explicit(&Header->refCount, Releases, memory_order_release) - Releases;
 #elif CC_ALLOCATOR_USING_OSATOMIC
-    const int32_t Count = OSAtomicDecrement32(&Header->refCount);
+    const int32_t Count = OSAtomicAdd32(-Releases, &Header->refCount);
 #else
-    const int32_t Count = --Header->refCount;
+    const int32_t Count = (Header->refCount -= Releases);
 #endif
     
     CCAssertLog(Index < CC_ALLOCATORS_MAX, "Memory has been modified outside of its bounds.");
@@ -441,6 +682,97 @@ void CCMemoryDeallocate(void *Ptr)
     }
 }
 
+void CCMemoryDeallocate(void *Ptr)
+{
+    CCAssertLog(Ptr, "Ptr must not be null");
+    
+    CCMemoryRelease(Ptr, 1);
+}
+
+#ifndef CC_ALLOCATOR_DEFERRED_RELEASE_MAX
+#define CC_ALLOCATOR_DEFERRED_RELEASE_MAX 256 //The number of releases a thread will log before they're applied
+#endif
+
+typedef struct {
+    size_t count;
+    void *ptrs[CC_ALLOCATOR_DEFERRED_RELEASE_MAX];
+} CCMemoryDeferredReleaseLog;
+
+static _Thread_local CCMemoryDeferredReleaseLog DeferredReleases = { .count = 0 };
+
+#if CC_ALLOCATOR_USING_PTHREADS
+static pthread_key_t DeferredReleasesKey;
+static pthread_once_t DeferredReleasesKeyOnce = PTHREAD_ONCE_INIT;
+#elif CC_ALLOCATOR_USING_STDTHREADS
+static tss_t DeferredReleasesKey;
+static once_flag DeferredReleasesKeyOnce = ONCE_FLAG_INIT;
+#endif
+
+static void CCMemoryDeferredReleaseLogDestructor(CCMemoryDeferredReleaseLog *Log)
+{
+    CCMemoryDeallocateFlush();
+}
+
+static void CCMemoryCreateDeferredReleasesKey(void)
+{
+#if CC_ALLOCATOR_USING_PTHREADS
+    pthread_key_create(&DeferredReleasesKey, (void(*)(void*))CCMemoryDeferredReleaseLogDestructor);
+#elif CC_ALLOCATOR_USING_STDTHREADS
+    tss_create(&DeferredReleasesKey, (tss_dtor_t)CCMemoryDeferredReleaseLogDestructor);
+#endif
+}
+
+static int CCMemoryDeferredReleaseCompare(const void *a, const void *b)
+{
+    const uintptr_t A = (uintptr_t)*(void* const*)a, B = (uintptr_t)*(void* const*)b;
+    
+    return (A > B) - (A < B);
+}
+
+void CCMemoryDeallocateDeferred(void *Ptr)
+{
+    CCAssertLog(Ptr, "Ptr must not be null");
+    
+    if (((CCAllocatorHeader*)Ptr)[-1].allocator < 0) return;
+    
+    if (CC_UNLIKELY(DeferredReleases.count == CC_ALLOCATOR_DEFERRED_RELEASE_MAX)) CCMemoryDeallocateFlush();
+    else if (CC_UNLIKELY(!DeferredReleases.count))
+    {
+#if CC_ALLOCATOR_USING_PTHREADS
+        pthread_once(&DeferredReleasesKeyOnce, CCMemoryCreateDeferredReleasesKey);
+        pthread_setspecific(DeferredReleasesKey, &DeferredReleases);
+#elif CC_ALLOCATOR_USING_STDTHREADS
+        call_once(&DeferredReleasesKeyOnce, CCMemoryCreateDeferredReleasesKey);
+        tss_set(DeferredReleasesKey, &DeferredReleases);
+#endif
+    }
+    
+    DeferredReleases.ptrs[DeferredReleases.count++] = Ptr;
+}
+
+void CCMemoryDeallocateFlush(void)
+{
+    //Destructors may release further memory, so take ownership of the logged releases first
+    const size_t Count = DeferredReleases.count;
+    if (!Count) return;
+    
+    void *Ptrs[CC_ALLOCATOR_DEFERRED_RELEASE_MAX];
+    memcpy(Ptrs, DeferredReleases.ptrs, sizeof(*Ptrs) * Count);
+    DeferredReleases.count = 0;
+    
+    qsort(Ptrs, Count, sizeof(*Ptrs), CCMemoryDeferredReleaseCompare);
+    
+    for (size_t Loop = 0; Loop < Count; )
+    {
+        size_t Next = Loop + 1;
+        while ((Next < Count) && (Ptrs[Next] == Ptrs[Loop])) Next++;
+        
+        CCMemoryRelease(Ptrs[Loop], (int32_t)(Next - Loop));
+        
+        Loop = Next;
+    }
+}
+
 CCMemoryDestructorCallback CCMemorySetDestructor(void *Ptr, CCMemoryDestructorCallback Destructor)
 {
     CCAssertLog(Ptr, "Ptr must not be null");
@@ -452,3 +784,41 @@ CCMemoryDestructorCallback CCMemorySetDestructor(void *Ptr, CCMemoryDestructorCa
     
     return PrevDestructor;
 }
+
+void *CCMemoryAllocateHeaderless(CCAllocatorType Type, size_t Size)
+{
+    const int Index = Type.allocator;
+    if (Index < 0) return NULL;
+    
+    CCAssertLog(Index < CC_ALLOCATORS_MAX, "Index (%d) exceeds the number of allocators available (%d).", Index, CC_ALLOCATORS_MAX);
+    CCAssertLog((Index != CC_STATIC_ALLOCATOR.allocator) && (Index != CC_ALIGNED_ALLOCATOR(0).allocator), "Static and aligned allocators cannot be used for header-less allocations.");
+    const CCAllocatorFunction Allocator = Allocators.allocators[Index].allocator;
+    
+    return Allocator ? Allocator(Type.data, Size) : NULL;
+}
+
+void *CCMemoryReallocateHeaderless(CCAllocatorType Type, void *Ptr, size_t Size)
+{
+    if (!Ptr) return CCMemoryAllocateHeaderless(Type, Size);
+    
+    const int Index = Type.allocator;
+    if (Index < 0) return NULL;
+    
+    CCAssertLog(Index < CC_ALLOCATORS_MAX, "Index (%d) exceeds the number of allocators available (%d).", Index, CC_ALLOCATORS_MAX);
+    const CCReallocatorFunction Reallocator = Allocators.allocators[Index].reallocator;
+    
+    return Reallocator ? Reallocator(Type.data, Ptr, Size) : NULL;
+}
+
+void CCMemoryDeallocateHeaderless(CCAllocatorType Type, void *Ptr)
+{
+    CCAssertLog(Ptr, "Ptr must not be null");
+    
+    const int Index = Type.allocator;
+    if (Index < 0) return;
+    
+    CCAssertLog(Index < CC_ALLOCATORS_MAX, "Index (%d) exceeds the number of allocators available (%d).", Index, CC_ALLOCATORS_MAX);
+    const CCDeallocatorFunction Deallocator = Allocators.allocators[Index].deallocator;
+    
+    if (Deallocator) Deallocator(Ptr);
+}
@@ -44,6 +44,9 @@ typedef struct CCAllocatorType {
 #define CC_ALIGNED_ALLOCATOR(alignment) (CCAllocatorType){ .allocator = 4, .data = &(size_t){ alignment } } //Uses stdlib
 #define CC_BOUNDS_CHECK_ALLOCATOR (CCAllocatorType){ .allocator = 5 } //Uses stdlib
 #define CC_DEBUG_ALLOCATOR (CCAllocatorType){ .allocator = 6, .data = &(CCDebugAllocatorInfo){ .line = __LINE__, .file = __FILE__ } } //Uses stdlib
+#define CC_SAMPLING_ALLOCATOR (CCAllocatorType){ .allocator = 7 } //Uses stdlib, see SamplingAllocator.h
+#define CC_LARGE_PAGE_ALLOCATOR (CCAllocatorType){ .allocator = 8 } //Uses mmap (huge pages where available), small allocations use stdlib
+#define CC_LARGE_PAGE_NUMA_ALLOCATOR(node) (CCAllocatorType){ .allocator = 8, .data = &(int){ node } } //Same as CC_LARGE_PAGE_ALLOCATOR but binds the pages to the NUMA node
 
 typedef void *(*CCAllocatorFunction)(void *Data, size_t Size); //Additional data to be passed to the allocator (data from CCAllocatorType data member)
 typedef void *(*CCReallocatorFunction)(void *Data, void *Ptr, size_t Size);
@@ -142,6 +145,26 @@ int32_t CCMemoryRefCount(void *Ptr);
  */
 void CCMemoryDeallocate(void *CC_DESTROY(Ptr));
 
+/*!
+ * @brief Deallocate the memory allocation at a later time.
+ * @description Logs the release in the calling thread's deferred release log. The logged releases
+ *              are applied once the log is full, @b CCMemoryDeallocateFlush is called, or the
+ *              thread exits. Multiple releases of the same allocation are applied as a single
+ *              atomic decrement, which avoids contention on allocations that are frequently
+ *              retained and released across threads.
+ *
+ * @warning The allocation is not guaranteed to be deallocated when this function returns, so
+ *          @b CCMemoryRefCount will not reflect the logged releases until they're applied.
+ *
+ * @param Ptr The pointer to the memory allocation.
+ */
+void CCMemoryDeallocateDeferred(void *CC_DESTROY(Ptr));
+
+/*!
+ * @brief Apply the logged deferred releases of the calling thread.
+ */
+void CCMemoryDeallocateFlush(void);
+
 /*!
  * @brief Set a destructor callback for the memory allocation.
  * @description The callback will be called on deallocation.
@@ -151,6 +174,39 @@ void CCMemoryDeallocate(void *CC_DESTROY(Ptr));
  */
 CCMemoryDestructorCallback CCMemorySetDestructor(void *Ptr, CCMemoryDestructorCallback Destructor);
 
+/*!
+ * @brief Allocate some memory without an allocation header.
+ * @description Header-less allocations avoid the cost of the allocation header, but in exchange
+ *              cannot be retained, have a destructor, or be freed without knowing the allocator.
+ *              This is intended for small internally managed allocations. Allocators that rely
+ *              on the header (static and aligned allocators) cannot be used.
+ *
+ * @param Type The allocator type information to be used.
+ * @param Size The amount of memory to be allocated.
+ * @return The pointer to the new memory allocation. A subsequent call must be made to
+ *         @b CCMemoryDeallocateHeaderless in order to free the memory.
+ */
+CC_NEW void *CCMemoryAllocateHeaderless(CCAllocatorType Type, size_t Size);
+
+/*!
+ * @brief Reallocate the header-less memory allocation.
+ * @param Type The allocator type information to be used. This must use the same allocator the
+ *        memory was allocated with.
+ *
+ * @param Ptr The pointer to the memory allocation.
+ * @param Size The amount of memory to be allocated.
+ * @return The pointer to the new memory allocation. A subsequent call must be made to
+ *         @b CCMemoryDeallocateHeaderless in order to free the memory.
+ */
+CC_NEW void *CCMemoryReallocateHeaderless(CCAllocatorType Type, void *CC_DESTROY(Ptr), size_t Size);
+
+/*!
+ * @brief Deallocate the header-less memory allocation.
+ * @param Type The allocator type information the memory was allocated with.
+ * @param Ptr The pointer to the memory allocation.
+ */
+void CCMemoryDeallocateHeaderless(CCAllocatorType Type, void *CC_DESTROY(Ptr));
+
 
 #ifndef CC_DEFAULT_ALLOCATOR
 #define CC_DEFAULT_ALLOCATOR CC_STD_ALLOCATOR
@@ -27,11 +27,34 @@
 #include "Array.h"
 #include "MemoryAllocation.h"
 #include <string.h>
+#include <stddef.h>
 
 
+#ifndef CC_ARRAY_GROWTH_FACTOR
+#define CC_ARRAY_GROWTH_FACTOR 2
+#endif
+
+typedef struct {
+    CCArrayInfo info;
+    uint8_t storage[];
+} CCArraySmallInfo;
+
+//Allocations are not guaranteed to be aligned beyond the allocation header (such as with CC_CUSTOM_ALLOCATOR), so the inline storage is aligned at runtime
+#define CC_ARRAY_SMALL_STORAGE_PADDING (_Alignof(max_align_t) - _Alignof(CCArraySmallInfo))
+
+static inline void *CCArraySmallStorage(CCArray Array)
+{
+    return (void*)(((uintptr_t)((CCArraySmallInfo*)Array)->storage + (_Alignof(max_align_t) - 1)) & ~(uintptr_t)(_Alignof(max_align_t) - 1));
+}
+
+static inline _Bool CCArrayIsInline(CCArray Array)
+{
+    return (Array->isSmall) && (Array->data == CCArraySmallStorage(Array));
+}
+
 static void CCArrayDestructor(CCArray Ptr)
 {
-    CCFree(Ptr->data);
+    if (!CCArrayIsInline(Ptr)) CCFree(Ptr->data);
 }
 
 CCArray CCArrayCreate(CCAllocatorType Allocator, size_t ElementSize, size_t ChunkSize)
@@ -42,12 +65,17 @@ CCArray CCArrayCreate(CCAllocatorType Allocator, size_t ElementSize, size_t Chun
     if (Array)
     {
         *Array = (CCArrayInfo){
+            .allocator = Allocator,
             .size = ElementSize,
             .chunkSize = ChunkSize,
             .count = 0,
-            .data = CCMalloc(Allocator, ChunkSize * ElementSize, NULL, CC_DEFAULT_ERROR_CALLBACK)
+            .capacity = 0,
+            .data = CCMalloc(Allocator, ChunkSize * ElementSize, NULL, CC_DEFAULT_ERROR_CALLBACK),
+            .isSmall = FALSE
         };
         
+        if (Array->data) Array->capacity = ChunkSize;
+        
         CCMemorySetDestructor(Array, (CCMemoryDestructorCallback)CCArrayDestructor);
     }
     
@@ -55,26 +83,91 @@ CCArray CCArrayCreate(CCAllocatorType Allocator, size_t ElementSize, size_t Chun
     return Array;
 }
 
+CCArray CCArrayCreateSmall(CCAllocatorType Allocator, size_t ElementSize, size_t ChunkSize, size_t InlineCount)
+{
+    CCAssertLog(ChunkSize >= 1, "ChunkSize must be at least 1");
+    CCAssertLog(InlineCount >= 1, "InlineCount must be at least 1");
+    
+    CCArray Array = CCMalloc(Allocator, sizeof(CCArraySmallInfo) + CC_ARRAY_SMALL_STORAGE_PADDING + (InlineCount * ElementSize), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Array)
+    {
+        *Array = (CCArrayInfo){
+            .allocator = Allocator,
+            .size = ElementSize,
+            .chunkSize = ChunkSize,
+            .count = 0,
+            .capacity = InlineCount,
+            .data = CCArraySmallStorage(Array),
+            .isSmall = TRUE
+        };
+        
+        CCMemorySetDestructor(Array, (CCMemoryDestructorCallback)CCArrayDestructor);
+    }
+    
+    return Array;
+}
+
 void CCArrayDestroy(CCArray Array)
 {
     CCAssertLog(Array, "Array must not be null");
     CCFree(Array);
 }
 
-size_t CCArrayAppendElement(CCArray Array, const void *Element)
+static inline size_t CCArrayRoundToChunk(CCArray Array, size_t Count)
 {
-    CCAssertLog(Array, "Array must not be null");
+    return ((Count + (Array->chunkSize - 1)) / Array->chunkSize) * Array->chunkSize;
+}
+
+static void *CCArrayReallocateData(CCArray Array, size_t Capacity, CCErrorCallback ErrorCallback)
+{
+    if (!CCArrayIsInline(Array)) return CCRealloc(Array->allocator, Array->data, Capacity * Array->size, NULL, ErrorCallback);
+    
+    //Inline storage is part of the array's allocation, so the elements spill into a new allocation
+    void *Data = CCMalloc(Array->allocator, Capacity * Array->size, NULL, ErrorCallback);
+    if (Data) memcpy(Data, Array->data, Array->count * Array->size);
     
-    if (((Array->count % Array->chunkSize) == 0) && ((Array->count) || (!Array->data)))
+    return Data;
+}
+
+static _Bool CCArrayGrow(CCArray Array, size_t Count)
+{
+    const size_t Current = CCArrayGetCapacity(Array);
+    if ((Array->count + Count) <= Current) return TRUE;
+    
+    const size_t Minimum = CCArrayRoundToChunk(Array, Array->count + Count);
+    
+    const size_t Capacity = CCArrayRoundToChunk(Array, (size_t)(Current * CC_ARRAY_GROWTH_FACTOR));
+    if (Capacity > Minimum)
     {
-        CCArray Temp = CCRealloc(CC_STD_ALLOCATOR, Array->data, (((Array->count / Array->chunkSize) + 1) * Array->chunkSize * Array->size), NULL, CC_DEFAULT_ERROR_CALLBACK);
-        if (!Temp)
+        void *Data = CCArrayReallocateData(Array, Capacity, NULL);
+        if (Data)
         {
-            CC_LOG_ERROR("Failed to append element to array (%p), could not allocate (%zu)", Array, (((Array->count / Array->chunkSize) + 1) * Array->chunkSize * Array->size));
-            return SIZE_MAX;
+            Array->data = Data;
+            Array->capacity = Capacity;
+            
+            return TRUE;
         }
         
-        Array->data = Temp;
+        //Allocations may have an upper bound (such as static allocations), so fallback to only what is needed
+    }
+    
+    void *Data = CCArrayReallocateData(Array, Minimum, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Data) return FALSE;
+    
+    Array->data = Data;
+    Array->capacity = Minimum;
+    
+    return TRUE;
+}
+
+size_t CCArrayAppendElement(CCArray Array, const void *Element)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    if (!CCArrayGrow(Array, 1))
+    {
+        CC_LOG_ERROR("Failed to append element to array (%p), could not allocate (%zu)", Array, CCArrayRoundToChunk(Array, Array->count + 1) * Array->size);
+        return SIZE_MAX;
     }
     
     if (Element) memcpy(Array->data + (Array->count * Array->size), Element, Array->size);
@@ -87,17 +180,10 @@ size_t CCArrayAppendElements(CCArray Array, const void *Elements, size_t Count)
     CCAssertLog(Array, "Array must not be null");
     CCAssertLog(Count, "Count must not be 0");
     
-    size_t Rem = Array->count % Array->chunkSize;
-    if (((Array->chunkSize - Rem) < Count) || ((Rem == 0) && ((Array->count) || (!Array->data))))
+    if (!CCArrayGrow(Array, Count))
     {
-        CCArray Temp = CCRealloc(CC_STD_ALLOCATOR, Array->data, ((((Array->count + Count) / Array->chunkSize) + 1) * Array->chunkSize * Array->size), NULL, CC_DEFAULT_ERROR_CALLBACK);
-        if (!Temp)
-        {
-            CC_LOG_ERROR("Failed to append (%zu) elements to array (%p), could not allocate (%zu)", Count, Array, ((((Array->count + Count) / Array->chunkSize) + 1) * Array->chunkSize * Array->size));
-            return SIZE_MAX;
-        }
-        
-        Array->data = Temp;
+        CC_LOG_ERROR("Failed to append (%zu) elements to array (%p), could not allocate (%zu)", Count, Array, CCArrayRoundToChunk(Array, Array->count + Count) * Array->size);
+        return SIZE_MAX;
     }
     
     if (Elements) memcpy(Array->data + (Array->count * Array->size), Elements, Array->size * Count);
@@ -130,16 +216,10 @@ size_t CCArrayInsertElementAtIndex(CCArray Array, size_t Index, const void *Elem
     CCAssertLog(Array, "Array must not be null");
     CCAssertLog(Array->count > Index, "Index must not be out of bounds");
     
-    if (((Array->count % Array->chunkSize) == 0) && ((Array->count) || (!Array->data)))
+    if (!CCArrayGrow(Array, 1))
     {
-        CCArray Temp = CCRealloc(CC_STD_ALLOCATOR, Array->data, (((Array->count / Array->chunkSize) + 1) * Array->chunkSize * Array->size), NULL, CC_DEFAULT_ERROR_CALLBACK);
-        if (!Temp)
-        {
-            CC_LOG_ERROR("Failed to insert element into array (%p), could not allocate (%zu)", Array, (((Array->count / Array->chunkSize) + 1) * Array->chunkSize * Array->size));
-            return SIZE_MAX;
-        }
-        
-        Array->data = Temp;
+        CC_LOG_ERROR("Failed to insert element into array (%p), could not allocate (%zu)", Array, CCArrayRoundToChunk(Array, Array->count + 1) * Array->size);
+        return SIZE_MAX;
     }
     
     memmove(Array->data + ((Index + 1) * Array->size), Array->data + (Index * Array->size), (++Array->count - (Index + 1)) * Array->size);
@@ -154,17 +234,10 @@ size_t CCArrayInsertElementsAtIndex(CCArray Array, size_t Index, const void *Ele
     CCAssertLog(Array->count > Index, "Index must not be out of bounds");
     CCAssertLog(Count, "Count must not be 0");
     
-    size_t Rem = Array->count % Array->chunkSize;
-    if (((Array->chunkSize - Rem) < Count) || ((Rem == 0) && ((Array->count) || (!Array->data))))
+    if (!CCArrayGrow(Array, Count))
     {
-        CCArray Temp = CCRealloc(CC_STD_ALLOCATOR, Array->data, ((((Array->count + Count) / Array->chunkSize) + 1) * Array->chunkSize * Array->size), NULL, CC_DEFAULT_ERROR_CALLBACK);
-        if (!Temp)
-        {
-            CC_LOG_ERROR("Failed to insert (%zu) elements into array (%p), could not allocate (%zu)", Count, Array, ((((Array->count + Count) / Array->chunkSize) + 1) * Array->chunkSize * Array->size));
-            return SIZE_MAX;
-        }
-        
-        Array->data = Temp;
+        CC_LOG_ERROR("Failed to insert (%zu) elements into array (%p), could not allocate (%zu)", Count, Array, CCArrayRoundToChunk(Array, Array->count + Count) * Array->size);
+        return SIZE_MAX;
     }
     
     Array->count += Count;
@@ -198,3 +271,585 @@ void CCArrayRemoveAllElements(CCArray Array)
     
     Array->count = 0;
 }
+
+_Bool CCArrayReserve(CCArray Array, size_t Count)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    if (Count <= CCArrayGetCapacity(Array)) return TRUE;
+    
+    const size_t Capacity = CCArrayRoundToChunk(Array, Count);
+    
+    void *Data = CCArrayReallocateData(Array, Capacity, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Data)
+    {
+        CC_LOG_ERROR("Failed to reserve (%zu) elements for array (%p), could not allocate (%zu)", Count, Array, Capacity * Array->size);
+        return FALSE;
+    }
+    
+    Array->data = Data;
+    Array->capacity = Capacity;
+    
+    return TRUE;
+}
+
+void CCArrayShrinkToFit(CCArray Array)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    const size_t Capacity = CCArrayRoundToChunk(Array, Array->count);
+    if ((Capacity >= CCArrayGetCapacity(Array)) || (CCArrayIsInline(Array))) return;
+    
+    if (Capacity)
+    {
+        void *Data = CCRealloc(Array->allocator, Array->data, Capacity * Array->size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Data) return;
+        
+        Array->data = Data;
+    }
+    
+    else
+    {
+        CCFree(Array->data);
+        Array->data = NULL;
+    }
+    
+    Array->capacity = Capacity;
+}
+
+#pragma mark - Sorting/Searching
+
+#ifndef CC_ARRAY_SORT_INSERTION_THRESHOLD
+#define CC_ARRAY_SORT_INSERTION_THRESHOLD 16
+#endif
+
+#ifndef CC_ARRAY_PARALLEL_SORT_TASK_SIZE
+#define CC_ARRAY_PARALLEL_SORT_TASK_SIZE 65536
+#endif
+
+static inline void CCArraySwapElements(void *a, void *b, size_t Size)
+{
+    switch (Size)
+    {
+#define CC_ARRAY_SWAP_TYPE(type) \
+{ \
+    type Temp; \
+    memcpy(&Temp, a, sizeof(type)); \
+    memcpy(a, b, sizeof(type)); \
+    memcpy(b, &Temp, sizeof(type)); \
+    return; \
+}
+        case 1: CC_ARRAY_SWAP_TYPE(uint8_t)
+        case 2: CC_ARRAY_SWAP_TYPE(uint16_t)
+        case 4: CC_ARRAY_SWAP_TYPE(uint32_t)
+        case 8: CC_ARRAY_SWAP_TYPE(uint64_t)
+        case 16: CC_ARRAY_SWAP_TYPE(struct { uint64_t v[2]; })
+#undef CC_ARRAY_SWAP_TYPE
+    }
+    
+    uint8_t *A = a, *B = b;
+    for ( ; Size >= sizeof(uint64_t); Size -= sizeof(uint64_t), A += sizeof(uint64_t), B += sizeof(uint64_t))
+    {
+        uint64_t Temp;
+        memcpy(&Temp, A, sizeof(uint64_t));
+        memcpy(A, B, sizeof(uint64_t));
+        memcpy(B, &Temp, sizeof(uint64_t));
+    }
+    
+    for ( ; Size; Size--, A++, B++)
+    {
+        const uint8_t Temp = *A;
+        *A = *B;
+        *B = Temp;
+    }
+}
+
+static inline CCComparisonResult CCArrayCompareElements(const void *Left, const void *Right, size_t Size, CCComparator Comparator)
+{
+    if (Comparator) return Comparator(Left, Right);
+    
+    const int Result = memcmp(Left, Right, Size);
+    return Result < 0 ? CCComparisonResultAscending : (Result > 0 ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+#define CC_ARRAY_SORT_ELEMENT(index) (Data + ((index) * Size))
+#define CC_ARRAY_SORT_LESS(a, b) (CCArrayCompareElements(a, b, Size, Comparator) == CCComparisonResultAscending)
+
+static void CCArrayInsertionSort(void *Data, size_t Count, size_t Size, CCComparator Comparator)
+{
+    for (size_t Loop = 1; Loop < Count; Loop++)
+    {
+        for (size_t Index = Loop; (Index) && (CC_ARRAY_SORT_LESS(CC_ARRAY_SORT_ELEMENT(Index), CC_ARRAY_SORT_ELEMENT(Index - 1))); Index--)
+        {
+            CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(Index), CC_ARRAY_SORT_ELEMENT(Index - 1), Size);
+        }
+    }
+}
+
+static void CCArraySiftDown(void *Data, size_t Root, size_t Count, size_t Size, CCComparator Comparator)
+{
+    for (size_t Child; (Child = (Root * 2) + 1) < Count; Root = Child)
+    {
+        if (((Child + 1) < Count) && (CC_ARRAY_SORT_LESS(CC_ARRAY_SORT_ELEMENT(Child), CC_ARRAY_SORT_ELEMENT(Child + 1)))) Child++;
+        
+        if (!CC_ARRAY_SORT_LESS(CC_ARRAY_SORT_ELEMENT(Root), CC_ARRAY_SORT_ELEMENT(Child))) break;
+        
+        CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(Root), CC_ARRAY_SORT_ELEMENT(Child), Size);
+    }
+}
+
+static void CCArrayHeapSort(void *Data, size_t Count, size_t Size, CCComparator Comparator)
+{
+    for (size_t Loop = Count / 2; Loop--; ) CCArraySiftDown(Data, Loop, Count, Size, Comparator);
+    
+    for (size_t Loop = Count; --Loop; )
+    {
+        CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(0), CC_ARRAY_SORT_ELEMENT(Loop), Size);
+        CCArraySiftDown(Data, 0, Loop, Size, Comparator);
+    }
+}
+
+static void CCArrayIntroSort(void *Data, size_t Count, size_t Size, CCComparator Comparator, size_t Depth)
+{
+    while (Count > CC_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        if (!Depth--)
+        {
+            CCArrayHeapSort(Data, Count, Size, Comparator);
+            return;
+        }
+        
+        //Median of three, the pivot is then moved to the front
+        const size_t Middle = Count / 2, Last = Count - 1;
+        if (CC_ARRAY_SORT_LESS(CC_ARRAY_SORT_ELEMENT(Middle), CC_ARRAY_SORT_ELEMENT(0))) CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(Middle), CC_ARRAY_SORT_ELEMENT(0), Size);
+        if (CC_ARRAY_SORT_LESS(CC_ARRAY_SORT_ELEMENT(Last), CC_ARRAY_SORT_ELEMENT(Middle)))
+        {
+            CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(Last), CC_ARRAY_SORT_ELEMENT(Middle), Size);
+            if (CC_ARRAY_SORT_LESS(CC_ARRAY_SORT_ELEMENT(Middle), CC_ARRAY_SORT_ELEMENT(0))) CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(Middle), CC_ARRAY_SORT_ELEMENT(0), Size);
+        }
+        
+        CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(Middle), CC_ARRAY_SORT_ELEMENT(0), Size);
+        
+        const void *Pivot = CC_ARRAY_SORT_ELEMENT(0);
+        size_t Left = 1, Right = Last;
+        for ( ; ; )
+        {
+            while ((Left <= Right) && (CC_ARRAY_SORT_LESS(CC_ARRAY_SORT_ELEMENT(Left), Pivot))) Left++;
+            while ((Left <= Right) && (CC_ARRAY_SORT_LESS(Pivot, CC_ARRAY_SORT_ELEMENT(Right)))) Right--;
+            
+            if (Left >= Right) break;
+            
+            CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(Left++), CC_ARRAY_SORT_ELEMENT(Right--), Size);
+        }
+        
+        CCArraySwapElements(CC_ARRAY_SORT_ELEMENT(0), CC_ARRAY_SORT_ELEMENT(Right), Size);
+        
+        //Recurse into the smaller partition so the stack depth stays bounded
+        const size_t LowerCount = Right, UpperCount = Count - (Right + 1);
+        if (LowerCount < UpperCount)
+        {
+            CCArrayIntroSort(Data, LowerCount, Size, Comparator, Depth);
+            Data = CC_ARRAY_SORT_ELEMENT(Right + 1);
+            Count = UpperCount;
+        }
+        
+        else
+        {
+            CCArrayIntroSort(CC_ARRAY_SORT_ELEMENT(Right + 1), UpperCount, Size, Comparator, Depth);
+            Count = LowerCount;
+        }
+    }
+    
+    CCArrayInsertionSort(Data, Count, Size, Comparator);
+}
+
+void CCArraySort(CCArray Array, CCComparator Comparator)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    size_t Depth = 0;
+    for (size_t Count = Array->count; Count > 1; Count >>= 1) Depth += 2;
+    
+    CCArrayIntroSort(Array->data, Array->count, Array->size, Comparator, Depth);
+}
+
+static void CCArrayMergeRuns(void *Destination, const void *Left, size_t LeftCount, const void *Right, size_t RightCount, size_t Size, CCComparator Comparator)
+{
+    //Takes from the left run on ties, so merging preserves the order of equal elements
+    while ((LeftCount) && (RightCount))
+    {
+        if (CC_ARRAY_SORT_LESS(Right, Left))
+        {
+            memcpy(Destination, Right, Size);
+            Right += Size;
+            RightCount--;
+        }
+        
+        else
+        {
+            memcpy(Destination, Left, Size);
+            Left += Size;
+            LeftCount--;
+        }
+        
+        Destination += Size;
+    }
+    
+    if (LeftCount) memcpy(Destination, Left, LeftCount * Size);
+    else if (RightCount) memcpy(Destination, Right, RightCount * Size);
+}
+
+static void CCArrayMergeSort(void *Data, void *Buffer, size_t Count, size_t Size, CCComparator Comparator)
+{
+    for (size_t Loop = 0; Loop < Count; Loop += CC_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        CCArrayInsertionSort(CC_ARRAY_SORT_ELEMENT(Loop), (Count - Loop) < CC_ARRAY_SORT_INSERTION_THRESHOLD ? (Count - Loop) : CC_ARRAY_SORT_INSERTION_THRESHOLD, Size, Comparator);
+    }
+    
+    void *Source = Data, *Destination = Buffer;
+    for (size_t Width = CC_ARRAY_SORT_INSERTION_THRESHOLD; Width < Count; Width *= 2)
+    {
+        for (size_t Loop = 0; Loop < Count; Loop += Width * 2)
+        {
+            const size_t LeftCount = (Count - Loop) < Width ? (Count - Loop) : Width;
+            const size_t RightCount = (Count - Loop - LeftCount) < Width ? (Count - Loop - LeftCount) : Width;
+            
+            CCArrayMergeRuns(Destination + (Loop * Size), Source + (Loop * Size), LeftCount, Source + ((Loop + LeftCount) * Size), RightCount, Size, Comparator);
+        }
+        
+        void *Temp = Source;
+        Source = Destination;
+        Destination = Temp;
+    }
+    
+    if (Source != Data) memcpy(Data, Source, Count * Size);
+}
+
+typedef struct {
+    void *data;
+    void *buffer;
+    size_t count;
+    size_t size;
+    CCComparator comparator;
+    _Bool stable;
+} CCArraySortChunkInput;
+
+static void CCArraySortChunk(const CCArraySortChunkInput *In, void *Out)
+{
+    if (In->stable) CCArrayMergeSort(In->data, In->buffer, In->count, In->size, In->comparator);
+    else
+    {
+        size_t Depth = 0;
+        for (size_t Count = In->count; Count > 1; Count >>= 1) Depth += 2;
+        
+        CCArrayIntroSort(In->data, In->count, In->size, In->comparator, Depth);
+    }
+}
+
+typedef struct {
+    void *destination;
+    const void *left;
+    const void *right;
+    size_t leftCount;
+    size_t rightCount;
+    size_t start;
+    size_t end;
+    size_t size;
+    CCComparator comparator;
+} CCArrayMergeChunkInput;
+
+static size_t CCArrayMergeSplit(const void *Left, size_t LeftCount, const void *Right, size_t RightCount, size_t Index, size_t Size, CCComparator Comparator)
+{
+    //Find how many of the first Index merged elements come from the left run
+    size_t Lower = Index > RightCount ? Index - RightCount : 0, Upper = Index < LeftCount ? Index : LeftCount;
+    while (Lower < Upper)
+    {
+        const size_t Middle = Lower + ((Upper - Lower) / 2);
+        
+        if (!CC_ARRAY_SORT_LESS(Right + ((Index - Middle - 1) * Size), Left + (Middle * Size))) Lower = Middle + 1;
+        else Upper = Middle;
+    }
+    
+    return Lower;
+}
+
+static void CCArrayMergeChunk(const CCArrayMergeChunkInput *In, void *Out)
+{
+    const size_t Size = In->size;
+    const size_t LeftStart = CCArrayMergeSplit(In->left, In->leftCount, In->right, In->rightCount, In->start, Size, In->comparator);
+    const size_t LeftEnd = CCArrayMergeSplit(In->left, In->leftCount, In->right, In->rightCount, In->end, Size, In->comparator);
+    const size_t RightStart = In->start - LeftStart, RightEnd = In->end - LeftEnd;
+    
+    CCArrayMergeRuns(In->destination + (In->start * Size), In->left + (LeftStart * Size), LeftEnd - LeftStart, In->right + (RightStart * Size), RightEnd - RightStart, Size, In->comparator);
+}
+
+static void CCArrayWaitForTasks(CCTaskQueue Queue, CCTask *Tasks, size_t Count)
+{
+    //Help execute the queue, so the sort doesn't rely on other threads servicing it
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        CCTask Task = Tasks[Loop];
+        while (!CCTaskIsFinished(Task))
+        {
+            CCTask Next = CCTaskQueuePop(Queue);
+            if (Next)
+            {
+                CCTaskRun(Next);
+                CCTaskDestroy(Next);
+            }
+            
+            else CC_SPIN_WAIT();
+        }
+        
+        CCTaskDestroy(Task);
+    }
+}
+
+static size_t CCArrayPushTask(CCTaskQueue Queue, CCTask *Tasks, size_t Pushed, CCTaskFunction Function, size_t InputSize, const void *Input)
+{
+    CCTask Task = Queue ? CCTaskCreate(CC_STD_ALLOCATOR, Function, 0, NULL, InputSize, Input, NULL) : NULL;
+    if (!Task)
+    {
+        //Run it on this thread instead
+        Function(Input, NULL);
+        return Pushed;
+    }
+    
+    Tasks[Pushed] = CCRetain(Task);
+    CCTaskQueuePush(Queue, Task);
+    
+    return Pushed + 1;
+}
+
+static _Bool CCArraySortConcurrently(CCArray Array, CCComparator Comparator, _Bool Stable, CCTaskQueue Queue)
+{
+    const size_t Count = Array->count, Size = Array->size;
+    if (Count < 2) return TRUE;
+    
+    void *Buffer = CCMalloc(Array->allocator, Count * Size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Buffer)
+    {
+        CC_LOG_ERROR("Failed to sort array (%p), could not allocate (%zu)", Array, Count * Size);
+        return FALSE;
+    }
+    
+    const size_t TaskCount = (Count + (CC_ARRAY_PARALLEL_SORT_TASK_SIZE - 1)) / CC_ARRAY_PARALLEL_SORT_TASK_SIZE;
+    
+    CCTask *Tasks = Queue ? CCMalloc(CC_STD_ALLOCATOR, sizeof(CCTask) * (TaskCount + 1), NULL, CC_DEFAULT_ERROR_CALLBACK) : NULL;
+    if (!Tasks) Queue = NULL;
+    
+    size_t Pushed = 0;
+    for (size_t Index = 0; Index < Count; Index += CC_ARRAY_PARALLEL_SORT_TASK_SIZE)
+    {
+        const CCArraySortChunkInput Input = {
+            .data = Array->data + (Index * Size),
+            .buffer = Buffer + (Index * Size),
+            .count = (Count - Index) < CC_ARRAY_PARALLEL_SORT_TASK_SIZE ? (Count - Index) : CC_ARRAY_PARALLEL_SORT_TASK_SIZE,
+            .size = Size,
+            .comparator = Comparator,
+            .stable = Stable
+        };
+        
+        Pushed = CCArrayPushTask(Queue, Tasks, Pushed, (CCTaskFunction)CCArraySortChunk, sizeof(Input), &Input);
+    }
+    
+    if (Queue) CCArrayWaitForTasks(Queue, Tasks, Pushed);
+    
+    //Merge neighbouring runs, where each merge is split into evenly sized tasks so every pass is concurrent
+    void *Source = Array->data, *Destination = Buffer;
+    for (size_t Width = CC_ARRAY_PARALLEL_SORT_TASK_SIZE; Width < Count; Width *= 2)
+    {
+        Pushed = 0;
+        for (size_t Loop = 0; Loop < Count; Loop += Width * 2)
+        {
+            const size_t LeftCount = (Count - Loop) < Width ? (Count - Loop) : Width;
+            const size_t RightCount = (Count - Loop - LeftCount) < Width ? (Count - Loop - LeftCount) : Width;
+            
+            for (size_t Start = 0; Start < (LeftCount + RightCount); Start += CC_ARRAY_PARALLEL_SORT_TASK_SIZE)
+            {
+                const CCArrayMergeChunkInput Input = {
+                    .destination = Destination + (Loop * Size),
+                    .left = Source + (Loop * Size),
+                    .right = Source + ((Loop + LeftCount) * Size),
+                    .leftCount = LeftCount,
+                    .rightCount = RightCount,
+                    .start = Start,
+                    .end = (LeftCount + RightCount - Start) < CC_ARRAY_PARALLEL_SORT_TASK_SIZE ? (LeftCount + RightCount) : Start + CC_ARRAY_PARALLEL_SORT_TASK_SIZE,
+                    .size = Size,
+                    .comparator = Comparator
+                };
+                
+                Pushed = CCArrayPushTask(Queue, Tasks, Pushed, (CCTaskFunction)CCArrayMergeChunk, sizeof(Input), &Input);
+            }
+        }
+        
+        if (Queue) CCArrayWaitForTasks(Queue, Tasks, Pushed);
+        
+        void *Temp = Source;
+        Source = Destination;
+        Destination = Temp;
+    }
+    
+    if (Source != Array->data) memcpy(Array->data, Source, Count * Size);
+    
+    CCFree(Tasks);
+    CCFree(Buffer);
+    
+    return TRUE;
+}
+
+_Bool CCArrayParallelSort(CCArray Array, CCComparator Comparator, CCTaskQueue Queue)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    if ((!Queue) || (Array->count <= CC_ARRAY_PARALLEL_SORT_TASK_SIZE))
+    {
+        CCArraySort(Array, Comparator);
+        return TRUE;
+    }
+    
+    return CCArraySortConcurrently(Array, Comparator, FALSE, Queue);
+}
+
+_Bool CCArrayParallelStableSort(CCArray Array, CCComparator Comparator, CCTaskQueue Queue)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    return CCArraySortConcurrently(Array, Comparator, TRUE, Queue);
+}
+
+static inline uint64_t CCArrayRadixKey(const void *Element, size_t KeySize, _Bool Signed)
+{
+    switch (KeySize)
+    {
+        case 1:
+        {
+            uint8_t Key;
+            memcpy(&Key, Element, sizeof(Key));
+            return Signed ? Key ^ 0x80 : Key;
+        }
+            
+        case 2:
+        {
+            uint16_t Key;
+            memcpy(&Key, Element, sizeof(Key));
+            return Signed ? Key ^ 0x8000 : Key;
+        }
+            
+        case 4:
+        {
+            uint32_t Key;
+            memcpy(&Key, Element, sizeof(Key));
+            return Signed ? Key ^ 0x80000000 : Key;
+        }
+            
+        default:
+        {
+            uint64_t Key;
+            memcpy(&Key, Element, sizeof(Key));
+            return Signed ? Key ^ 0x8000000000000000 : Key;
+        }
+    }
+}
+
+_Bool CCArrayRadixSort(CCArray Array, size_t KeyOffset, size_t KeySize, _Bool Signed)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog((KeySize == 1) || (KeySize == 2) || (KeySize == 4) || (KeySize == 8), "KeySize must be 1, 2, 4, or 8");
+    CCAssertLog((KeyOffset + KeySize) <= Array->size, "Key must be within the element");
+    
+    const size_t Count = Array->count, Size = Array->size;
+    if (Count < 2) return TRUE;
+    
+    size_t Histogram[8][256] = {{ 0 }};
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const uint64_t Key = CCArrayRadixKey(Array->data + (Loop * Size) + KeyOffset, KeySize, Signed);
+        for (size_t Byte = 0; Byte < KeySize; Byte++) Histogram[Byte][(Key >> (Byte * 8)) & 0xff]++;
+    }
+    
+    void *Buffer = CCMalloc(Array->allocator, Count * Size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Buffer)
+    {
+        CC_LOG_ERROR("Failed to radix sort array (%p), could not allocate (%zu)", Array, Count * Size);
+        return FALSE;
+    }
+    
+    void *Source = Array->data, *Destination = Buffer;
+    for (size_t Byte = 0; Byte < KeySize; Byte++)
+    {
+        //Skip passes where every key shares the same byte, as they would not change the order
+        if (Histogram[Byte][(CCArrayRadixKey(Source + KeyOffset, KeySize, Signed) >> (Byte * 8)) & 0xff] == Count) continue;
+        
+        size_t Offset = 0;
+        for (size_t Bucket = 0; Bucket < 256; Bucket++)
+        {
+            const size_t BucketCount = Histogram[Byte][Bucket];
+            Histogram[Byte][Bucket] = Offset;
+            Offset += BucketCount;
+        }
+        
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const void *Element = Source + (Loop * Size);
+            const size_t Bucket = (CCArrayRadixKey(Element + KeyOffset, KeySize, Signed) >> (Byte * 8)) & 0xff;
+            memcpy(Destination + (Histogram[Byte][Bucket]++ * Size), Element, Size);
+        }
+        
+        void *Temp = Source;
+        Source = Destination;
+        Destination = Temp;
+    }
+    
+    if (Source != Array->data) memcpy(Array->data, Source, Count * Size);
+    
+    CCFree(Buffer);
+    
+    return TRUE;
+}
+
+static size_t CCArraySearchBound(CCArray Array, const void *Element, CCComparator Comparator, _Bool Upper)
+{
+    const void *Data = Array->data;
+    const size_t Size = Array->size;
+    size_t Index = 0, Count = Array->count;
+    
+    while (Count)
+    {
+        const size_t Half = Count / 2;
+        const CCComparisonResult Order = CCArrayCompareElements(CC_ARRAY_SORT_ELEMENT(Index + Half), Element, Size, Comparator);
+        
+        if ((Order == CCComparisonResultAscending) || ((Upper) && (Order == CCComparisonResultEqual)))
+        {
+            Index += Half + 1;
+            Count -= Half + 1;
+        }
+        
+        else Count = Half;
+    }
+    
+    return Index;
+}
+
+size_t CCArrayBinarySearch(CCArray Array, const void *Element, CCComparator Comparator, size_t *InsertionIndex)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Element, "Element must not be null");
+    
+    const size_t Index = CCArraySearchBound(Array, Element, Comparator, FALSE);
+    if (InsertionIndex) *InsertionIndex = Index;
+    
+    if ((Index < Array->count) && (CCArrayCompareElements(CCArrayGetElementAtIndex(Array, Index), Element, Array->size, Comparator) == CCComparisonResultEqual)) return Index;
+    
+    return SIZE_MAX;
+}
+
+size_t CCArrayInsertSorted(CCArray Array, const void *Element, CCComparator Comparator)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Element, "Element must not be null");
+    
+    const size_t Index = CCArraySearchBound(Array, Element, Comparator, TRUE);
+    
+    return Index == Array->count ? CCArrayAppendElement(Array, Element) : CCArrayInsertElementAtIndex(Array, Index, Element);
+}
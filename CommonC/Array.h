@@ -39,11 +39,15 @@
 #include <CommonC/Allocator.h>
 #include <CommonC/Assertion.h>
 #include <CommonC/Enumerable.h>
+#include <CommonC/Comparator.h>
+#include <CommonC/TaskQueue.h>
 
 typedef struct CCArrayInfo {
+    CCAllocatorType allocator;
     size_t size, chunkSize;
-    size_t count;
+    size_t count, capacity;
     void *data;
+    _Bool isSmall;
 } CCArrayInfo;
 
 /*!
@@ -84,11 +88,30 @@ CC_CONTAINER_DECLARE_PRESET_1(CCArray);
  * @brief Create an array.
  * @param Allocator The allocator to be used for the allocation.
  * @param ElementSize The size of the data elements.
- * @param ChunkSize The number of elements to fit with each allocation. Must be at least 1.
+ * @param ChunkSize The number of elements to fit with each allocation. The capacity of the array will
+ *        always be a multiple of this. Must be at least 1.
+ *
  * @return An empty array, or NULL on failure. Must be destroyed to free the memory.
  */
 CC_NEW CCArray CCArrayCreate(CCAllocatorType Allocator, size_t ElementSize, size_t ChunkSize);
 
+/*!
+ * @brief Create an array that stores its first elements inline.
+ * @description Up to InlineCount elements are stored in the same allocation as the array, so small
+ *              arrays only require a single allocation. Once the array grows past this its elements
+ *              are moved to a separate allocation (as with @b CCArrayCreate), and the inline storage
+ *              is no longer used.
+ *
+ * @param Allocator The allocator to be used for the allocation.
+ * @param ElementSize The size of the data elements.
+ * @param ChunkSize The number of elements to fit with each allocation after the inline storage has
+ *        been exceeded. Must be at least 1.
+ *
+ * @param InlineCount The number of elements to store inline. Must be at least 1.
+ * @return An empty array, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCArray CCArrayCreateSmall(CCAllocatorType Allocator, size_t ElementSize, size_t ChunkSize, size_t InlineCount);
+
 /*!
  * @brief Destroy an array.
  * @param Array The array to be destroyed.
@@ -133,10 +156,13 @@ void CCArrayDestroy(CCArray CC_DESTROY(Array));
 }){ \
     .header = CC_ALLOCATOR_HEADER_INIT(CC_NULL_ALLOCATOR.allocator), \
     .info = { \
+        .allocator = CC_STD_ALLOCATOR, \
         .size = elementSize, \
         .chunkSize = chunkSize_, \
         .count = elementCount, \
-        .data = (void*)ptr \
+        .capacity = ((((elementCount) ? (elementCount) - 1 : 0) / (chunkSize_)) + 1) * (chunkSize_), \
+        .data = (void*)ptr, \
+        .isSmall = FALSE \
     } \
 }.info)
 
@@ -260,6 +286,117 @@ void CCArrayRemoveElementsAtIndex(CCArray Array, size_t Index, size_t Count);
 void CCArrayRemoveAllElements(CCArray Array);
 
 
+#pragma mark - Capacity
+/*!
+ * @brief Ensure the array can hold a number of elements without needing to reallocate.
+ * @description The capacity will be rounded up to a multiple of the chunk size.
+ * @param Array The array to reserve the capacity of.
+ * @param Count The total number of elements the array should be able to hold.
+ * @return TRUE if the array has the capacity, otherwise FALSE if it could not be allocated.
+ */
+_Bool CCArrayReserve(CCArray Array, size_t Count);
+
+/*!
+ * @brief Release any capacity of the array that is not being used.
+ * @description The capacity will be reduced to the count rounded up to a multiple of the chunk size.
+ * @param Array The array to shrink.
+ */
+void CCArrayShrinkToFit(CCArray Array);
+
+
+#pragma mark - Sorting/Searching
+/*!
+ * @brief Sort the elements of the array.
+ * @description Uses an introsort, so the order of equal elements is not preserved.
+ * @performance O(n log n) worst case.
+ * @param Array The array to be sorted.
+ * @param Comparator The comparison used to order the elements, where ascending elements will be
+ *        placed before descending elements. If NULL the elements will be ordered using a memcmp.
+ */
+void CCArraySort(CCArray Array, CCComparator Comparator);
+
+/*!
+ * @brief Sort the elements of the array by an integer key.
+ * @description Uses an LSD radix sort, so the order of equal keys is preserved.
+ * @performance O(n * k) where k is the number of bytes in the key. Requires a temporary allocation
+ *              the size of the array's elements.
+ *
+ * @param Array The array to be sorted.
+ * @param KeyOffset The offset of the integer key in each element.
+ * @param KeySize The size of the integer key. Must be 1, 2, 4, or 8.
+ * @param Signed Whether the integer key is signed or unsigned.
+ * @return TRUE if the array was sorted, otherwise FALSE if the temporary storage could not be allocated.
+ */
+_Bool CCArrayRadixSort(CCArray Array, size_t KeyOffset, size_t KeySize, _Bool Signed);
+
+/*!
+ * @brief Sort the elements of the array across multiple threads.
+ * @description The array is split into chunks that are sorted concurrently, and then merged together
+ *              concurrently. The order of equal elements is not preserved.
+ *
+ * @performance O(n log n) worst case. Requires a temporary allocation the size of the array's elements.
+ * @param Array The array to be sorted.
+ * @param Comparator The comparison used to order the elements, where ascending elements will be
+ *        placed before descending elements. If NULL the elements will be ordered using a memcmp.
+ *
+ * @param Queue The optional task queue to sort on. The calling thread will also help execute the
+ *        queue until the sort has finished. If NULL the sort is performed on the calling thread.
+ *
+ * @return TRUE if the array was sorted, otherwise FALSE if the temporary storage could not be allocated.
+ */
+_Bool CCArrayParallelSort(CCArray Array, CCComparator Comparator, CCTaskQueue Queue);
+
+/*!
+ * @brief Sort the elements of the array across multiple threads, preserving the order of equal elements.
+ * @description The array is split into chunks that are merge sorted concurrently, and then merged together
+ *              concurrently.
+ *
+ * @performance O(n log n) worst case. Requires a temporary allocation the size of the array's elements.
+ * @param Array The array to be sorted.
+ * @param Comparator The comparison used to order the elements, where ascending elements will be
+ *        placed before descending elements. If NULL the elements will be ordered using a memcmp.
+ *
+ * @param Queue The optional task queue to sort on. The calling thread will also help execute the
+ *        queue until the sort has finished. If NULL the sort is performed on the calling thread.
+ *
+ * @return TRUE if the array was sorted, otherwise FALSE if the temporary storage could not be allocated.
+ */
+_Bool CCArrayParallelStableSort(CCArray Array, CCComparator Comparator, CCTaskQueue Queue);
+
+/*!
+ * @brief Find an element in a sorted array.
+ * @warning The array must be sorted by the same comparison.
+ * @performance O(log n)
+ * @param Array The sorted array to search.
+ * @param Element The element to find.
+ * @param Comparator The comparison the array is ordered by. If NULL the elements are compared
+ *        using a memcmp.
+ *
+ * @param InsertionIndex The pointer to where the index of the first element that is not ascending
+ *        of the element should be stored, or NULL if it is not needed. This is the position the
+ *        element could be inserted while keeping the array sorted.
+ *
+ * @return The index of the first matching element, or SIZE_MAX if no element matched.
+ */
+size_t CCArrayBinarySearch(CCArray Array, const void *Element, CCComparator Comparator, size_t *InsertionIndex);
+
+/*!
+ * @brief Insert an element into a sorted array.
+ * @description Increases the array's count by 1. The element will be inserted after any equal
+ *              elements.
+ *
+ * @warning The array must be sorted by the same comparison.
+ * @performance O(log n) to find the position, however the insertion has a worst case of O(n).
+ * @param Array The sorted array to insert the element into.
+ * @param Element The pointer to the element to be copied into the array.
+ * @param Comparator The comparison the array is ordered by. If NULL the elements are compared
+ *        using a memcmp.
+ *
+ * @return The index the element was added or SIZE_MAX on failure.
+ */
+size_t CCArrayInsertSorted(CCArray Array, const void *Element, CCComparator Comparator);
+
+
 #pragma mark - Query Info
 /*!
  * @brief Get the current number of elements in the array.
@@ -298,6 +435,13 @@ static inline void *CCArrayGetData(CCArray Array);
  */
 static inline size_t CCArrayGetChunkSize(CCArray Array);
 
+/*!
+ * @brief Get the number of elements the array can hold before it needs to reallocate.
+ * @param Array The array to get the capacity of.
+ * @return The capacity of the array.
+ */
+static inline size_t CCArrayGetCapacity(CCArray Array);
+
 /*!
  * @brief Get an enumerable for the array.
  * @param Array The array to obtain an enumerable for.
@@ -343,6 +487,13 @@ static inline size_t CCArrayGetChunkSize(CCArray Array)
     return Array->chunkSize;
 }
 
+static inline size_t CCArrayGetCapacity(CCArray Array)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    return Array->data ? Array->capacity : 0;
+}
+
 static inline void CCArrayGetEnumerable(CCArray Array, CCEnumerable *Enumerable)
 {
     CCAssertLog(Array, "Array must not be null");
@@ -68,9 +68,9 @@ void CCBigIntSetBigInt(CCBigInt Integer, CCBigInt Value)
 
     CCListRemoveAllElements(Integer->value);
     
-    for (CCLinkedListNode *Node = Value->value->list; Node; Node = CCLinkedListEnumerateNext(Node))
+    for (size_t Loop = 0; Loop < Value->value->pageCount; Loop++)
     {
-        CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Node);
+        CCArray Array = CCListGetPage(Value->value, Loop);
         CCListAppendElements(Integer->value, CCArrayGetElementAtIndex(Array, 0), CCArrayGetCount(Array));
     }
 }
@@ -0,0 +1,260 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "BitArray.h"
+#include "MemoryAllocation.h"
+#include "BitTricks.h"
+#include "Platform.h"
+#include <string.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX2
+#include <immintrin.h>
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <emmintrin.h>
+#endif
+
+
+static inline size_t CCBitArrayWordCount(size_t Count)
+{
+    return (Count + 63) / 64;
+}
+
+static inline void CCBitArrayClearTail(CCBitArray BitArray)
+{
+    if (BitArray->count % 64) BitArray->words[BitArray->count / 64] &= CCBitSet(BitArray->count % 64);
+}
+
+static void CCBitArrayDestructor(CCBitArray Ptr)
+{
+    CCFree(Ptr->words);
+}
+
+CCBitArray CCBitArrayCreate(CCAllocatorType Allocator, size_t Count)
+{
+    CCBitArray BitArray = CCMalloc(Allocator, sizeof(CCBitArrayInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (BitArray)
+    {
+        const size_t WordCount = CCBitArrayWordCount(Count);
+        
+        *BitArray = (CCBitArrayInfo){
+            .allocator = Allocator,
+            .count = Count,
+            .words = WordCount ? CCMalloc(Allocator, sizeof(uint64_t) * WordCount, NULL, CC_DEFAULT_ERROR_CALLBACK) : NULL
+        };
+        
+        if ((WordCount) && (!BitArray->words))
+        {
+            CC_LOG_ERROR("Failed to create bit array: Failed to allocate memory of size (%zu)", sizeof(uint64_t) * WordCount);
+            CCFree(BitArray);
+            
+            return NULL;
+        }
+        
+        if (WordCount) memset(BitArray->words, 0, sizeof(uint64_t) * WordCount);
+        
+        CCMemorySetDestructor(BitArray, (CCMemoryDestructorCallback)CCBitArrayDestructor);
+    }
+    
+    else
+    {
+        CC_LOG_ERROR("Failed to create bit array: Failed to allocate memory of size (%zu)", sizeof(CCBitArrayInfo));
+    }
+    
+    return BitArray;
+}
+
+CCBitArray CCBitArrayCopy(CCAllocatorType Allocator, CCBitArray BitArray)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    CCBitArray Copy = CCBitArrayCreate(Allocator, BitArray->count);
+    if ((Copy) && (BitArray->count)) memcpy(Copy->words, BitArray->words, sizeof(uint64_t) * CCBitArrayWordCount(BitArray->count));
+    
+    return Copy;
+}
+
+void CCBitArrayDestroy(CCBitArray BitArray)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    CCFree(BitArray);
+}
+
+_Bool CCBitArrayResize(CCBitArray BitArray, size_t Count)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    const size_t WordCount = CCBitArrayWordCount(Count), CurrentWordCount = CCBitArrayWordCount(BitArray->count);
+    if (WordCount != CurrentWordCount)
+    {
+        if (WordCount)
+        {
+            uint64_t *Words = CCRealloc(BitArray->allocator, BitArray->words, sizeof(uint64_t) * WordCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+            if (!Words)
+            {
+                CC_LOG_ERROR("Failed to resize bit array (%p), could not allocate (%zu)", BitArray, sizeof(uint64_t) * WordCount);
+                return FALSE;
+            }
+            
+            if (WordCount > CurrentWordCount) memset(Words + CurrentWordCount, 0, sizeof(uint64_t) * (WordCount - CurrentWordCount));
+            
+            BitArray->words = Words;
+        }
+        
+        else
+        {
+            CCFree(BitArray->words);
+            BitArray->words = NULL;
+        }
+    }
+    
+    BitArray->count = Count;
+    CCBitArrayClearTail(BitArray);
+    
+    return TRUE;
+}
+
+void CCBitArraySetAll(CCBitArray BitArray)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    if (!BitArray->count) return;
+    
+    memset(BitArray->words, 0xff, sizeof(uint64_t) * CCBitArrayWordCount(BitArray->count));
+    CCBitArrayClearTail(BitArray);
+}
+
+void CCBitArrayClearAll(CCBitArray BitArray)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    if (BitArray->count) memset(BitArray->words, 0, sizeof(uint64_t) * CCBitArrayWordCount(BitArray->count));
+}
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX2
+#define CC_BIT_ARRAY_VECTOR_OPERATION(avx, sse) \
+for ( ; (Index + 4) <= Count; Index += 4) \
+{ \
+    const __m256i a = _mm256_loadu_si256((const __m256i*)(Words + Index)), b = _mm256_loadu_si256((const __m256i*)(Source->words + Index)); \
+    _mm256_storeu_si256((__m256i*)(Words + Index), avx); \
+}
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#define CC_BIT_ARRAY_VECTOR_OPERATION(avx, sse) \
+for ( ; (Index + 2) <= Count; Index += 2) \
+{ \
+    const __m128i a = _mm_loadu_si128((const __m128i*)(Words + Index)), b = _mm_loadu_si128((const __m128i*)(Source->words + Index)); \
+    _mm_storeu_si128((__m128i*)(Words + Index), sse); \
+}
+#else
+#define CC_BIT_ARRAY_VECTOR_OPERATION(avx, sse)
+#endif
+
+#define CC_BIT_ARRAY_OPERATION(name, avx, sse, scalar, remainder) \
+void CCBitArray##name(CCBitArray BitArray, CCBitArray Source) \
+{ \
+    CCAssertLog(BitArray, "BitArray must not be null"); \
+    CCAssertLog(Source, "Source must not be null"); \
+    \
+    const size_t WordCount = CCBitArrayWordCount(BitArray->count), SourceWordCount = CCBitArrayWordCount(Source->count); \
+    const size_t Count = WordCount < SourceWordCount ? WordCount : SourceWordCount; \
+    uint64_t *Words = BitArray->words; \
+    size_t Index = 0; \
+    \
+    CC_BIT_ARRAY_VECTOR_OPERATION(avx, sse) \
+    \
+    for ( ; Index < Count; Index++) \
+    { \
+        const uint64_t a = Words[Index], b = Source->words[Index]; \
+        Words[Index] = scalar; \
+    } \
+    \
+    remainder; \
+    CCBitArrayClearTail(BitArray); \
+}
+
+CC_BIT_ARRAY_OPERATION(And, _mm256_and_si256(a, b), _mm_and_si128(a, b), a & b, if (WordCount > Count) memset(Words + Count, 0, sizeof(uint64_t) * (WordCount - Count)))
+CC_BIT_ARRAY_OPERATION(Or, _mm256_or_si256(a, b), _mm_or_si128(a, b), a | b, )
+CC_BIT_ARRAY_OPERATION(Xor, _mm256_xor_si256(a, b), _mm_xor_si128(a, b), a ^ b, )
+CC_BIT_ARRAY_OPERATION(AndNot, _mm256_andnot_si256(b, a), _mm_andnot_si128(b, a), a & ~b, )
+
+size_t CCBitArrayCountSet(CCBitArray BitArray)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    return CCBitArrayRank(BitArray, BitArray->count);
+}
+
+size_t CCBitArrayRank(CCBitArray BitArray, size_t Index)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    CCAssertLog(BitArray->count >= Index, "Index must not be out of bounds");
+    
+    size_t Rank = 0;
+    for (size_t Loop = 0, Count = Index / 64; Loop < Count; Loop++) Rank += CCBitCountSet(BitArray->words[Loop]);
+    
+    if (Index % 64) Rank += CCBitCountSet(BitArray->words[Index / 64] & CCBitSet(Index % 64));
+    
+    return Rank;
+}
+
+size_t CCBitArraySelect(CCBitArray BitArray, size_t Rank)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    for (size_t Loop = 0, Count = CCBitArrayWordCount(BitArray->count); Loop < Count; Loop++)
+    {
+        uint64_t Word = BitArray->words[Loop];
+        const size_t WordRank = CCBitCountSet(Word);
+        
+        if (Rank < WordRank)
+        {
+            while (Rank--) Word &= Word - 1;
+            
+            return (Loop * 64) + CCBitCountSet(CCBitLowestSet(Word) - 1);
+        }
+        
+        Rank -= WordRank;
+    }
+    
+    return SIZE_MAX;
+}
+
+size_t CCBitArrayFindNextSet(CCBitArray BitArray, size_t Index)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    if (Index >= BitArray->count) return SIZE_MAX;
+    
+    size_t Loop = Index / 64;
+    uint64_t Word = BitArray->words[Loop] & ~CCBitSet(Index % 64);
+    
+    for (const size_t Count = CCBitArrayWordCount(BitArray->count); !Word; Word = BitArray->words[Loop])
+    {
+        if (++Loop == Count) return SIZE_MAX;
+    }
+    
+    return (Loop * 64) + CCBitCountSet(CCBitLowestSet(Word) - 1);
+}
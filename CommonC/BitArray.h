@@ -0,0 +1,253 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCBitArray
+ * CCBitArray is a dense fixed length set of bits. Bits are stored in 64-bit words, so set operations
+ * between bit arrays are performed a word (or vector of words) at a time.
+ *
+ * Bits past the end of the array are always kept clear.
+ */
+
+#ifndef CommonC_BitArray_h
+#define CommonC_BitArray_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Assertion.h>
+
+typedef struct CCBitArrayInfo {
+    CCAllocatorType allocator;
+    size_t count;
+    uint64_t *words;
+} CCBitArrayInfo;
+
+/*!
+ * @brief The bit array.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCBitArrayInfo *CCBitArray;
+
+
+#pragma mark - Creation/Destruction
+/*!
+ * @brief Create a bit array.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Count The number of bits. All bits will be clear.
+ * @return A bit array, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCBitArray CCBitArrayCreate(CCAllocatorType Allocator, size_t Count);
+
+/*!
+ * @brief Create a copy of a bit array.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param BitArray The bit array to be copied.
+ * @return A bit array, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCBitArray CCBitArrayCopy(CCAllocatorType Allocator, CCBitArray BitArray);
+
+/*!
+ * @brief Destroy a bit array.
+ * @param BitArray The bit array to be destroyed.
+ */
+void CCBitArrayDestroy(CCBitArray CC_DESTROY(BitArray));
+
+
+#pragma mark - Bits
+/*!
+ * @brief Change the number of bits in the bit array.
+ * @description Any new bits will be clear.
+ * @param BitArray The bit array to resize.
+ * @param Count The new number of bits.
+ * @return TRUE if the bit array was resized, otherwise FALSE if it could not be allocated.
+ */
+_Bool CCBitArrayResize(CCBitArray BitArray, size_t Count);
+
+/*!
+ * @brief Set a bit.
+ * @warning Index must not be out of bounds.
+ * @param BitArray The bit array to set the bit of.
+ * @param Index The index of the bit.
+ */
+static inline void CCBitArraySetBit(CCBitArray BitArray, size_t Index);
+
+/*!
+ * @brief Clear a bit.
+ * @warning Index must not be out of bounds.
+ * @param BitArray The bit array to clear the bit of.
+ * @param Index The index of the bit.
+ */
+static inline void CCBitArrayClearBit(CCBitArray BitArray, size_t Index);
+
+/*!
+ * @brief Get a bit.
+ * @warning Index must not be out of bounds.
+ * @param BitArray The bit array to get the bit of.
+ * @param Index The index of the bit.
+ * @return TRUE if the bit is set, otherwise FALSE.
+ */
+static inline _Bool CCBitArrayGetBit(CCBitArray BitArray, size_t Index);
+
+/*!
+ * @brief Set all the bits.
+ * @param BitArray The bit array to set the bits of.
+ */
+void CCBitArraySetAll(CCBitArray BitArray);
+
+/*!
+ * @brief Clear all the bits.
+ * @param BitArray The bit array to clear the bits of.
+ */
+void CCBitArrayClearAll(CCBitArray BitArray);
+
+
+#pragma mark - Set Operations
+/*!
+ * @brief Intersect the bits of one bit array with another.
+ * @description Bits past the end of the source are treated as clear.
+ * @param BitArray The bit array to store the result in.
+ * @param Source The bit array to intersect with.
+ */
+void CCBitArrayAnd(CCBitArray BitArray, CCBitArray Source);
+
+/*!
+ * @brief Union the bits of one bit array with another.
+ * @description Bits past the end of the source are treated as clear, and bits in the source past
+ *              the end of the bit array are ignored.
+ *
+ * @param BitArray The bit array to store the result in.
+ * @param Source The bit array to union with.
+ */
+void CCBitArrayOr(CCBitArray BitArray, CCBitArray Source);
+
+/*!
+ * @brief Exclusive or the bits of one bit array with another.
+ * @description Bits past the end of the source are treated as clear, and bits in the source past
+ *              the end of the bit array are ignored.
+ *
+ * @param BitArray The bit array to store the result in.
+ * @param Source The bit array to exclusive or with.
+ */
+void CCBitArrayXor(CCBitArray BitArray, CCBitArray Source);
+
+/*!
+ * @brief Clear the bits of one bit array that are set in another.
+ * @description Bits past the end of the source are treated as clear.
+ * @param BitArray The bit array to store the result in.
+ * @param Source The bit array of bits to be cleared.
+ */
+void CCBitArrayAndNot(CCBitArray BitArray, CCBitArray Source);
+
+
+#pragma mark - Query Info
+/*!
+ * @brief Get the number of bits in the bit array.
+ * @param BitArray The bit array to get the count of.
+ * @return The number of bits.
+ */
+static inline size_t CCBitArrayGetCount(CCBitArray BitArray);
+
+/*!
+ * @brief Get the number of set bits in the bit array.
+ * @param BitArray The bit array to count.
+ * @return The number of set bits.
+ */
+size_t CCBitArrayCountSet(CCBitArray BitArray);
+
+/*!
+ * @brief Get the number of set bits before an index.
+ * @param BitArray The bit array to count.
+ * @param Index The index to count up to (excluding). May be the count of the bit array.
+ * @return The number of set bits before the index.
+ */
+size_t CCBitArrayRank(CCBitArray BitArray, size_t Index);
+
+/*!
+ * @brief Find the set bit of a given rank.
+ * @param BitArray The bit array to search.
+ * @param Rank The number of set bits that should come before the set bit.
+ * @return The index of the set bit, or SIZE_MAX if there are not enough set bits.
+ */
+size_t CCBitArraySelect(CCBitArray BitArray, size_t Rank);
+
+/*!
+ * @brief Find the next set bit.
+ * @description Can be used to iterate over the set bits.
+ * @param BitArray The bit array to search.
+ * @param Index The index to start searching from (including).
+ * @return The index of the set bit, or SIZE_MAX if there are no more set bits.
+ */
+size_t CCBitArrayFindNextSet(CCBitArray BitArray, size_t Index);
+
+/*!
+ * @brief Get the words storing the bits.
+ * @description Bit n is stored in word n / 64 at bit n % 64.
+ * @param BitArray The bit array to get the words of.
+ * @return The pointer to the words.
+ */
+static inline uint64_t *CCBitArrayGetWords(CCBitArray BitArray);
+
+
+#pragma mark -
+
+static inline void CCBitArraySetBit(CCBitArray BitArray, size_t Index)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    CCAssertLog(BitArray->count > Index, "Index must not be out of bounds");
+    
+    BitArray->words[Index / 64] |= (uint64_t)1 << (Index % 64);
+}
+
+static inline void CCBitArrayClearBit(CCBitArray BitArray, size_t Index)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    CCAssertLog(BitArray->count > Index, "Index must not be out of bounds");
+    
+    BitArray->words[Index / 64] &= ~((uint64_t)1 << (Index % 64));
+}
+
+static inline _Bool CCBitArrayGetBit(CCBitArray BitArray, size_t Index)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    CCAssertLog(BitArray->count > Index, "Index must not be out of bounds");
+    
+    return (BitArray->words[Index / 64] >> (Index % 64)) & 1;
+}
+
+static inline size_t CCBitArrayGetCount(CCBitArray BitArray)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    return BitArray->count;
+}
+
+static inline uint64_t *CCBitArrayGetWords(CCBitArray BitArray)
+{
+    CCAssertLog(BitArray, "BitArray must not be null");
+    
+    return BitArray->words;
+}
+
+#endif
@@ -505,36 +505,47 @@ CCString CCStringCreateByReplacingOccurrencesOfString(CCString String, CCString
     
     size_t Index = CCStringFindSubstring(String, 0, Occurrence);
     if (Index == SIZE_MAX) return CCStringCopy(String);
-    //TODO: Optimize for non-tagged use case, only need one allocation as it can then mutate that same allocation
-    const size_t OccurrenceLength = CCStringGetLength(Occurrence);
-    size_t ReplacementLength = 0;
     
-    CCString NewString = CCStringCreateWithoutRange(String, Index, OccurrenceLength);
+    const size_t StringLength = CCStringGetLength(String), OccurrenceLength = CCStringGetLength(Occurrence), ReplacementLength = Replacement ? CCStringGetLength(Replacement) : 0;
     
-    if (Replacement)
+    size_t Count = 1;
+    for (size_t Next = Index + OccurrenceLength; (Next < StringLength) && ((Next = CCStringFindSubstring(String, Next, Occurrence)) != SIZE_MAX); Next += OccurrenceLength) Count++;
+    
+    const CCScratchMark Mark = CCScratchGetMark();
+    
+    const size_t Size = CCStringGetSize(String) + (Count * (Replacement ? CCStringGetSize(Replacement) : 0)) + 1;
+    char *NewString = CCScratchAllocate(Size);
+    if (!NewString)
     {
-        CCString Temp = CCStringCreateByInsertingString(NewString, Index, Replacement);
-        CCStringDestroy(NewString);
-        NewString = Temp;
-        
-        ReplacementLength = CCStringGetLength(Replacement);
+        CC_LOG_ERROR("Failed to create string due to allocation failure. Allocation size (%zu)", Size);
+        return 0;
     }
     
-    for (size_t StringLength = CCStringGetLength(NewString); ((Index + ReplacementLength) < StringLength) && ((Index = CCStringFindSubstring(NewString, Index + ReplacementLength, Occurrence)) != SIZE_MAX); StringLength = (StringLength - OccurrenceLength) + ReplacementLength)
+    char *Buffer = NewString;
+    for (size_t Offset = 0; ; )
     {
-        CCString Temp = CCStringCreateWithoutRange(NewString, Index, OccurrenceLength);
-        CCStringDestroy(NewString);
-        NewString = Temp;
+        Buffer = CCStringCopyCharacters(String, Offset, Index - Offset, Buffer);
+        if (Replacement) Buffer = CCStringCopyCharacters(Replacement, 0, ReplacementLength, Buffer);
         
-        if (Replacement)
+        Offset = Index + OccurrenceLength;
+        
+        if ((Offset >= StringLength) || ((Index = CCStringFindSubstring(String, Offset, Occurrence)) == SIZE_MAX))
         {
-            Temp = CCStringCreateByInsertingString(NewString, Index, Replacement);
-            CCStringDestroy(NewString);
-            NewString = Temp;
+            if (Offset < StringLength) Buffer = CCStringCopyCharacters(String, Offset, StringLength - Offset, Buffer);
+            break;
         }
     }
     
-    return NewString;
+    *Buffer = 0;
+    
+    CCStringEncoding Encoding = CCStringGetEncoding(String);
+    if ((Replacement) && (Encoding != CCStringEncodingUTF8)) Encoding = CCStringGetEncoding(Replacement);
+    
+    CCString Result = CCStringCreateWithSize(CC_STD_ALLOCATOR, CCStringHintCopy | Encoding, NewString, Buffer - NewString);
+    
+    CCScratchRelease(Mark);
+    
+    return Result;
 }
 
 static size_t CCStringFindClosestSubstring(CCString String, size_t Index, CCString *Substrings, size_t Count, size_t *Found)
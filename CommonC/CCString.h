@@ -31,6 +31,7 @@
 #include <CommonC/Enumerator.h>
 #include <CommonC/Platform.h>
 #include <CommonC/MemoryAllocation.h>
+#include <CommonC/Scratch.h>
 #include <CommonC/OrderedCollection.h>
 
 #if CC_HARDWARE_PTR_64
@@ -55,7 +56,7 @@
  * @define CC_STRING_TEMP_BUFFER
  * @abstract Convenience macro to get a temporary buffer (const char*).
  * @discussion Attempts to retrieve the internal buffer if that fails, will default to copying the string into
- *             temporary storage (as will be a tagged string, so should fit on the stack easily). The scope of
+ *             the thread's scratch memory (see @b CCScratchAllocate). The scope of
  *             temporary buffer is the next logical scope, where it should either be followed by parantheses or
  *             a single line statement.
  *
@@ -68,10 +69,14 @@
  */
 #define CC_STRING_TEMP_BUFFER(buffer, string, ...) \
 const char *buffer##__CC_PRIV__PRIVCONST_STRING = CCStringGetBuffer(string); \
-char *buffer##__CC_PRIV__TEMP_STRING = NULL; \
-CC_TEMP_Malloc(buffer##__CC_PRIV__TEMP_STRING, (CCStringGetSize(string) + 1) * (_Bool)buffer##__CC_PRIV__PRIVCONST_STRING, __VA_ARGS__); \
-if ((!buffer##__CC_PRIV__PRIVCONST_STRING) && (buffer##__CC_PRIV__TEMP_STRING)) *CCStringCopyCharacters(string, 0, CCStringGetLength(string), buffer##__CC_PRIV__TEMP_STRING) = 0; \
-for (const char *buffer = buffer##__CC_PRIV__PRIVCONST_STRING ? buffer##__CC_PRIV__PRIVCONST_STRING : buffer##__CC_PRIV__TEMP_STRING; buffer; buffer = NULL, CC_TEMP_Free(buffer##__CC_PRIV__TEMP_STRING))
+const CCScratchMark buffer##__CC_PRIV__MARK = CCScratchGetMark(); \
+char *buffer##__CC_PRIV__TEMP_STRING = buffer##__CC_PRIV__PRIVCONST_STRING ? NULL : CCScratchAllocate(CCStringGetSize(string) + 1); \
+if ((!buffer##__CC_PRIV__PRIVCONST_STRING) && (!buffer##__CC_PRIV__TEMP_STRING)) \
+{ \
+__VA_ARGS__ \
+} \
+if (buffer##__CC_PRIV__TEMP_STRING) *CCStringCopyCharacters(string, 0, CCStringGetLength(string), buffer##__CC_PRIV__TEMP_STRING) = 0; \
+for (const char *buffer = buffer##__CC_PRIV__PRIVCONST_STRING ? buffer##__CC_PRIV__PRIVCONST_STRING : buffer##__CC_PRIV__TEMP_STRING; buffer; buffer = NULL, CCScratchRelease(buffer##__CC_PRIV__MARK))
 
 /*!
  * @define CC_STRING
@@ -34,6 +34,7 @@
 #include "LinkedList.h"
 #include "CollectionArray.h"
 #include "CollectionList.h"
+#include "CollectionBTree.h"
 #include <string.h>
 #include <limits.h>
 
@@ -63,10 +64,11 @@ int CCCollectionHintWeightCreate(CCCollectionHint Hint, CCCollectionHint FastHin
     return ((int)CCBitCountSet(FastHints) * 10 * Size) + ((int)CCBitCountSet(ModerateHints) * -1 * Size) + ((int)CCBitCountSet(SlowHints) * -100 * Size);
 }
 
-extern const CCCollectionInterface CCCollectionArrayInterface, CCCollectionListInterface;
+extern const CCCollectionInterface CCCollectionArrayInterface, CCCollectionListInterface, CCCollectionBTreeInterface;
 static CCCollectionInternalInterfaceNode InternalInterfaces[] = {
     { .header = { .allocator = -1 }, .data = { .node = { .prev = NULL, .next = (void*)(InternalInterfaces + 1) + offsetof(CCCollectionInternalInterfaceNode, data) }, .interface = &CCCollectionArrayInterface } },
-    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)InternalInterfaces + offsetof(CCCollectionInternalInterfaceNode, data), .next = NULL }, .interface = &CCCollectionListInterface } }
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)InternalInterfaces + offsetof(CCCollectionInternalInterfaceNode, data), .next = (void*)(InternalInterfaces + 2) + offsetof(CCCollectionInternalInterfaceNode, data) }, .interface = &CCCollectionListInterface } },
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)(InternalInterfaces + 1) + offsetof(CCCollectionInternalInterfaceNode, data), .next = NULL }, .interface = &CCCollectionBTreeInterface } }
 };
 static CCCollectionInterfaceNode *Interfaces = (void*)InternalInterfaces + offsetof(CCCollectionInternalInterfaceNode, data);
 void CCCollectionRegisterInterface(const CCCollectionInterface *Interface)
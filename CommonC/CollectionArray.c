@@ -199,7 +199,7 @@ static void *CCCollectionArrayConstructor(CCAllocatorType Allocator, CCCollectio
         }
         
         *Internal = (CCCollectionArrayInternal){
-            .array = CCArrayCreate(Allocator, ElementSize, ChunkSize),
+            .array = CCArrayCreateSmall(Allocator, ElementSize, ChunkSize, ChunkSize),
             .entries = NULL
         };
         
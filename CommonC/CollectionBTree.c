@@ -0,0 +1,606 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "CollectionBTree.h"
+#include "MemoryAllocation.h"
+#include <string.h>
+
+#ifndef CC_COLLECTION_BTREE_NODE_SIZE
+#define CC_COLLECTION_BTREE_NODE_SIZE 64
+#endif
+
+_Static_assert(CC_COLLECTION_BTREE_NODE_SIZE >= 4, "B-tree node size must be at least 4.");
+
+typedef struct CCCollectionBTreeNode CCCollectionBTreeNode;
+
+typedef struct {
+    CCCollectionBTreeNode *leaf;
+    uint8_t data[];
+} CCCollectionBTreeItem;
+
+struct CCCollectionBTreeNode {
+    CCCollectionBTreeNode *parent;
+    size_t count; //number of children or items in this node
+    size_t total; //number of items in this subtree
+    _Bool leaf;
+    union {
+        CCCollectionBTreeNode *children[CC_COLLECTION_BTREE_NODE_SIZE];
+        CCCollectionBTreeItem *items[CC_COLLECTION_BTREE_NODE_SIZE];
+    };
+};
+
+typedef struct {
+    CCCollectionBTreeNode *root;
+} CCCollectionBTreeInternal;
+
+
+static int CCCollectionBTreeHintWeight(CCCollectionHint Hint);
+static void *CCCollectionBTreeConstructor(CCAllocatorType Allocator, CCCollectionHint Hint, size_t ElementSize);
+static void CCCollectionBTreeDestructor(CCCollectionBTreeInternal *Internal);
+static size_t CCCollectionBTreeCount(CCCollectionBTreeInternal *Internal);
+static CCCollectionEntry CCCollectionBTreeInsert(CCCollectionBTreeInternal *Internal, const void *Element, CCAllocatorType Allocator, size_t ElementSize);
+static void CCCollectionBTreeRemove(CCCollectionBTreeInternal *Internal, CCCollectionEntry Entry, CCAllocatorType Allocator);
+static void *CCCollectionBTreeElement(CCCollectionBTreeInternal *Internal, CCCollectionEntry Entry);
+static void *CCCollectionBTreeEnumerator(CCCollectionBTreeInternal *Internal, CCEnumeratorState *Enumerator, CCCollectionEnumeratorAction Action);
+static CCCollectionEntry CCCollectionBTreeEnumeratorEntry(CCCollectionBTreeInternal *Internal, CCEnumeratorState *Enumerator);
+
+static CCCollectionEntry CCOrderedCollectionBTreeInsert(CCCollectionBTreeInternal *Internal, const void *Element, size_t Index, CCAllocatorType Allocator, size_t ElementSize);
+static CCCollectionEntry CCOrderedCollectionBTreeEntry(CCCollectionBTreeInternal *Internal, size_t Index);
+static size_t CCOrderedCollectionBTreeIndex(CCCollectionBTreeInternal *Internal, CCCollectionEntry Entry);
+static CCCollectionEntry CCOrderedCollectionBTreeReplace(CCCollectionBTreeInternal *Internal, const void *Element, size_t Index, CCAllocatorType Allocator, size_t ElementSize);
+static void CCOrderedCollectionBTreeRemove(CCCollectionBTreeInternal *Internal, size_t Index, CCAllocatorType Allocator);
+static CCCollectionEntry CCOrderedCollectionBTreePrepend(CCCollectionBTreeInternal *Internal, const void *Element, CCAllocatorType Allocator, size_t ElementSize);
+static void *CCOrderedCollectionBTreeElement(CCCollectionBTreeInternal *Internal, size_t Index);
+static CCCollectionEntry CCOrderedCollectionBTreeEntryLast(CCCollectionBTreeInternal *Internal);
+static void CCOrderedCollectionBTreeRemoveLast(CCCollectionBTreeInternal *Internal, CCAllocatorType Allocator);
+
+
+static const CCOrderedCollectionInterface CCOrderedCollectionBTreeInterface = {
+    .insert = (CCOrderedCollectionInsertCallback)CCOrderedCollectionBTreeInsert,
+    .entry = (CCOrderedCollectionEntryCallback)CCOrderedCollectionBTreeEntry,
+    .index = (CCOrderedCollectionIndexCallback)CCOrderedCollectionBTreeIndex,
+    .optional = {
+        .replace = (CCOrderedCollectionReplaceCallback)CCOrderedCollectionBTreeReplace,
+        .remove = (CCOrderedCollectionRemoveCallback)CCOrderedCollectionBTreeRemove,
+        .append = (CCOrderedCollectionAppendCallback)CCCollectionBTreeInsert,
+        .prepend = (CCOrderedCollectionPrependCallback)CCOrderedCollectionBTreePrepend,
+        .element = (CCOrderedCollectionElementCallback)CCOrderedCollectionBTreeElement,
+        .lastEntry = (CCOrderedCollectionEntryLastCallback)CCOrderedCollectionBTreeEntryLast,
+        .removeLast = (CCOrderedCollectionRemoveLastCallback)CCOrderedCollectionBTreeRemoveLast
+    }
+};
+
+const CCCollectionInterface CCCollectionBTreeInterface = {
+    .hintWeight = CCCollectionBTreeHintWeight,
+    .create = CCCollectionBTreeConstructor,
+    .destroy = (CCCollectionDestructorCallback)CCCollectionBTreeDestructor,
+    .count = (CCCollectionCountCallback)CCCollectionBTreeCount,
+    .insert = (CCCollectionInsertCallback)CCCollectionBTreeInsert,
+    .remove =  (CCCollectionRemoveCallback)CCCollectionBTreeRemove,
+    .element = (CCCollectionElementCallback)CCCollectionBTreeElement,
+    .enumerator = (CCCollectionEnumeratorCallback)CCCollectionBTreeEnumerator,
+    .enumeratorReference = (CCCollectionEnumeratorEntryCallback)CCCollectionBTreeEnumeratorEntry,
+    .optional = {
+        .ordered = &CCOrderedCollectionBTreeInterface
+    }
+};
+
+const CCCollectionInterface * const CCCollectionBTree = &CCCollectionBTreeInterface;
+
+
+#pragma mark - Tree Management
+
+static CCCollectionBTreeNode *CCCollectionBTreeCreateNode(CCAllocatorType Allocator, _Bool Leaf)
+{
+    CCCollectionBTreeNode *Node = CCMalloc(Allocator, sizeof(CCCollectionBTreeNode), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Node)
+    {
+        Node->parent = NULL;
+        Node->count = 0;
+        Node->total = 0;
+        Node->leaf = Leaf;
+    }
+    
+    return Node;
+}
+
+static void CCCollectionBTreeDestroyNode(CCCollectionBTreeNode *Node)
+{
+    for (size_t Loop = 0; Loop < Node->count; Loop++)
+    {
+        if (Node->leaf) CCFree(Node->items[Loop]);
+        else CCCollectionBTreeDestroyNode(Node->children[Loop]);
+    }
+    
+    CCFree(Node);
+}
+
+static size_t CCCollectionBTreeChildPosition(CCCollectionBTreeNode *Parent, CCCollectionBTreeNode *Child)
+{
+    for (size_t Loop = 0; ; Loop++)
+    {
+        if (Parent->children[Loop] == Child) return Loop;
+    }
+}
+
+static size_t CCCollectionBTreeItemPosition(CCCollectionBTreeNode *Leaf, CCCollectionBTreeItem *Item)
+{
+    for (size_t Loop = 0; ; Loop++)
+    {
+        if (Leaf->items[Loop] == Item) return Loop;
+    }
+}
+
+static void CCCollectionBTreeAdjustTotal(CCCollectionBTreeNode *Node, ptrdiff_t Amount)
+{
+    for ( ; Node; Node = Node->parent) Node->total += Amount;
+}
+
+/*!
+ * @brief Find the leaf containing the index.
+ * @param Node The subtree to search.
+ * @param Index A pointer to the index in the subtree, this will be set to the index in the leaf.
+ *        An index equal to the number of items will find the position after the last item.
+ *
+ * @return The leaf node.
+ */
+static CCCollectionBTreeNode *CCCollectionBTreeFindLeaf(CCCollectionBTreeNode *Node, size_t *Index)
+{
+    while (!Node->leaf)
+    {
+        size_t Loop = 0;
+        for (const size_t Last = Node->count - 1; Loop < Last; Loop++)
+        {
+            const size_t Total = Node->children[Loop]->total;
+            if (*Index < Total) break;
+            
+            *Index -= Total;
+        }
+        
+        Node = Node->children[Loop];
+    }
+    
+    return Node;
+}
+
+/*!
+ * @brief Split a full node in half.
+ * @description The new node is inserted into the parent after the split node, splitting the parent
+ *              first if it is also full.
+ *
+ * @param Internal The tree.
+ * @param Node The node to be split.
+ * @param Allocator The allocator to be used for the new nodes.
+ * @return The new node containing the upper half, or NULL on failure. On failure the tree is unchanged.
+ */
+static CCCollectionBTreeNode *CCCollectionBTreeSplit(CCCollectionBTreeInternal *Internal, CCCollectionBTreeNode *Node, CCAllocatorType Allocator)
+{
+    CCCollectionBTreeNode *Sibling = CCCollectionBTreeCreateNode(Allocator, Node->leaf);
+    if (!Sibling) return NULL;
+    
+    CCCollectionBTreeNode *Parent = Node->parent;
+    if (!Parent)
+    {
+        if (!(Parent = CCCollectionBTreeCreateNode(Allocator, FALSE)))
+        {
+            CCFree(Sibling);
+            return NULL;
+        }
+        
+        Parent->count = 1;
+        Parent->total = Node->total;
+        Parent->children[0] = Node;
+        
+        Node->parent = Parent;
+        Internal->root = Parent;
+    }
+    
+    else if (Parent->count == CC_COLLECTION_BTREE_NODE_SIZE)
+    {
+        if (!CCCollectionBTreeSplit(Internal, Parent, Allocator))
+        {
+            CCFree(Sibling);
+            return NULL;
+        }
+        
+        Parent = Node->parent;
+    }
+    
+    const size_t Half = Node->count / 2;
+    
+    Sibling->count = Node->count - Half;
+    memcpy(Sibling->children, Node->children + Half, sizeof(*Sibling->children) * Sibling->count);
+    Node->count = Half;
+    
+    if (Sibling->leaf)
+    {
+        for (size_t Loop = 0; Loop < Sibling->count; Loop++) Sibling->items[Loop]->leaf = Sibling;
+        
+        Sibling->total = Sibling->count;
+    }
+    
+    else
+    {
+        for (size_t Loop = 0; Loop < Sibling->count; Loop++)
+        {
+            Sibling->children[Loop]->parent = Sibling;
+            Sibling->total += Sibling->children[Loop]->total;
+        }
+    }
+    
+    Node->total -= Sibling->total;
+    
+    const size_t Position = CCCollectionBTreeChildPosition(Parent, Node) + 1;
+    memmove(Parent->children + Position + 1, Parent->children + Position, sizeof(*Parent->children) * (Parent->count - Position));
+    Parent->children[Position] = Sibling;
+    Parent->count++;
+    
+    Sibling->parent = Parent;
+    
+    return Sibling;
+}
+
+/*!
+ * @brief Restore the tree after a node has had items or children removed.
+ * @description Empty nodes are removed, sparse nodes are merged into a neighbour when they fit, and
+ *              a root with a single child is collapsed.
+ *
+ * @param Internal The tree.
+ * @param Node The node that had entries removed.
+ */
+static void CCCollectionBTreeRebalance(CCCollectionBTreeInternal *Internal, CCCollectionBTreeNode *Node)
+{
+    CCCollectionBTreeNode *Parent = Node->parent;
+    if (!Parent)
+    {
+        if (!Node->leaf)
+        {
+            if (Node->count == 1)
+            {
+                Internal->root = Node->children[0];
+                Internal->root->parent = NULL;
+                
+                CCFree(Node);
+            }
+            
+            else if (!Node->count)
+            {
+                Node->leaf = TRUE;
+                Node->total = 0;
+            }
+        }
+        
+        return;
+    }
+    
+    if (Node->count >= (CC_COLLECTION_BTREE_NODE_SIZE / 4)) return;
+    
+    const size_t Position = CCCollectionBTreeChildPosition(Parent, Node);
+    CCCollectionBTreeNode *Left = Node, *Right = NULL;
+    
+    if (Node->count)
+    {
+        if ((Position) && ((Parent->children[Position - 1]->count + Node->count) <= CC_COLLECTION_BTREE_NODE_SIZE))
+        {
+            Left = Parent->children[Position - 1];
+            Right = Node;
+        }
+        
+        else if (((Position + 1) < Parent->count) && ((Parent->children[Position + 1]->count + Node->count) <= CC_COLLECTION_BTREE_NODE_SIZE))
+        {
+            Right = Parent->children[Position + 1];
+        }
+        
+        else return;
+        
+        memcpy(Left->children + Left->count, Right->children, sizeof(*Left->children) * Right->count);
+        
+        for (size_t Loop = Left->count, Count = Left->count + Right->count; Loop < Count; Loop++)
+        {
+            if (Left->leaf) Left->items[Loop]->leaf = Left;
+            else Left->children[Loop]->parent = Left;
+        }
+        
+        Left->count += Right->count;
+        Left->total += Right->total;
+    }
+    
+    else Right = Node;
+    
+    const size_t RemovePosition = Right == Node ? Position : Position + 1;
+    memmove(Parent->children + RemovePosition, Parent->children + RemovePosition + 1, sizeof(*Parent->children) * (Parent->count - RemovePosition - 1));
+    Parent->count--;
+    
+    CCFree(Right);
+    
+    CCCollectionBTreeRebalance(Internal, Parent);
+}
+
+static CCCollectionBTreeItem *CCCollectionBTreeInsertItem(CCCollectionBTreeInternal *Internal, const void *Element, size_t Index, CCAllocatorType Allocator, size_t ElementSize)
+{
+    CCCollectionBTreeItem *Item = CCMalloc(Allocator, sizeof(CCCollectionBTreeItem) + ElementSize, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Item) return NULL;
+    
+    if (Element) memcpy(Item->data, Element, ElementSize);
+    
+    CCCollectionBTreeNode *Leaf = CCCollectionBTreeFindLeaf(Internal->root, &Index);
+    if (Leaf->count == CC_COLLECTION_BTREE_NODE_SIZE)
+    {
+        CCCollectionBTreeNode *Sibling = CCCollectionBTreeSplit(Internal, Leaf, Allocator);
+        if (!Sibling)
+        {
+            CCFree(Item);
+            return NULL;
+        }
+        
+        if (Index > Leaf->count)
+        {
+            Index -= Leaf->count;
+            Leaf = Sibling;
+        }
+    }
+    
+    memmove(Leaf->items + Index + 1, Leaf->items + Index, sizeof(*Leaf->items) * (Leaf->count - Index));
+    Leaf->items[Index] = Item;
+    Leaf->count++;
+    
+    Item->leaf = Leaf;
+    
+    CCCollectionBTreeAdjustTotal(Leaf, 1);
+    
+    return Item;
+}
+
+static void CCCollectionBTreeRemoveItem(CCCollectionBTreeInternal *Internal, CCCollectionBTreeItem *Item)
+{
+    CCCollectionBTreeNode *Leaf = Item->leaf;
+    const size_t Position = CCCollectionBTreeItemPosition(Leaf, Item);
+    
+    memmove(Leaf->items + Position, Leaf->items + Position + 1, sizeof(*Leaf->items) * (Leaf->count - Position - 1));
+    Leaf->count--;
+    
+    CCCollectionBTreeAdjustTotal(Leaf, -1);
+    CCFree(Item);
+    
+    CCCollectionBTreeRebalance(Internal, Leaf);
+}
+
+static CCCollectionBTreeNode *CCCollectionBTreeFirstLeaf(CCCollectionBTreeNode *Node)
+{
+    while (!Node->leaf) Node = Node->children[0];
+    
+    return Node;
+}
+
+static CCCollectionBTreeNode *CCCollectionBTreeLastLeaf(CCCollectionBTreeNode *Node)
+{
+    while (!Node->leaf) Node = Node->children[Node->count - 1];
+    
+    return Node;
+}
+
+static CCCollectionBTreeNode *CCCollectionBTreeNextLeaf(CCCollectionBTreeNode *Node)
+{
+    for (CCCollectionBTreeNode *Parent = Node->parent; Parent; Node = Parent, Parent = Parent->parent)
+    {
+        const size_t Position = CCCollectionBTreeChildPosition(Parent, Node) + 1;
+        if (Position < Parent->count) return CCCollectionBTreeFirstLeaf(Parent->children[Position]);
+    }
+    
+    return NULL;
+}
+
+static CCCollectionBTreeNode *CCCollectionBTreePreviousLeaf(CCCollectionBTreeNode *Node)
+{
+    for (CCCollectionBTreeNode *Parent = Node->parent; Parent; Node = Parent, Parent = Parent->parent)
+    {
+        const size_t Position = CCCollectionBTreeChildPosition(Parent, Node);
+        if (Position) return CCCollectionBTreeLastLeaf(Parent->children[Position - 1]);
+    }
+    
+    return NULL;
+}
+
+#pragma mark -
+
+static int CCCollectionBTreeHintWeight(CCCollectionHint Hint)
+{
+    return CCCollectionHintWeightCreate(Hint,
+                                        CCCollectionHintHeavyInserting
+                                        | CCCollectionHintHeavyDeleting
+                                        | CCCollectionHintConstantLength
+                                        | CCCollectionHintConstantElements
+                                        | CCCollectionHintOrdered
+                                        | CCOrderedCollectionHintHeavyReplacing
+                                        | CCOrderedCollectionHintHeavyAppending
+                                        | CCOrderedCollectionHintHeavyPrepending
+                                        | CCOrderedCollectionHintHeavyInserting,
+                                        CCCollectionHintHeavyEnumerating,
+                                        CCCollectionHintHeavyFinding
+                                        | CCOrderedCollectionHintHeavySorting);
+}
+
+static void *CCCollectionBTreeConstructor(CCAllocatorType Allocator, CCCollectionHint Hint, size_t ElementSize)
+{
+    CCCollectionBTreeInternal *Internal = CCMalloc(Allocator, sizeof(CCCollectionBTreeInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Internal)
+    {
+        *Internal = (CCCollectionBTreeInternal){
+            .root = CCCollectionBTreeCreateNode(Allocator, TRUE)
+        };
+        
+        if (!Internal->root)
+        {
+            CCFree(Internal);
+            Internal = NULL;
+        }
+    }
+    
+    return Internal;
+}
+
+static void CCCollectionBTreeDestructor(CCCollectionBTreeInternal *Internal)
+{
+    CCCollectionBTreeDestroyNode(Internal->root);
+    CCFree(Internal);
+}
+
+static size_t CCCollectionBTreeCount(CCCollectionBTreeInternal *Internal)
+{
+    return Internal->root->total;
+}
+
+static CCCollectionEntry CCCollectionBTreeInsert(CCCollectionBTreeInternal *Internal, const void *Element, CCAllocatorType Allocator, size_t ElementSize)
+{
+    return CCCollectionBTreeInsertItem(Internal, Element, Internal->root->total, Allocator, ElementSize);
+}
+
+static void CCCollectionBTreeRemove(CCCollectionBTreeInternal *Internal, CCCollectionEntry Entry, CCAllocatorType Allocator)
+{
+    CCCollectionBTreeRemoveItem(Internal, Entry);
+}
+
+static void *CCCollectionBTreeElement(CCCollectionBTreeInternal *Internal, CCCollectionEntry Entry)
+{
+    return ((CCCollectionBTreeItem*)Entry)->data;
+}
+
+static void *CCCollectionBTreeEnumerator(CCCollectionBTreeInternal *Internal, CCEnumeratorState *Enumerator, CCCollectionEnumeratorAction Action)
+{
+    CCCollectionBTreeNode *Leaf = Enumerator->internal.ptr;
+    
+    switch (Action)
+    {
+        case CCCollectionEnumeratorActionHead:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Leaf = Internal->root->total ? CCCollectionBTreeFirstLeaf(Internal->root) : NULL;
+            Enumerator->internal.extra[0] = 0;
+            break;
+            
+        case CCCollectionEnumeratorActionTail:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Leaf = Internal->root->total ? CCCollectionBTreeLastLeaf(Internal->root) : NULL;
+            Enumerator->internal.extra[0] = Leaf ? Leaf->count - 1 : 0;
+            break;
+            
+        case CCCollectionEnumeratorActionNext:
+            if ((Leaf) && (++Enumerator->internal.extra[0] == Leaf->count))
+            {
+                Leaf = CCCollectionBTreeNextLeaf(Leaf);
+                Enumerator->internal.extra[0] = 0;
+            }
+            break;
+            
+        case CCCollectionEnumeratorActionPrevious:
+            if (Leaf)
+            {
+                if (Enumerator->internal.extra[0]) Enumerator->internal.extra[0]--;
+                else if ((Leaf = CCCollectionBTreePreviousLeaf(Leaf))) Enumerator->internal.extra[0] = Leaf->count - 1;
+            }
+            break;
+            
+        case CCCollectionEnumeratorActionCurrent:
+            break;
+    }
+    
+    Enumerator->internal.ptr = Leaf;
+    
+    return Leaf ? Leaf->items[Enumerator->internal.extra[0]]->data : NULL;
+}
+
+static CCCollectionEntry CCCollectionBTreeEnumeratorEntry(CCCollectionBTreeInternal *Internal, CCEnumeratorState *Enumerator)
+{
+    CCCollectionBTreeNode *Leaf = Enumerator->internal.ptr;
+    
+    return Leaf ? Leaf->items[Enumerator->internal.extra[0]] : NULL;
+}
+
+static CCCollectionEntry CCOrderedCollectionBTreeInsert(CCCollectionBTreeInternal *Internal, const void *Element, size_t Index, CCAllocatorType Allocator, size_t ElementSize)
+{
+    return CCCollectionBTreeInsertItem(Internal, Element, Index, Allocator, ElementSize);
+}
+
+static CCCollectionEntry CCOrderedCollectionBTreeEntry(CCCollectionBTreeInternal *Internal, size_t Index)
+{
+    if (Index >= Internal->root->total) return NULL;
+    
+    CCCollectionBTreeNode *Leaf = CCCollectionBTreeFindLeaf(Internal->root, &Index);
+    
+    return Leaf->items[Index];
+}
+
+static size_t CCOrderedCollectionBTreeIndex(CCCollectionBTreeInternal *Internal, CCCollectionEntry Entry)
+{
+    CCCollectionBTreeNode *Node = ((CCCollectionBTreeItem*)Entry)->leaf;
+    size_t Index = CCCollectionBTreeItemPosition(Node, Entry);
+    
+    for (CCCollectionBTreeNode *Parent = Node->parent; Parent; Node = Parent, Parent = Parent->parent)
+    {
+        for (size_t Loop = 0; Parent->children[Loop] != Node; Loop++) Index += Parent->children[Loop]->total;
+    }
+    
+    return Index;
+}
+
+static CCCollectionEntry CCOrderedCollectionBTreeReplace(CCCollectionBTreeInternal *Internal, const void *Element, size_t Index, CCAllocatorType Allocator, size_t ElementSize)
+{
+    CCCollectionBTreeItem *Item = CCOrderedCollectionBTreeEntry(Internal, Index);
+    if (Element) memcpy(Item->data, Element, ElementSize);
+    
+    return Item;
+}
+
+static void CCOrderedCollectionBTreeRemove(CCCollectionBTreeInternal *Internal, size_t Index, CCAllocatorType Allocator)
+{
+    CCCollectionBTreeRemoveItem(Internal, CCOrderedCollectionBTreeEntry(Internal, Index));
+}
+
+static CCCollectionEntry CCOrderedCollectionBTreePrepend(CCCollectionBTreeInternal *Internal, const void *Element, CCAllocatorType Allocator, size_t ElementSize)
+{
+    return CCCollectionBTreeInsertItem(Internal, Element, 0, Allocator, ElementSize);
+}
+
+static void *CCOrderedCollectionBTreeElement(CCCollectionBTreeInternal *Internal, size_t Index)
+{
+    CCCollectionBTreeItem *Item = CCOrderedCollectionBTreeEntry(Internal, Index);
+    
+    return Item ? Item->data : NULL;
+}
+
+static CCCollectionEntry CCOrderedCollectionBTreeEntryLast(CCCollectionBTreeInternal *Internal)
+{
+    if (!Internal->root->total) return NULL;
+    
+    CCCollectionBTreeNode *Leaf = CCCollectionBTreeLastLeaf(Internal->root);
+    
+    return Leaf->items[Leaf->count - 1];
+}
+
+static void CCOrderedCollectionBTreeRemoveLast(CCCollectionBTreeInternal *Internal, CCAllocatorType Allocator)
+{
+    CCCollectionEntry Entry = CCOrderedCollectionBTreeEntryLast(Internal);
+    if (Entry) CCCollectionBTreeRemoveItem(Internal, Entry);
+}
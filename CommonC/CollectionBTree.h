@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCCollectionBTree
+ * CCCollectionBTree is an interface for a B-tree backed collection implementation. This interface
+ * can also be used for ordered collections.
+ *
+ * Elements are referenced from chunked leaf nodes, with the inner nodes tracking the number of
+ * elements in each subtree. This allows positional operations to be performed in O(log n).
+ *
+ * For ordered collections with lots of inserting and removing inside the collection this is ideal.
+ *
+ * Fast Operations:
+ * - Replacing entries.
+ * - Inserting items to the collection.
+ * - Removing items.
+ *
+ * Slow Operations:
+ * - Finding items in the collection.
+ *
+ *
+ * Fast Ordered Operations:
+ * - Inserting items inside the collection.
+ * - Removing items inside the collection.
+ * - Prepending and appending items.
+ * - Index lookup.
+ *
+ * Slow Ordered Operations:
+ * - Sorting.
+ */
+#ifndef CommonC_CollectionBTree_h
+#define CommonC_CollectionBTree_h
+
+#include <CommonC/CollectionInterface.h>
+
+extern const CCCollectionInterface * const CCCollectionBTree;
+
+#endif
@@ -127,7 +127,7 @@ static void *CCCollectionFastArrayConstructor(CCAllocatorType Allocator, CCColle
             break;
     }
     
-    return CCArrayCreate(Allocator, ElementSize, ChunkSize);
+    return CCArrayCreateSmall(Allocator, ElementSize, ChunkSize, ChunkSize);
 }
 
 static CCCollectionEntry CCCollectionFastArrayInsert(CCArray Internal, const void *Element, CCAllocatorType Allocator, size_t ElementSize)
@@ -0,0 +1,212 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "CollectionSortedArray.h"
+#include "Collection.h"
+#include "Array.h"
+#include "MemoryAllocation.h"
+#include <string.h>
+
+
+typedef struct {
+    CCArray array;
+    CCComparator comparator;
+} CCCollectionSortedArrayInternal;
+
+
+static int CCCollectionSortedArrayHintWeight(CCCollectionHint Hint);
+static void *CCCollectionSortedArrayConstructor(CCAllocatorType Allocator, CCCollectionHint Hint, size_t ElementSize);
+static void CCCollectionSortedArrayDestructor(CCCollectionSortedArrayInternal *Internal);
+static size_t CCCollectionSortedArrayCount(CCCollectionSortedArrayInternal *Internal);
+static CCCollectionEntry CCCollectionSortedArrayInsert(CCCollectionSortedArrayInternal *Internal, const void *Element, CCAllocatorType Allocator, size_t ElementSize);
+static void CCCollectionSortedArrayRemove(CCCollectionSortedArrayInternal *Internal, CCCollectionEntry Entry, CCAllocatorType Allocator);
+static void *CCCollectionSortedArrayElement(CCCollectionSortedArrayInternal *Internal, CCCollectionEntry Entry);
+static void *CCCollectionSortedArrayEnumerator(CCCollectionSortedArrayInternal *Internal, CCEnumeratorState *Enumerator, CCCollectionEnumeratorAction Action);
+static CCCollectionEntry CCCollectionSortedArrayEnumeratorEntry(CCCollectionSortedArrayInternal *Internal, CCEnumeratorState *Enumerator);
+static CCCollectionEntry CCCollectionSortedArrayFind(CCCollectionSortedArrayInternal *Internal, const void *Element, CCComparator Comparator, size_t ElementSize);
+static void CCCollectionSortedArrayRemoveAll(CCCollectionSortedArrayInternal *Internal, CCAllocatorType Allocator);
+
+
+const CCCollectionInterface CCCollectionSortedArrayInterface = {
+    .hintWeight = CCCollectionSortedArrayHintWeight,
+    .create = CCCollectionSortedArrayConstructor,
+    .destroy = (CCCollectionDestructorCallback)CCCollectionSortedArrayDestructor,
+    .count = (CCCollectionCountCallback)CCCollectionSortedArrayCount,
+    .insert = (CCCollectionInsertCallback)CCCollectionSortedArrayInsert,
+    .remove =  (CCCollectionRemoveCallback)CCCollectionSortedArrayRemove,
+    .element = (CCCollectionElementCallback)CCCollectionSortedArrayElement,
+    .enumerator = (CCCollectionEnumeratorCallback)CCCollectionSortedArrayEnumerator,
+    .enumeratorReference = (CCCollectionEnumeratorEntryCallback)CCCollectionSortedArrayEnumeratorEntry,
+    .optional = {
+        .find = (CCCollectionFindCallback)CCCollectionSortedArrayFind,
+        .removeAll = (CCCollectionRemoveAllCallback)CCCollectionSortedArrayRemoveAll
+    }
+};
+
+const CCCollectionInterface * const CCCollectionSortedArray = &CCCollectionSortedArrayInterface;
+
+
+void CCCollectionSortedArraySetComparator(CCCollection Collection, CCComparator Comparator)
+{
+    CCAssertLog(Collection, "Collection must not be null");
+    CCAssertLog(Collection->interface == CCCollectionSortedArray, "Collection must be a sorted array collection");
+    
+    CCCollectionSortedArrayInternal *Internal = Collection->internal;
+    if (Internal->comparator != Comparator)
+    {
+        Internal->comparator = Comparator;
+        CCArraySort(Internal->array, Comparator);
+    }
+}
+
+static int CCCollectionSortedArrayHintWeight(CCCollectionHint Hint)
+{
+    return CCCollectionHintWeightCreate(Hint,
+                                        CCCollectionHintHeavyEnumerating
+                                        | CCCollectionHintHeavyFinding
+                                        | CCCollectionHintConstantLength
+                                        | CCCollectionHintConstantElements,
+                                        CCCollectionHintHeavyInserting
+                                        | CCCollectionHintHeavyDeleting,
+                                        0);
+}
+
+static void *CCCollectionSortedArrayConstructor(CCAllocatorType Allocator, CCCollectionHint Hint, size_t ElementSize)
+{
+    CCCollectionSortedArrayInternal *Internal = CCMalloc(Allocator, sizeof(CCCollectionSortedArrayInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Internal)
+    {
+        size_t ChunkSize = 5;
+        switch (Hint & CCCollectionHintSizeMask)
+        {
+            case CCCollectionHintSizeSmall:
+                ChunkSize = 5;
+                break;
+                
+            case CCCollectionHintSizeMedium:
+                ChunkSize = 20;
+                break;
+                
+            case CCCollectionHintSizeLarge:
+                ChunkSize = 50;
+                break;
+        }
+        
+        *Internal = (CCCollectionSortedArrayInternal){
+            .array = CCArrayCreateSmall(Allocator, ElementSize, ChunkSize, ChunkSize),
+            .comparator = NULL
+        };
+        
+        if (!Internal->array)
+        {
+            CCFree(Internal);
+            Internal = NULL;
+        }
+    }
+    
+    return Internal;
+}
+
+static void CCCollectionSortedArrayDestructor(CCCollectionSortedArrayInternal *Internal)
+{
+    CCArrayDestroy(Internal->array);
+    CCFree(Internal);
+}
+
+static size_t CCCollectionSortedArrayCount(CCCollectionSortedArrayInternal *Internal)
+{
+    return CCArrayGetCount(Internal->array);
+}
+
+static CCCollectionEntry CCCollectionSortedArrayInsert(CCCollectionSortedArrayInternal *Internal, const void *Element, CCAllocatorType Allocator, size_t ElementSize)
+{
+    return (CCCollectionEntry)(CCArrayInsertSorted(Internal->array, Element, Internal->comparator) + 1);
+}
+
+static void CCCollectionSortedArrayRemove(CCCollectionSortedArrayInternal *Internal, CCCollectionEntry Entry, CCAllocatorType Allocator)
+{
+    CCArrayRemoveElementAtIndex(Internal->array, (size_t)Entry - 1);
+}
+
+static void *CCCollectionSortedArrayElement(CCCollectionSortedArrayInternal *Internal, CCCollectionEntry Entry)
+{
+    return CCArrayGetElementAtIndex(Internal->array, (size_t)Entry - 1);
+}
+
+static void *CCCollectionSortedArrayEnumerator(CCCollectionSortedArrayInternal *Internal, CCEnumeratorState *Enumerator, CCCollectionEnumeratorAction Action)
+{
+    switch (Action)
+    {
+        case CCCollectionEnumeratorActionHead:
+            Enumerator->type = CCEnumeratorFormatBatch;
+            Enumerator->batch.count = CCArrayGetCount(Internal->array);
+            Enumerator->batch.index = 0;
+            Enumerator->batch.stride = CCArrayGetElementSize(Internal->array);
+            Enumerator->batch.ptr = Enumerator->batch.count ? CCArrayGetElementAtIndex(Internal->array, 0) : NULL;
+            return Enumerator->batch.count ? CCArrayGetElementAtIndex(Internal->array, Enumerator->batch.index) : NULL;
+            
+        case CCCollectionEnumeratorActionTail:
+            Enumerator->type = CCEnumeratorFormatBatch;
+            Enumerator->batch.count = CCArrayGetCount(Internal->array);
+            Enumerator->batch.index = CCArrayGetCount(Internal->array) - 1;
+            Enumerator->batch.stride = CCArrayGetElementSize(Internal->array);
+            Enumerator->batch.ptr = Enumerator->batch.count ? CCArrayGetElementAtIndex(Internal->array, 0) : NULL;
+            return Enumerator->batch.count ? CCArrayGetElementAtIndex(Internal->array, Enumerator->batch.index) : NULL;
+            
+        default:
+            break;
+    }
+    
+    return NULL;
+}
+
+static CCCollectionEntry CCCollectionSortedArrayEnumeratorEntry(CCCollectionSortedArrayInternal *Internal, CCEnumeratorState *Enumerator)
+{
+    return (CCCollectionEntry)(Enumerator->batch.index + 1);
+}
+
+static CCCollectionEntry CCCollectionSortedArrayFind(CCCollectionSortedArrayInternal *Internal, const void *Element, CCComparator Comparator, size_t ElementSize)
+{
+    if (Comparator == Internal->comparator)
+    {
+        const size_t Index = CCArrayBinarySearch(Internal->array, Element, Comparator, NULL);
+        return Index != SIZE_MAX ? (CCCollectionEntry)(Index + 1) : NULL;
+    }
+    
+    //The comparator may only test for equality, so it cannot be used to search the sorted order
+    for (size_t Loop = 0, Count = CCArrayGetCount(Internal->array); Loop < Count; Loop++)
+    {
+        const void *Current = CCArrayGetElementAtIndex(Internal->array, Loop);
+        if (Comparator ? Comparator(Current, Element) == CCComparisonResultEqual : !memcmp(Current, Element, ElementSize)) return (CCCollectionEntry)(Loop + 1);
+    }
+    
+    return NULL;
+}
+
+static void CCCollectionSortedArrayRemoveAll(CCCollectionSortedArrayInternal *Internal, CCAllocatorType Allocator)
+{
+    CCArrayRemoveAllElements(Internal->array);
+}
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCCollectionSortedArray
+ * CCCollectionSortedArray is an interface for a sorted array backed collection implementation. This interface
+ * cannot be used for ordered collections, as the position of elements is determined by their sort order. Use
+ * cases that rely on persistent @b CCCollectionEntry references will not work. Due to this, the implementation
+ * will never be used by the implicit @b CCCollectionCreate function. Instead usage is explicit and therefore
+ * must use the @b CCCollectionCreateWithImplementation function.
+ *
+ * @b CCCollectionEntry are valid only temporarily. If any mutation happens, there is not guarantee they will be valid.
+ * As an entry reference is just the current index of the element.
+ *
+ * Elements are kept sorted by the collection's comparator (by default a memcmp), and are enumerated in that order.
+ * Finding an element using the same comparator is performed with a binary search, while finding with any other
+ * comparator falls back to a linear search.
+ *
+ * Fast Operations:
+ * - Enumerating.
+ * - Finding items in the collection (using the collection's comparator).
+ * - Removing all items in the collection.
+ *
+ * Slow Operations:
+ * - Inserting items inside the collection.
+ * - Removing items inside the collection.
+ * - Changing the comparator.
+ */
+#ifndef CommonC_CollectionSortedArray_h
+#define CommonC_CollectionSortedArray_h
+
+#include <CommonC/CollectionInterface.h>
+
+extern const CCCollectionInterface * const CCCollectionSortedArray;
+
+/*!
+ * @brief Set the comparator the collection's elements should be sorted by.
+ * @description The collection will be re-sorted if the comparator has changed.
+ * @warning The collection must be using the @b CCCollectionSortedArray implementation.
+ * @param Collection The collection to set the comparator of.
+ * @param Comparator The comparison used to order the elements, where ascending elements will be
+ *        placed before descending elements. If NULL the elements will be ordered using a memcmp.
+ */
+void CCCollectionSortedArraySetComparator(CCCollection Collection, CCComparator Comparator);
+
+#endif
@@ -49,6 +49,8 @@
 #include <CommonC/Allocator.h>
 #include <CommonC/CallbackAllocator.h>
 #include <CommonC/DebugAllocator.h>
+#include <CommonC/SamplingAllocator.h>
+#include <CommonC/Scratch.h>
 #include <CommonC/MemoryAllocation.h>
 
 #include <CommonC/Logging.h>
@@ -71,6 +73,7 @@
 #include <CommonC/Enumerator.h>
 #include <CommonC/Enumerable.h>
 #include <CommonC/LinkedList.h>
+#include <CommonC/IntrusiveList.h>
 #include <CommonC/Array.h>
 #include <CommonC/List.h>
 #include <CommonC/ConcurrentIndexMap.h>
@@ -80,6 +83,11 @@
 #include <CommonC/CollectionArray.h>
 #include <CommonC/CollectionList.h>
 #include <CommonC/CollectionFastArray.h>
+#include <CommonC/CollectionBTree.h>
+#include <CommonC/CollectionSortedArray.h>
+#include <CommonC/BitArray.h>
+#include <CommonC/RoaringBitmap.h>
+#include <CommonC/SoAArray.h>
 
 #include <CommonC/PathComponent.h>
 #include <CommonC/Path.h>
@@ -100,13 +108,19 @@
 #include <CommonC/HashMapSeparateChainingArray.h>
 #include <CommonC/HashMapSeparateChainingArrayDataOrientedHash.h>
 #include <CommonC/HashMapSeparateChainingArrayDataOrientedAll.h>
+#include <CommonC/HashMapSwissTable.h>
+#include <CommonC/HashMapRobinHood.h>
 
 #include <CommonC/Dictionary.h>
 #include <CommonC/DictionaryEnumerator.h>
 #include <CommonC/DictionaryHashMap.h>
+#include <CommonC/DictionaryPerfectHash.h>
+#include <CommonC/DictionaryCompact.h>
 
 #include <CommonC/Queue.h>
 #include <CommonC/ConcurrentQueue.h>
+#include <CommonC/PriorityQueue.h>
+#include <CommonC/ConcurrentPriorityQueue.h>
 
 #include <CommonC/ConcurrentGarbageCollector.h>
 #include <CommonC/EpochGarbageCollector.h>
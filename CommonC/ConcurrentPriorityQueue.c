@@ -0,0 +1,239 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "ConcurrentPriorityQueue.h"
+#include "PriorityQueue.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "Logging.h"
+#include "Random.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#define CC_CONCURRENT_PRIORITY_QUEUE_SHARD_ALIGNMENT 64
+
+typedef union {
+    struct {
+        atomic_flag lock;
+        _Atomic(size_t) count;
+        CCPriorityQueue queue;
+    };
+    uint8_t padding[CC_CONCURRENT_PRIORITY_QUEUE_SHARD_ALIGNMENT]; //keep each queue on its own cache line
+} CCConcurrentPriorityQueueShard;
+
+typedef struct CCConcurrentPriorityQueueInfo {
+    CCComparator comparator;
+    size_t size;
+    size_t count;
+    CCConcurrentPriorityQueueShard *shards;
+    uint8_t storage[];
+} CCConcurrentPriorityQueueInfo;
+
+//Allocations are only aligned to max_align_t, so the shards are offset to the next cache line boundary within the allocation
+#define CC_CONCURRENT_PRIORITY_QUEUE_SIZE(count) (sizeof(CCConcurrentPriorityQueueInfo) + (CC_CONCURRENT_PRIORITY_QUEUE_SHARD_ALIGNMENT - 1) + (sizeof(CCConcurrentPriorityQueueShard) * (count)))
+
+
+static void CCConcurrentPriorityQueueDestructor(CCConcurrentPriorityQueue Queue)
+{
+    for (size_t Loop = 0; Loop < Queue->count; Loop++)
+    {
+        if (Queue->shards[Loop].queue) CCPriorityQueueDestroy(Queue->shards[Loop].queue);
+    }
+}
+
+CCConcurrentPriorityQueue CCConcurrentPriorityQueueCreate(CCAllocatorType Allocator, size_t Size, size_t Arity, CCComparator Comparator, size_t Count)
+{
+    CCAssertLog(Count, "Count must not be 0");
+    
+    CCConcurrentPriorityQueue Queue = CCMalloc(Allocator, CC_CONCURRENT_PRIORITY_QUEUE_SIZE(Count), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Queue)
+    {
+        Queue->comparator = Comparator;
+        Queue->size = Size;
+        Queue->count = Count;
+        Queue->shards = (CCConcurrentPriorityQueueShard*)(((uintptr_t)Queue->storage + (CC_CONCURRENT_PRIORITY_QUEUE_SHARD_ALIGNMENT - 1)) & ~(uintptr_t)(CC_CONCURRENT_PRIORITY_QUEUE_SHARD_ALIGNMENT - 1));
+        
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            atomic_flag_clear_explicit(&Queue->shards[Loop].lock, memory_order_relaxed);
+            atomic_init(&Queue->shards[Loop].count, 0);
+            Queue->shards[Loop].queue = CCPriorityQueueCreate(Allocator, Size, Arity, Comparator);
+        }
+        
+        CCMemorySetDestructor(Queue, (CCMemoryDestructorCallback)CCConcurrentPriorityQueueDestructor);
+        
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            if (!Queue->shards[Loop].queue)
+            {
+                CC_LOG_ERROR("Failed to create concurrent priority queue: Failed to create internal queue");
+                CCFree(Queue);
+                
+                return NULL;
+            }
+        }
+    }
+    
+    else
+    {
+        CC_LOG_ERROR("Failed to create concurrent priority queue: Failed to allocate memory of size (%zu)", CC_CONCURRENT_PRIORITY_QUEUE_SIZE(Count));
+    }
+    
+    return Queue;
+}
+
+void CCConcurrentPriorityQueueDestroy(CCConcurrentPriorityQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    CCFree(Queue);
+}
+
+static inline size_t CCConcurrentPriorityQueueRandomIndex(CCConcurrentPriorityQueue Queue)
+{
+    static _Thread_local CCRandomState_xorshift State = 0;
+    if (!State) CCRandomSeed_xorshift(&State, (uint32_t)((uintptr_t)&State >> 4));
+    
+    return CCRandom_xorshift(&State) % Queue->count;
+}
+
+static inline _Bool CCConcurrentPriorityQueueTryLock(CCConcurrentPriorityQueueShard *Shard)
+{
+    return !atomic_flag_test_and_set_explicit(&Shard->lock, memory_order_acquire);
+}
+
+static inline void CCConcurrentPriorityQueueUnlock(CCConcurrentPriorityQueueShard *Shard)
+{
+    atomic_flag_clear_explicit(&Shard->lock, memory_order_release);
+}
+
+static inline _Bool CCConcurrentPriorityQueuePopShard(CCConcurrentPriorityQueueShard *Shard, void *Element)
+{
+    if (!CCPriorityQueuePop(Shard->queue, Element)) return FALSE;
+    
+    atomic_store_explicit(&Shard->count, CCPriorityQueueGetCount(Shard->queue), memory_order_relaxed);
+    
+    return TRUE;
+}
+
+_Bool CCConcurrentPriorityQueuePush(CCConcurrentPriorityQueue Queue, const void *Element)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    CCAssertLog(Element, "Element must not be null");
+    
+    CCConcurrentPriorityQueueShard *Shard;
+    while (!CCConcurrentPriorityQueueTryLock((Shard = &Queue->shards[CCConcurrentPriorityQueueRandomIndex(Queue)]))) CC_SPIN_WAIT();
+    
+    const _Bool Pushed = CCPriorityQueuePush(Shard->queue, Element) != CC_PRIORITY_QUEUE_HANDLE_INVALID;
+    atomic_store_explicit(&Shard->count, CCPriorityQueueGetCount(Shard->queue), memory_order_relaxed);
+    
+    CCConcurrentPriorityQueueUnlock(Shard);
+    
+    return Pushed;
+}
+
+_Bool CCConcurrentPriorityQueuePop(CCConcurrentPriorityQueue Queue, void *Element)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    for ( ; ; CC_SPIN_WAIT())
+    {
+        size_t First = CCConcurrentPriorityQueueRandomIndex(Queue), Second = CCConcurrentPriorityQueueRandomIndex(Queue);
+        
+        if (!atomic_load_explicit(&Queue->shards[First].count, memory_order_relaxed)) First = Second;
+        else if (!atomic_load_explicit(&Queue->shards[Second].count, memory_order_relaxed)) Second = First;
+        
+        if (!atomic_load_explicit(&Queue->shards[First].count, memory_order_relaxed))
+        {
+            //Both choices look empty, so fall back to checking every queue before reporting empty
+            _Bool Contended = FALSE;
+            for (size_t Loop = 0; Loop < Queue->count; Loop++)
+            {
+                CCConcurrentPriorityQueueShard *Shard = &Queue->shards[(First + Loop) % Queue->count];
+                if (!atomic_load_explicit(&Shard->count, memory_order_relaxed)) continue;
+                
+                if (!CCConcurrentPriorityQueueTryLock(Shard))
+                {
+                    Contended = TRUE;
+                    continue;
+                }
+                
+                const _Bool Popped = CCConcurrentPriorityQueuePopShard(Shard, Element);
+                CCConcurrentPriorityQueueUnlock(Shard);
+                
+                if (Popped) return TRUE;
+            }
+            
+            if (Contended) continue;
+            
+            return FALSE;
+        }
+        
+        if (First > Second)
+        {
+            const size_t Temp = First;
+            First = Second;
+            Second = Temp;
+        }
+        
+        CCConcurrentPriorityQueueShard *Shard = &Queue->shards[First], *Other = &Queue->shards[Second];
+        if (!CCConcurrentPriorityQueueTryLock(Shard)) continue;
+        
+        if (Shard != Other)
+        {
+            if (!CCConcurrentPriorityQueueTryLock(Other))
+            {
+                CCConcurrentPriorityQueueUnlock(Shard);
+                continue;
+            }
+            
+            const void *Front = CCPriorityQueuePeek(Shard->queue), *OtherFront = CCPriorityQueuePeek(Other->queue);
+            if ((!Front) || ((OtherFront) && (Queue->comparator ? Queue->comparator(OtherFront, Front) == CCComparisonResultAscending : memcmp(OtherFront, Front, Queue->size) < 0)))
+            {
+                CCConcurrentPriorityQueueShard *Temp = Shard;
+                Shard = Other;
+                Other = Temp;
+            }
+            
+            CCConcurrentPriorityQueueUnlock(Other);
+        }
+        
+        const _Bool Popped = CCConcurrentPriorityQueuePopShard(Shard, Element);
+        CCConcurrentPriorityQueueUnlock(Shard);
+        
+        if (Popped) return TRUE;
+    }
+}
+
+size_t CCConcurrentPriorityQueueGetCount(CCConcurrentPriorityQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    size_t Count = 0;
+    for (size_t Loop = 0; Loop < Queue->count; Loop++) Count += atomic_load_explicit(&Queue->shards[Loop].count, memory_order_relaxed);
+    
+    return Count;
+}
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_ConcurrentPriorityQueue_h
+#define CommonC_ConcurrentPriorityQueue_h
+
+/*
+ Relaxed priority queue implementation (MultiQueue): https://arxiv.org/abs/1411.1209
+ Elements are spread over several independently locked priority queues. Pushing picks a random
+ queue, while popping picks two random queues and takes the better of their fronts. So popped
+ elements are amongst the highest priority elements, but not strictly the highest.
+ */
+
+#include <CommonC/Base.h>
+#include <CommonC/Container.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Comparator.h>
+
+/*!
+ * @brief The concurrent priority queue.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCConcurrentPriorityQueueInfo *CCConcurrentPriorityQueue;
+
+CC_CONTAINER_DECLARE_PRESET_1(CCConcurrentPriorityQueue);
+
+/*!
+ * @define CC_CONCURRENT_PRIORITY_QUEUE_DECLARE
+ * @abstract Convenient macro to define a @b CCConcurrentPriorityQueue type that can be referenced by @b CCConcurrentPriorityQueue.
+ * @param element The element type.
+ */
+#define CC_CONCURRENT_PRIORITY_QUEUE_DECLARE(element) CC_CONTAINER_DECLARE(CCConcurrentPriorityQueue, element)
+
+/*!
+ * @define CC_CONCURRENT_PRIORITY_QUEUE
+ * @abstract Convenient macro to define an explicitly typed @b CCConcurrentPriorityQueue.
+ * @param element The element type.
+ */
+#define CC_CONCURRENT_PRIORITY_QUEUE(element) CC_CONTAINER(CCConcurrentPriorityQueue, element)
+
+/*!
+ * @define CCConcurrentPriorityQueue
+ * @abstract Convenient macro to define an explicitly typed @b CCConcurrentPriorityQueue.
+ * @description In the case that this macro is conflicting with the standalone @b CCConcurrentPriorityQueue type, simply
+ *              undefine it and redefine it back to @b CC_CONCURRENT_PRIORITY_QUEUE.
+ *
+ * @param element The element type.
+ */
+#define CCConcurrentPriorityQueue(element) CC_CONCURRENT_PRIORITY_QUEUE(element)
+
+#pragma mark - Creation / Destruction
+/*!
+ * @brief Create a concurrent priority queue.
+ * @description This queue allows for many producer-consumer access.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Size The size of the elements.
+ * @param Arity The number of children each node of the internal heaps has. Must be at least 2.
+ * @param Comparator The comparison used to order the elements, where ascending elements will be
+ *        popped before descending elements. If NULL the elements will be ordered using a memcmp.
+ *
+ * @param Count The number of internal queues. A small multiple of the number of accessing threads
+ *        (e.g. 2x) reduces contention, while fewer queues keeps the popping order closer to strict.
+ *
+ * @return A concurrent priority queue, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCConcurrentPriorityQueue CCConcurrentPriorityQueueCreate(CCAllocatorType Allocator, size_t Size, size_t Arity, CCComparator Comparator, size_t Count);
+
+/*!
+ * @brief Destroy a concurrent priority queue.
+ * @param Queue The concurrent priority queue to be destroyed.
+ */
+void CCConcurrentPriorityQueueDestroy(CCConcurrentPriorityQueue CC_DESTROY(Queue));
+
+#pragma mark - Insertions/Deletions
+/*!
+ * @brief Push an element onto the concurrent priority queue.
+ * @param Queue The concurrent priority queue to add the element to.
+ * @param Element The pointer to the element to be copied into the queue.
+ * @return TRUE if the element was pushed, otherwise FALSE on failure.
+ */
+_Bool CCConcurrentPriorityQueuePush(CCConcurrentPriorityQueue Queue, const void *Element);
+
+/*!
+ * @brief Pop one of the highest priority elements from the concurrent priority queue.
+ * @param Queue The concurrent priority queue to remove the element from.
+ * @param Element The pointer to where the element should be copied to. May be NULL.
+ * @return TRUE if an element was popped, otherwise FALSE if the queue is empty.
+ */
+_Bool CCConcurrentPriorityQueuePop(CCConcurrentPriorityQueue Queue, void *Element);
+
+#pragma mark - Query
+/*!
+ * @brief Get the current number of elements in the concurrent priority queue.
+ * @description This is only an approximation if the queue is being modified concurrently.
+ * @param Queue The concurrent priority queue to get the count of.
+ * @return The number of elements.
+ */
+size_t CCConcurrentPriorityQueueGetCount(CCConcurrentPriorityQueue Queue);
+
+#endif
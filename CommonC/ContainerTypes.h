@@ -9,6 +9,8 @@ CC_CONTAINER_DECLARE(CCCollection, FSPath);
 
 #define CC_CONTAINER_DECLARE_PRESET_CCConcurrentIndexMap()
 
+#define CC_CONTAINER_DECLARE_PRESET_CCConcurrentPriorityQueue()
+
 #define CC_CONTAINER_DECLARE_PRESET_CCConcurrentQueue()
 
 #define CC_CONTAINER_DECLARE_PRESET_CCData()
@@ -29,4 +31,6 @@ CC_CONTAINER_DECLARE(CCOrderedCollection, CCString); \
 CC_CONTAINER_DECLARE(CCOrderedCollection, FSPath); \
 CC_CONTAINER_DECLARE(CCOrderedCollection, FSPathComponent);
 
+#define CC_CONTAINER_DECLARE_PRESET_CCPriorityQueue()
+
 #define CC_CONTAINER_DECLARE_PRESET_CCQueue()
@@ -32,10 +32,70 @@
 #include "Types.h"
 #include <string.h>
 
+#ifndef CC_DATA_HASH_CHECKPOINT_SIZE
+#define CC_DATA_HASH_CHECKPOINT_SIZE 65536
+#endif
+
 static void CCDataDestructor(CCData Data)
 {
     if (Data->destructor) Data->destructor(Data);
     Data->interface->destroy(Data->internal);
+    
+    if (Data->hashCheckpoints.states) CCFree(Data->hashCheckpoints.states);
+}
+
+static CC_FORCE_INLINE void CCDataModified(CCData Data, size_t Offset)
+{
+    Data->mutated = TRUE;
+    
+    const size_t Valid = Offset / CC_DATA_HASH_CHECKPOINT_SIZE;
+    if (Data->hashCheckpoints.count > Valid) Data->hashCheckpoints.count = Valid;
+}
+
+static uint32_t CCDataDefaultHash(CCData Data)
+{
+    const size_t Size = CCDataGetSize(Data), Count = Size / CC_DATA_HASH_CHECKPOINT_SIZE;
+    
+    if (Count > Data->hashCheckpoints.capacity)
+    {
+        CCHashMurmur32State *States = CCRealloc(Data->allocator, Data->hashCheckpoints.states, sizeof(CCHashMurmur32State) * Count, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (States)
+        {
+            Data->hashCheckpoints.states = States;
+            Data->hashCheckpoints.capacity = Count;
+        }
+    }
+    
+    CCHashMurmur32State State, *States = Data->hashCheckpoints.states;
+    size_t Offset = Data->hashCheckpoints.count * CC_DATA_HASH_CHECKPOINT_SIZE;
+    
+    if (Data->hashCheckpoints.count) State = States[Data->hashCheckpoints.count - 1];
+    else CCHashMurmur32Init(&State, 0);
+    
+    size_t PreferredMapSize = CCDataGetPreferredMapSize(Data);
+    if (PreferredMapSize > CC_DATA_HASH_CHECKPOINT_SIZE) PreferredMapSize = CC_DATA_HASH_CHECKPOINT_SIZE;
+    else if (!PreferredMapSize) PreferredMapSize = 1;
+    
+    while (Offset < Size)
+    {
+        const size_t CheckpointEnd = (Offset / CC_DATA_HASH_CHECKPOINT_SIZE + 1) * CC_DATA_HASH_CHECKPOINT_SIZE;
+        const size_t MapSize = (CheckpointEnd < Size ? CheckpointEnd : Size) - Offset;
+        
+        CCBufferMap Map = CCDataMapBuffer(Data, Offset, MapSize < PreferredMapSize ? MapSize : PreferredMapSize, CCDataHintRead);
+        CCHashMurmur32Update(&State, Map.ptr, Map.size);
+        CCDataUnmapBuffer(Data, Map);
+        
+        if (!Map.size) break;
+        
+        Offset += Map.size;
+        
+        if ((Offset == CheckpointEnd) && (Data->hashCheckpoints.count < Data->hashCheckpoints.capacity))
+        {
+            States[Data->hashCheckpoints.count++] = State;
+        }
+    }
+    
+    return CCHashMurmur32Final(&State);
 }
 
 CCData CCDataCreate(CCAllocatorType Allocator, CCDataHint Hint, void *InitData, CCDataBufferHash Hash, CCDataBufferDestructor Destructor, const CCDataInterface *Interface)
@@ -52,7 +112,8 @@ CCData CCDataCreate(CCAllocatorType Allocator, CCDataHint Hint, void *InitData,
             .hasher = Hash,
             .hash = 0,
             .internal = Interface->create(Allocator, Hint, InitData),
-            .mutated = TRUE
+            .mutated = TRUE,
+            .hashCheckpoints = { .count = 0, .capacity = 0, .states = NULL }
         };
         
         if (!Data->internal)
@@ -103,7 +164,14 @@ _Bool CCDataSetSize(CCData Data, size_t Size)
 {
     CCAssertLog(Data, "Data must not be null");
     
-    return Data->interface->optional.resize ? Data->interface->optional.resize(Data->internal, Size) : FALSE;
+    if (!Data->interface->optional.resize) return FALSE;
+    
+    const size_t PrevSize = CCDataGetSize(Data);
+    if (!Data->interface->optional.resize(Data->internal, Size)) return FALSE;
+    
+    CCDataModified(Data, Size < PrevSize ? Size : PrevSize);
+    
+    return TRUE;
 }
 
 uint32_t CCDataGetHash(CCData Data)
@@ -114,7 +182,7 @@ uint32_t CCDataGetHash(CCData Data)
     {
         if (Data->hasher) Data->hash = Data->hasher(Data);
         else if (Data->interface->optional.hash) Data->hash = Data->interface->optional.hash(Data->internal);
-        else Data->hash = CCHashMurmur32(Data);
+        else Data->hash = CCDataDefaultHash(Data);
         
         Data->mutated = FALSE;
     }
@@ -127,7 +195,7 @@ void CCDataSync(CCData Data)
     CCAssertLog(Data, "Data must not be null");
     
     if (Data->interface->optional.sync) Data->interface->optional.sync(Data->internal);
-    Data->mutated = TRUE;
+    CCDataModified(Data, 0);
 }
 
 void CCDataInvalidate(CCData Data)
@@ -135,7 +203,7 @@ void CCDataInvalidate(CCData Data)
     CCAssertLog(Data, "Data must not be null");
     
     if (Data->interface->optional.invalidate) Data->interface->optional.invalidate(Data->internal);
-    Data->mutated = TRUE;
+    CCDataModified(Data, 0);
 }
 
 void CCDataPurge(CCData Data)
@@ -159,7 +227,7 @@ void CCDataModifiedRange(CCData Data, ptrdiff_t Offset, size_t Size)
     CCAssertLog(CCDataGetHints(Data) & CCDataHintWrite, "Must have write access");
     
     if (Data->interface->optional.modifiedBuffer) Data->interface->optional.modifiedBuffer(Data->internal, Offset, Size);
-    Data->mutated = TRUE;
+    CCDataModified(Data, Offset);
 }
 
 CCBufferMap CCDataMapBuffer(CCData Data, ptrdiff_t Offset, size_t Size, CCDataHint Access)
@@ -177,7 +245,7 @@ void CCDataUnmapBuffer(CCData Data, CCBufferMap MappedBuffer)
     CCAssertLog(Data, "Data must not be null");
     
     Data->interface->unmap(Data->internal, MappedBuffer);
-    Data->mutated = MappedBuffer.hint & CCDataHintWrite;
+    if (MappedBuffer.hint & CCDataHintWrite) CCDataModified(Data, MappedBuffer.offset);
 }
 
 size_t CCDataReadBuffer(CCData Data, ptrdiff_t Offset, size_t Size, void *Buffer)
@@ -239,7 +307,7 @@ size_t CCDataWriteBuffer(CCData Data, ptrdiff_t Offset, size_t Size, const void
         Written += Map.size;
     }
     
-    Data->mutated = TRUE;
+    CCDataModified(Data, Offset);
     
     return Written;
 }
@@ -278,7 +346,7 @@ size_t CCDataCopyBuffer(CCData SrcData, ptrdiff_t SrcOffset, size_t Size, CCData
         Copied += DstMap.size;
     }
     
-    DstData->mutated = TRUE;
+    CCDataModified(DstData, DstOffset);
     
     return Copied;
 }
@@ -311,7 +379,7 @@ size_t CCDataFillBuffer(CCData Data, ptrdiff_t Offset, size_t Size, uint8_t Fill
         Filled += Map.size;
     }
     
-    Data->mutated = TRUE;
+    CCDataModified(Data, Offset);
     
     return Filled;
 }
@@ -81,6 +81,11 @@ typedef struct CCDataInfo {
     uint32_t hash;
     void *internal;
     _Bool mutated;
+    struct {
+        size_t count;
+        size_t capacity;
+        void *states;
+    } hashCheckpoints;
 } CCDataInfo;
 
 #pragma mark - Creation/Destruction
@@ -137,6 +142,10 @@ _Bool CCDataSetSize(CCData Data, size_t Size);
 
 /*!
  * @brief Get the hash of the data container.
+ * @description The hash is cached until the data is modified. When using the default hash, the
+ *              progress of the hash is also checkpointed at regular intervals, so after a modification
+ *              only the data from the start of the modified region onwards needs to be rehashed.
+ *
  * @param Data The data container to retrieve the hash for.
  * @return The hash of the data.
  */
@@ -30,6 +30,8 @@
 #include "MemoryAllocation.h"
 #include "LinkedList.h"
 #include "BitTricks.h"
+#include "DictionaryCompact.h"
+#include "DictionaryPerfectHash.h"
 
 
 typedef struct {
@@ -58,8 +60,16 @@ int CCDictionaryHintWeightCreate(CCDictionaryHint Hint, CCDictionaryHint FastHin
 }
 
 extern const CCDictionaryInterface CCDictionaryHashMapInterface;
+extern const CCDictionaryInterface CCDictionaryHashMapSwissTableInterface;
+extern const CCDictionaryInterface CCDictionaryHashMapRobinHoodInterface;
+extern const CCDictionaryInterface CCDictionaryPerfectHashInterface;
+extern const CCDictionaryInterface CCDictionaryCompactInterface;
 static CCDictionaryInternalInterfaceNode InternalInterfaces[] = {
-    { .header = { .allocator = -1 }, .data = { .node = { .prev = NULL, .next = NULL }, .interface = &CCDictionaryHashMapInterface } }
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = NULL, .next = (void*)(InternalInterfaces + 1) + offsetof(CCDictionaryInternalInterfaceNode, data) }, .interface = &CCDictionaryHashMapInterface } },
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)InternalInterfaces + offsetof(CCDictionaryInternalInterfaceNode, data), .next = (void*)(InternalInterfaces + 2) + offsetof(CCDictionaryInternalInterfaceNode, data) }, .interface = &CCDictionaryHashMapSwissTableInterface } },
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)(InternalInterfaces + 1) + offsetof(CCDictionaryInternalInterfaceNode, data), .next = (void*)(InternalInterfaces + 3) + offsetof(CCDictionaryInternalInterfaceNode, data) }, .interface = &CCDictionaryHashMapRobinHoodInterface } },
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)(InternalInterfaces + 2) + offsetof(CCDictionaryInternalInterfaceNode, data), .next = (void*)(InternalInterfaces + 4) + offsetof(CCDictionaryInternalInterfaceNode, data) }, .interface = &CCDictionaryPerfectHashInterface } },
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)(InternalInterfaces + 3) + offsetof(CCDictionaryInternalInterfaceNode, data), .next = NULL }, .interface = &CCDictionaryCompactInterface } }
 };
 static CCDictionaryInterfaceNode *Interfaces = (void*)InternalInterfaces + offsetof(CCDictionaryInternalInterfaceNode, data);
 void CCDictionaryRegisterInterface(const CCDictionaryInterface *Interface)
@@ -100,13 +110,15 @@ void CCDictionaryDeregisterInterface(const CCDictionaryInterface *Interface)
     }
 }
 
-CCDictionary CCDictionaryCreate(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, const CCDictionaryCallbacks *Callbacks)
+static const CCDictionaryInterface *CCDictionaryBestInterface(CCDictionaryHint Hint, const CCDictionaryInterface *Excluding)
 {
     int Weight = INT_MIN;
     const CCDictionaryInterface *BestInterface = NULL;
     
     for (CCLinkedListNode *Node = (CCLinkedListNode*)Interfaces; Node; Node = CCLinkedListEnumerateNext(Node))
     {
+        if (((CCDictionaryInterfaceNode*)Node)->interface == Excluding) continue;
+        
         const int NewWeight = ((CCDictionaryInterfaceNode*)Node)->interface->hintWeight(Hint);
         if (NewWeight > Weight)
         {
@@ -115,7 +127,12 @@ CCDictionary CCDictionaryCreate(CCAllocatorType Allocator, CCDictionaryHint Hint
         }
     }
     
-    return CCDictionaryCreateWithImplementation(Allocator, Hint, KeySize, ValueSize, Callbacks, BestInterface);
+    return BestInterface;
+}
+
+CCDictionary CCDictionaryCreate(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, const CCDictionaryCallbacks *Callbacks)
+{
+    return CCDictionaryCreateWithImplementation(Allocator, Hint, KeySize, ValueSize, Callbacks, CCDictionaryBestInterface(Hint, NULL));
 }
 
 static void CCDictionaryDestructor(CCDictionary Dictionary)
@@ -185,6 +202,58 @@ void CCDictionaryDestroy(CCDictionary Dictionary)
     CCFree(Dictionary);
 }
 
+static _Bool CCDictionaryMigrate(CCDictionary Dictionary, const CCDictionaryInterface *Interface, CCDictionaryHint Hint)
+{
+    void *Internal = Interface->create(Dictionary->allocator, Hint, Dictionary->keySize, Dictionary->valueSize, Dictionary->callbacks.getHash, Dictionary->callbacks.compareKeys);
+    if (!Internal) return FALSE;
+    
+    //Ownership of the keys and values is transferred, so the destructors are not called
+    CCEnumerator Enumerator;
+    CCDictionaryGetKeyEnumerator(Dictionary, &Enumerator);
+    
+    for (void *Key = CCDictionaryEnumeratorGetCurrent(&Enumerator); Key; Key = CCDictionaryEnumeratorNext(&Enumerator))
+    {
+        const CCDictionaryEntry Entry = Interface->entryForKey(Internal, Key, Dictionary->keySize, Dictionary->callbacks.getHash, Dictionary->callbacks.compareKeys, Dictionary->allocator);
+        const CCDictionaryEntry OldEntry = CCDictionaryEnumeratorGetEntry(&Enumerator);
+        
+        if (CCDictionaryEntryIsInitialized(Dictionary, OldEntry)) Interface->setEntry(Internal, Entry, CCDictionaryGetEntry(Dictionary, OldEntry), Dictionary->valueSize, Dictionary->allocator);
+    }
+    
+    Dictionary->interface->destroy(Dictionary->internal);
+    Dictionary->interface = Interface;
+    Dictionary->internal = Internal;
+    
+    return TRUE;
+}
+
+static inline void CCDictionaryPrepareInsertion(CCDictionary Dictionary)
+{
+    if ((Dictionary->interface == &CCDictionaryCompactInterface) && (Dictionary->interface->count(Dictionary->internal) >= CC_DICTIONARY_COMPACT_MAX_COUNT))
+    {
+        //Outgrown the linear lookups, so upgrade to the best hashed implementation
+        const CCDictionaryHint Hint = (CCDictionaryCompactGetHint(Dictionary->internal) & ~CCDictionaryHintSizeMask) | CCDictionaryHintSizeMedium;
+        const CCDictionaryInterface *Interface = CCDictionaryBestInterface(Hint, &CCDictionaryCompactInterface);
+        
+        if ((Interface) && (!CCDictionaryMigrate(Dictionary, Interface, Hint)))
+        {
+            CC_LOG_ERROR("Failed to upgrade dictionary: Implementation failure (%p)", Interface);
+        }
+    }
+}
+
+void CCDictionaryFreeze(CCDictionary Dictionary)
+{
+    CCAssertLog(Dictionary, "Dictionary must not be null");
+    
+    if ((Dictionary->interface != &CCDictionaryPerfectHashInterface) && (!CCDictionaryMigrate(Dictionary, &CCDictionaryPerfectHashInterface, CCDictionaryHintConstantElements)))
+    {
+        CC_LOG_ERROR("Failed to freeze dictionary: Implementation failure (%p)", &CCDictionaryPerfectHashInterface);
+        return;
+    }
+    
+    CCDictionaryPerfectHashRebuild(Dictionary->internal);
+}
+
 void CCDictionarySetEntry(CCDictionary Dictionary, CCDictionaryEntry Entry, const void *Value)
 {
     CCAssertLog(Dictionary, "Dictionary must not be null");
@@ -212,6 +281,8 @@ void CCDictionarySetValue(CCDictionary Dictionary, const void *Key, const void *
 {
     CCAssertLog(Dictionary, "Dictionary must not be null");
     
+    CCDictionaryPrepareInsertion(Dictionary);
+    
     if ((Dictionary->interface->optional.setValue) && (!Dictionary->callbacks.valueDestructor)) Dictionary->interface->optional.setValue(Dictionary->internal, Key, Value, Dictionary->keySize, Dictionary->valueSize, Dictionary->callbacks.getHash, Dictionary->callbacks.compareKeys, Dictionary->allocator);
     else
     {
@@ -239,6 +310,8 @@ CCDictionaryEntry CCDictionaryEntryForKey(CCDictionary Dictionary, const void *K
 {
     CCAssertLog(Dictionary, "Dictionary must not be null");
     
+    CCDictionaryPrepareInsertion(Dictionary);
+    
     return Dictionary->interface->entryForKey(Dictionary->internal, Key, Dictionary->keySize, Dictionary->callbacks.getHash, Dictionary->callbacks.compareKeys, Dictionary->allocator);
 }
 
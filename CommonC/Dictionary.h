@@ -119,6 +119,18 @@ CC_NEW CCDictionary CCDictionaryCreateWithImplementation(CCAllocatorType Allocat
  */
 void CCDictionaryDestroy(CCDictionary CC_DESTROY(Dictionary));
 
+/*!
+ * @brief Freeze the dictionary for lookups.
+ * @description Converts the dictionary to use the @b CCDictionaryPerfectHash implementation, building a
+ *              minimal perfect hash of its current keys. The dictionary may still be modified afterwards,
+ *              however any keys inserted will not benefit from the perfect hash until it is rebuilt.
+ *              Freezing an already frozen dictionary will rebuild its perfect hash.
+ *
+ * @warning Any entry references will be invalidated.
+ * @param Dictionary The dictionary to freeze.
+ */
+void CCDictionaryFreeze(CCDictionary Dictionary);
+
 
 #pragma mark - Insertions/Deletions
 /*!
@@ -0,0 +1,456 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "DictionaryCompact.h"
+#include "Assertion.h"
+#include "MemoryAllocation.h"
+#include "OrderedCollection.h"
+#include "Collection.h"
+#include "BitTricks.h"
+#include "Platform.h"
+#include <string.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <emmintrin.h>
+#endif
+
+
+typedef struct {
+    size_t keySize, valueSize;
+    CCDictionaryHint hint;
+    uint32_t count;
+    uint32_t top; //Entries [top, capacity) are unused
+    uint32_t capacity;
+    void *keys; //Keys, followed by the values, followed by the entry states
+} CCDictionaryCompactInternal;
+
+static int CCDictionaryCompactHintWeight(CCDictionaryHint Hint);
+static void *CCDictionaryCompactConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static void CCDictionaryCompactDestructor(CCDictionaryCompactInternal *Internal);
+static size_t CCDictionaryCompactGetCount(CCDictionaryCompactInternal *Internal);
+static _Bool CCDictionaryCompactEntryIsInitialized(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry);
+static CCDictionaryEntry CCDictionaryCompactFindKey(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static CCDictionaryEntry CCDictionaryCompactEntryForKey(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void *CCDictionaryCompactGetKey(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry);
+static void *CCDictionaryCompactGetEntry(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry);
+static void CCDictionaryCompactSetEntry(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry, const void *Value, size_t ValueSize, CCAllocatorType Allocator);
+static void CCDictionaryCompactRemoveEntry(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry, CCAllocatorType Allocator);
+static void *CCDictionaryCompactGetValue(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static void CCDictionaryCompactSetValue(CCDictionaryCompactInternal *Internal, const void *Key, const void *Value, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void CCDictionaryCompactRemoveValue(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static CCOrderedCollection CCDictionaryCompactGetKeys(CCDictionaryCompactInternal *Internal, CCAllocatorType Allocator);
+static CCOrderedCollection CCDictionaryCompactGetValues(CCDictionaryCompactInternal *Internal, CCAllocatorType Allocator);
+static void *CCDictionaryCompactEnumerator(CCDictionaryCompactInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type);
+static CCDictionaryEntry CCDictionaryCompactEnumeratorEntry(CCDictionaryCompactInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type);
+
+
+const CCDictionaryInterface CCDictionaryCompactInterface = {
+    .hintWeight = CCDictionaryCompactHintWeight,
+    .create = CCDictionaryCompactConstructor,
+    .destroy = (CCDictionaryDestructorCallback)CCDictionaryCompactDestructor,
+    .count = (CCDictionaryGetCountCallback)CCDictionaryCompactGetCount,
+    .initialized = (CCDictionaryEntryIsInitializedCallback)CCDictionaryCompactEntryIsInitialized,
+    .findKey = (CCDictionaryFindKeyCallback)CCDictionaryCompactFindKey,
+    .entryForKey = (CCDictionaryEntryForKeyCallback)CCDictionaryCompactEntryForKey,
+    .getKey = (CCDictionaryGetKeyCallback)CCDictionaryCompactGetKey,
+    .getEntry = (CCDictionaryGetEntryCallback)CCDictionaryCompactGetEntry,
+    .setEntry = (CCDictionarySetEntryCallback)CCDictionaryCompactSetEntry,
+    .removeEntry = (CCDictionaryRemoveEntryCallback)CCDictionaryCompactRemoveEntry,
+    .enumerator = (CCDictionaryEnumeratorCallback)CCDictionaryCompactEnumerator,
+    .enumeratorReference = (CCDictionaryEnumeratorEntryCallback)CCDictionaryCompactEnumeratorEntry,
+    .optional = {
+        .getValue = (CCDictionaryGetValueCallback)CCDictionaryCompactGetValue,
+        .setValue = (CCDictionarySetValueCallback)CCDictionaryCompactSetValue,
+        .removeValue = (CCDictionaryRemoveValueCallback)CCDictionaryCompactRemoveValue,
+        .keys = (CCDictionaryGetKeysCallback)CCDictionaryCompactGetKeys,
+        .values = (CCDictionaryGetValuesCallback)CCDictionaryCompactGetValues
+    }
+};
+
+const CCDictionaryInterface * const CCDictionaryCompact = &CCDictionaryCompactInterface;
+
+
+#define MIN_CAPACITY 4 //Must be a multiple of 4, so the SIMD comparisons never read past the keys
+
+#define ENTRY_USED 1
+#define ENTRY_INITIALIZED 2
+
+static int CCDictionaryCompactHintWeight(CCDictionaryHint Hint)
+{
+    //Linear lookups only remain fast while the dictionary is small, but then it outperforms the hashed implementations
+    if ((Hint & CCDictionaryHintSizeMask) != CCDictionaryHintSizeSmall) return CCDictionaryHintWeightCreate(Hint, 0, 0, CCDictionaryHintMask);
+    
+    return CCDictionaryHintWeightCreate(Hint,
+                                        CCDictionaryHintHeavyFinding
+                                        | CCDictionaryHintHeavyInserting
+                                        | CCDictionaryHintHeavyDeleting
+                                        | CCDictionaryHintHeavyEnumerating
+                                        | CCDictionaryHintConstantLength
+                                        | CCDictionaryHintConstantElements,
+                                        0,
+                                        0) + 1;
+}
+
+CCDictionaryHint CCDictionaryCompactGetHint(void *Internal)
+{
+    return ((CCDictionaryCompactInternal*)Internal)->hint;
+}
+
+static inline void *GetEntryKey(const CCDictionaryCompactInternal *Internal, size_t Index)
+{
+    return Internal->keys + (Index * Internal->keySize);
+}
+
+static inline void *GetEntryValue(const CCDictionaryCompactInternal *Internal, size_t Index)
+{
+    return Internal->keys + (Internal->capacity * Internal->keySize) + (Index * Internal->valueSize);
+}
+
+static inline uint8_t *GetEntryStates(const CCDictionaryCompactInternal *Internal)
+{
+    return Internal->keys + (Internal->capacity * (Internal->keySize + Internal->valueSize));
+}
+
+static _Bool Resize(CCDictionaryCompactInternal *Internal, size_t Capacity, CCAllocatorType Allocator)
+{
+    void *Keys = CCMalloc(Allocator, Capacity * (Internal->keySize + Internal->valueSize + 1), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Keys) return FALSE;
+    
+    uint8_t *State = Keys + (Capacity * (Internal->keySize + Internal->valueSize));
+    
+    if (Internal->keys)
+    {
+        memcpy(Keys, Internal->keys, Internal->top * Internal->keySize);
+        memcpy(Keys + (Capacity * Internal->keySize), GetEntryValue(Internal, 0), Internal->top * Internal->valueSize);
+        memcpy(State, GetEntryStates(Internal), Internal->top);
+        
+        CCFree(Internal->keys);
+    }
+    
+    memset(State + Internal->top, 0, Capacity - Internal->top);
+    
+    Internal->capacity = (uint32_t)Capacity;
+    Internal->keys = Keys;
+    
+    return TRUE;
+}
+
+static inline size_t MatchIndex(uint32_t Mask)
+{
+    return CCBitCountSet(CCBitLowestSet(Mask) - 1);
+}
+
+static size_t FindEntry(const CCDictionaryCompactInternal *Internal, const void *Key, CCComparator KeyComparator)
+{
+    const uint8_t *State = GetEntryStates(Internal);
+    
+    if (KeyComparator)
+    {
+        for (size_t Loop = 0; Loop < Internal->top; Loop++)
+        {
+            if ((State[Loop]) && (KeyComparator(Key, GetEntryKey(Internal, Loop)) == CCComparisonResultEqual)) return Loop + 1;
+        }
+    }
+    
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE2
+    else if (Internal->keySize == sizeof(uint32_t))
+    {
+        uint32_t Target;
+        memcpy(&Target, Key, sizeof(Target));
+        
+        const __m128i Match = _mm_set1_epi32(Target);
+        for (size_t Loop = 0; Loop < Internal->top; Loop += 4)
+        {
+            for (uint32_t Mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(GetEntryKey(Internal, Loop)), Match))); Mask; Mask &= Mask - 1)
+            {
+                const size_t Index = Loop + MatchIndex(Mask);
+                if ((Index < Internal->top) && (State[Index])) return Index + 1;
+            }
+        }
+    }
+    
+    else if (Internal->keySize == sizeof(uint64_t))
+    {
+        uint64_t Target;
+        memcpy(&Target, Key, sizeof(Target));
+        
+        const __m128i Match = _mm_set1_epi64x(Target);
+        for (size_t Loop = 0; Loop < Internal->top; Loop += 2)
+        {
+            //A key matches when both of its halves match
+            uint32_t Mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(GetEntryKey(Internal, Loop)), Match)));
+            for (Mask &= (Mask >> 1) & 0x5; Mask; Mask &= Mask - 1)
+            {
+                const size_t Index = Loop + (MatchIndex(Mask) / 2);
+                if ((Index < Internal->top) && (State[Index])) return Index + 1;
+            }
+        }
+    }
+#endif
+    
+    else
+    {
+        for (size_t Loop = 0; Loop < Internal->top; Loop++)
+        {
+            if ((State[Loop]) && (!memcmp(Key, GetEntryKey(Internal, Loop), Internal->keySize))) return Loop + 1;
+        }
+    }
+    
+    return 0;
+}
+
+static CCDictionaryEntry AddEntry(CCDictionaryCompactInternal *Internal, const void *Key, const void *Value, CCAllocatorType Allocator)
+{
+    uint8_t *State = GetEntryStates(Internal);
+    
+    size_t Index = Internal->top;
+    if (Internal->count < Internal->top)
+    {
+        //Reuse a removed entry
+        for (Index = 0; State[Index]; Index++);
+    }
+    
+    else if (Internal->top == Internal->capacity)
+    {
+        if (!Resize(Internal, Internal->capacity ? Internal->capacity * 2 : MIN_CAPACITY, Allocator)) return 0;
+        
+        State = GetEntryStates(Internal);
+    }
+    
+    memcpy(GetEntryKey(Internal, Index), Key, Internal->keySize);
+    if (Value) memcpy(GetEntryValue(Internal, Index), Value, Internal->valueSize);
+    State[Index] = ENTRY_USED | (Value ? ENTRY_INITIALIZED : 0);
+    
+    if (Index == Internal->top) Internal->top++;
+    Internal->count++;
+    
+    return Index + 1;
+}
+
+static void RemoveEntry(CCDictionaryCompactInternal *Internal, size_t Index)
+{
+    uint8_t *State = GetEntryStates(Internal);
+    
+    CCAssertLog(State[Index], "Entry has been removed");
+    
+    State[Index] = 0;
+    Internal->count--;
+    
+    while ((Internal->top) && (!State[Internal->top - 1])) Internal->top--;
+}
+
+#pragma mark -
+
+static void *CCDictionaryCompactConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    CCDictionaryCompactInternal *Internal = CCMalloc(Allocator, sizeof(CCDictionaryCompactInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Internal)
+    {
+        *Internal = (CCDictionaryCompactInternal){
+            .keySize = KeySize,
+            .valueSize = ValueSize,
+            .hint = Hint,
+            .count = 0,
+            .top = 0,
+            .capacity = 0,
+            .keys = NULL
+        };
+    }
+    
+    return Internal;
+}
+
+static void CCDictionaryCompactDestructor(CCDictionaryCompactInternal *Internal)
+{
+    if (Internal->keys) CC_SAFE_Free(Internal->keys);
+    
+    CC_SAFE_Free(Internal);
+}
+
+static size_t CCDictionaryCompactGetCount(CCDictionaryCompactInternal *Internal)
+{
+    return Internal->count;
+}
+
+static _Bool CCDictionaryCompactEntryIsInitialized(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry)
+{
+    CCAssertLog(GetEntryStates(Internal)[Entry - 1], "Entry has been removed");
+    
+    return GetEntryStates(Internal)[Entry - 1] & ENTRY_INITIALIZED;
+}
+
+static CCDictionaryEntry CCDictionaryCompactFindKey(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    return FindEntry(Internal, Key, KeyComparator);
+}
+
+static CCDictionaryEntry CCDictionaryCompactEntryForKey(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    CCDictionaryEntry Entry = FindEntry(Internal, Key, KeyComparator);
+    if (!Entry) Entry = AddEntry(Internal, Key, NULL, Allocator);
+    
+    return Entry;
+}
+
+static void *CCDictionaryCompactGetKey(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry)
+{
+    CCAssertLog(GetEntryStates(Internal)[Entry - 1], "Entry has been removed");
+    
+    return GetEntryKey(Internal, Entry - 1);
+}
+
+static void *CCDictionaryCompactGetEntry(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry)
+{
+    CCAssertLog(GetEntryStates(Internal)[Entry - 1], "Entry has been removed");
+    
+    return GetEntryValue(Internal, Entry - 1);
+}
+
+static void CCDictionaryCompactSetEntry(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry, const void *Value, size_t ValueSize, CCAllocatorType Allocator)
+{
+    CCAssertLog(GetEntryStates(Internal)[Entry - 1], "Entry has been removed");
+    
+    GetEntryStates(Internal)[Entry - 1] |= ENTRY_INITIALIZED;
+    memcpy(GetEntryValue(Internal, Entry - 1), Value, ValueSize);
+}
+
+static void CCDictionaryCompactRemoveEntry(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry, CCAllocatorType Allocator)
+{
+    RemoveEntry(Internal, Entry - 1);
+}
+
+static void *CCDictionaryCompactGetValue(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    const CCDictionaryEntry Entry = FindEntry(Internal, Key, KeyComparator);
+    
+    return Entry ? GetEntryValue(Internal, Entry - 1) : NULL;
+}
+
+static void CCDictionaryCompactSetValue(CCDictionaryCompactInternal *Internal, const void *Key, const void *Value, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    const CCDictionaryEntry Entry = FindEntry(Internal, Key, KeyComparator);
+    if (Entry) CCDictionaryCompactSetEntry(Internal, Entry, Value, ValueSize, Allocator);
+    else AddEntry(Internal, Key, Value, Allocator);
+}
+
+static void CCDictionaryCompactRemoveValue(CCDictionaryCompactInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    const CCDictionaryEntry Entry = FindEntry(Internal, Key, KeyComparator);
+    if (Entry) RemoveEntry(Internal, Entry - 1);
+}
+
+static CCOrderedCollection CCDictionaryCompactGetKeys(CCDictionaryCompactInternal *Internal, CCAllocatorType Allocator)
+{
+    CCOrderedCollection Keys = CCCollectionCreate(Allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Internal->keySize, NULL);
+    
+    const uint8_t *State = GetEntryStates(Internal);
+    for (size_t Loop = 0; Loop < Internal->top; Loop++)
+    {
+        if (State[Loop]) CCOrderedCollectionAppendElement(Keys, GetEntryKey(Internal, Loop));
+    }
+    
+    return Keys;
+}
+
+static CCOrderedCollection CCDictionaryCompactGetValues(CCDictionaryCompactInternal *Internal, CCAllocatorType Allocator)
+{
+    CCOrderedCollection Values = CCCollectionCreate(Allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Internal->valueSize, NULL);
+    
+    const uint8_t *State = GetEntryStates(Internal);
+    for (size_t Loop = 0; Loop < Internal->top; Loop++)
+    {
+        if (State[Loop]) CCOrderedCollectionAppendElement(Values, GetEntryValue(Internal, Loop));
+    }
+    
+    return Values;
+}
+
+static CCDictionaryEntry GetNextEntry(CCDictionaryCompactInternal *Internal, size_t Entry)
+{
+    const uint8_t *State = GetEntryStates(Internal);
+    for ( ; Entry < Internal->top; Entry++)
+    {
+        if (State[Entry]) return Entry + 1;
+    }
+    
+    return 0;
+}
+
+static CCDictionaryEntry GetPrevEntry(CCDictionaryCompactInternal *Internal, size_t Entry)
+{
+    const uint8_t *State = GetEntryStates(Internal);
+    for ( ; Entry > 0; Entry--)
+    {
+        if (State[Entry - 1]) return Entry;
+    }
+    
+    return 0;
+}
+
+static void *GetElement(CCDictionaryCompactInternal *Internal, CCDictionaryEntry Entry, CCDictionaryEnumeratorType Type)
+{
+    if (!Entry) return NULL;
+    
+    return Type == CCDictionaryEnumeratorTypeKey ? GetEntryKey(Internal, Entry - 1) : GetEntryValue(Internal, Entry - 1);
+}
+
+static void *CCDictionaryCompactEnumerator(CCDictionaryCompactInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type)
+{
+    switch (Action)
+    {
+        case CCDictionaryEnumeratorActionHead:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetNextEntry(Internal, 0);
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionTail:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetPrevEntry(Internal, Internal->top);
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionNext:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetNextEntry(Internal, Enumerator->internal.extra[0]) : 0;
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionPrevious:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetPrevEntry(Internal, Enumerator->internal.extra[0] - 1) : 0;
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionCurrent:
+            break;
+    }
+    
+    return Enumerator->internal.ptr;
+}
+
+static CCDictionaryEntry CCDictionaryCompactEnumeratorEntry(CCDictionaryCompactInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type)
+{
+    return Enumerator->internal.extra[0];
+}
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCDictionaryCompact
+ * CCDictionaryCompact is an interface for a dictionary implementation intended for dictionaries that
+ * only hold a few entries. The keys and values are stored in two contiguous arrays (in a single
+ * allocation) with no hash table, and lookups linearly scan the keys. Small fixed size keys without a
+ * key comparator are compared several at a time using SIMD.
+ *
+ * Keys are not hashed, so the key comparator alone determines equality.
+ *
+ * Once the dictionary holds CC_DICTIONARY_COMPACT_MAX_COUNT entries, @b CCDictionary will transparently
+ * migrate it to the hashed implementation best suited to its hints (ignoring the size hint), which
+ * will invalidate entry references.
+ *
+ * Fast Operations:
+ * - Lookup (while small).
+ * - Insertion.
+ * - Removal.
+ * - Enumerating of keys.
+ * - Enumerating of values.
+ */
+#ifndef CommonC_DictionaryCompact_h
+#define CommonC_DictionaryCompact_h
+
+#include <CommonC/DictionaryInterface.h>
+
+#ifndef CC_DICTIONARY_COMPACT_MAX_COUNT
+/*!
+ * @define CC_DICTIONARY_COMPACT_MAX_COUNT
+ * @abstract The number of entries at which a compact dictionary is migrated to a hashed implementation.
+ */
+#define CC_DICTIONARY_COMPACT_MAX_COUNT 16
+#endif
+
+extern const CCDictionaryInterface * const CCDictionaryCompact;
+
+/*!
+ * @brief Get the hint the compact dictionary was created with.
+ * @description This is used to pick the hashed implementation a compact dictionary is migrated to.
+ * @param Internal The internal state of a compact dictionary.
+ * @return The hint.
+ */
+CCDictionaryHint CCDictionaryCompactGetHint(void *Internal);
+
+#endif
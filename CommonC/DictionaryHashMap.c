@@ -27,9 +27,15 @@
 #include "DictionaryHashMap.h"
 #include "HashMap.h"
 #include "HashMapSeparateChainingArray.h"
+#include "HashMapSwissTable.h"
+#include "HashMapRobinHood.h"
 
 static int CCDictionaryHashMapHintWeight(CCDictionaryHint Hint);
 static void *CCDictionaryHashMapConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static int CCDictionaryHashMapSwissTableHintWeight(CCDictionaryHint Hint);
+static void *CCDictionaryHashMapSwissTableConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static int CCDictionaryHashMapRobinHoodHintWeight(CCDictionaryHint Hint);
+static void *CCDictionaryHashMapRobinHoodConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
 static CCDictionaryEntry CCDictionaryHashMapFindKey(CCHashMap Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
 static CCDictionaryEntry CCDictionaryHashMapEntryForKey(CCHashMap Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
 static void CCDictionaryHashMapSetEntry(CCHashMap Internal, CCDictionaryEntry Entry, const void *Value, size_t ValueSize, CCAllocatorType Allocator);
@@ -39,9 +45,11 @@ static void CCDictionaryHashMapSetValue(CCHashMap Internal, const void *Key, con
 static void CCDictionaryHashMapRemoveValue(CCHashMap Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
 static CCOrderedCollection CCDictionaryHashMapGetKeys(CCHashMap Internal, CCAllocatorType Allocator);
 static CCOrderedCollection CCDictionaryHashMapGetValues(CCHashMap Internal, CCAllocatorType Allocator);
+static void *CCDictionaryHashMapEnumerator(CCHashMap Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type);
+static CCDictionaryEntry CCDictionaryHashMapEnumeratorEntry(CCHashMap Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type);
 
 
-CCDictionaryInterface CCDictionaryHashMapInterface = {
+const CCDictionaryInterface CCDictionaryHashMapInterface = {
     .hintWeight = CCDictionaryHashMapHintWeight,
     .create = CCDictionaryHashMapConstructor,
     .destroy = (CCDictionaryDestructorCallback)CCHashMapDestroy,
@@ -53,8 +61,54 @@ CCDictionaryInterface CCDictionaryHashMapInterface = {
     .getEntry = (CCDictionaryGetEntryCallback)CCHashMapGetEntry,
     .setEntry = (CCDictionarySetEntryCallback)CCDictionaryHashMapSetEntry,
     .removeEntry = (CCDictionaryRemoveEntryCallback)CCDictionaryHashMapRemoveEntry,
-    .enumerator = NULL,
-    .enumeratorReference = NULL,
+    .enumerator = (CCDictionaryEnumeratorCallback)CCDictionaryHashMapEnumerator,
+    .enumeratorReference = (CCDictionaryEnumeratorEntryCallback)CCDictionaryHashMapEnumeratorEntry,
+    .optional = {
+        .getValue = (CCDictionaryGetValueCallback)CCDictionaryHashMapGetValue,
+        .setValue = (CCDictionarySetValueCallback)CCDictionaryHashMapSetValue,
+        .removeValue = (CCDictionaryRemoveValueCallback)CCDictionaryHashMapRemoveValue,
+        .keys = (CCDictionaryGetKeysCallback)CCDictionaryHashMapGetKeys,
+        .values = (CCDictionaryGetValuesCallback)CCDictionaryHashMapGetValues
+    }
+};
+
+const CCDictionaryInterface CCDictionaryHashMapSwissTableInterface = {
+    .hintWeight = CCDictionaryHashMapSwissTableHintWeight,
+    .create = CCDictionaryHashMapSwissTableConstructor,
+    .destroy = (CCDictionaryDestructorCallback)CCHashMapDestroy,
+    .count = (CCDictionaryGetCountCallback)CCHashMapGetCount,
+    .initialized = (CCDictionaryEntryIsInitializedCallback)CCHashMapEntryIsInitialized,
+    .findKey = (CCDictionaryFindKeyCallback)CCDictionaryHashMapFindKey,
+    .entryForKey = (CCDictionaryEntryForKeyCallback)CCDictionaryHashMapEntryForKey,
+    .getKey = (CCDictionaryGetKeyCallback)CCHashMapGetKey,
+    .getEntry = (CCDictionaryGetEntryCallback)CCHashMapGetEntry,
+    .setEntry = (CCDictionarySetEntryCallback)CCDictionaryHashMapSetEntry,
+    .removeEntry = (CCDictionaryRemoveEntryCallback)CCDictionaryHashMapRemoveEntry,
+    .enumerator = (CCDictionaryEnumeratorCallback)CCDictionaryHashMapEnumerator,
+    .enumeratorReference = (CCDictionaryEnumeratorEntryCallback)CCDictionaryHashMapEnumeratorEntry,
+    .optional = {
+        .getValue = (CCDictionaryGetValueCallback)CCDictionaryHashMapGetValue,
+        .setValue = (CCDictionarySetValueCallback)CCDictionaryHashMapSetValue,
+        .removeValue = (CCDictionaryRemoveValueCallback)CCDictionaryHashMapRemoveValue,
+        .keys = (CCDictionaryGetKeysCallback)CCDictionaryHashMapGetKeys,
+        .values = (CCDictionaryGetValuesCallback)CCDictionaryHashMapGetValues
+    }
+};
+
+const CCDictionaryInterface CCDictionaryHashMapRobinHoodInterface = {
+    .hintWeight = CCDictionaryHashMapRobinHoodHintWeight,
+    .create = CCDictionaryHashMapRobinHoodConstructor,
+    .destroy = (CCDictionaryDestructorCallback)CCHashMapDestroy,
+    .count = (CCDictionaryGetCountCallback)CCHashMapGetCount,
+    .initialized = (CCDictionaryEntryIsInitializedCallback)CCHashMapEntryIsInitialized,
+    .findKey = (CCDictionaryFindKeyCallback)CCDictionaryHashMapFindKey,
+    .entryForKey = (CCDictionaryEntryForKeyCallback)CCDictionaryHashMapEntryForKey,
+    .getKey = (CCDictionaryGetKeyCallback)CCHashMapGetKey,
+    .getEntry = (CCDictionaryGetEntryCallback)CCHashMapGetEntry,
+    .setEntry = (CCDictionarySetEntryCallback)CCDictionaryHashMapSetEntry,
+    .removeEntry = (CCDictionaryRemoveEntryCallback)CCDictionaryHashMapRemoveEntry,
+    .enumerator = (CCDictionaryEnumeratorCallback)CCDictionaryHashMapEnumerator,
+    .enumeratorReference = (CCDictionaryEnumeratorEntryCallback)CCDictionaryHashMapEnumeratorEntry,
     .optional = {
         .getValue = (CCDictionaryGetValueCallback)CCDictionaryHashMapGetValue,
         .setValue = (CCDictionarySetValueCallback)CCDictionaryHashMapSetValue,
@@ -65,6 +119,8 @@ CCDictionaryInterface CCDictionaryHashMapInterface = {
 };
 
 const CCDictionaryInterface * const CCDictionaryHashMap = &CCDictionaryHashMapInterface;
+const CCDictionaryInterface * const CCDictionaryHashMapSwissTable = &CCDictionaryHashMapSwissTableInterface;
+const CCDictionaryInterface * const CCDictionaryHashMapRobinHood = &CCDictionaryHashMapRobinHoodInterface;
 
 
 //Values from http://planetmath.org/sites/default/files/texpdf/33327.pdf or http://planetmath.org/goodhashtableprimes and https://opensource.apple.com/source/CF/CF-1153.18/CFBasicHash.c
@@ -82,33 +138,41 @@ static const size_t BucketSizes[40] = {
 };
 
 static int CCDictionaryHashMapHintWeight(CCDictionaryHint Hint)
+{
+    return CCDictionaryHintWeightCreate(Hint,
+                                        CCDictionaryHintHeavyInserting
+                                        | CCDictionaryHintConstantLength,
+                                        CCDictionaryHintHeavyFinding
+                                        | CCDictionaryHintHeavyDeleting
+                                        | CCDictionaryHintHeavyEnumerating,
+                                        0);
+}
+
+static int CCDictionaryHashMapSwissTableHintWeight(CCDictionaryHint Hint)
 {
     return CCDictionaryHintWeightCreate(Hint,
                                         CCDictionaryHintHeavyFinding
                                         | CCDictionaryHintHeavyInserting
-                                        | CCDictionaryHintConstantLength
-                                        | CCDictionaryHintConstantElements
-                                        | CCDictionaryHintHeavyDeleting,
-                                        CCDictionaryHintHeavyEnumerating,
+                                        | CCDictionaryHintConstantLength,
+                                        CCDictionaryHintHeavyDeleting
+                                        | CCDictionaryHintHeavyEnumerating,
                                         0);
 }
 
-static void *CCDictionaryHashMapConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+static int CCDictionaryHashMapRobinHoodHintWeight(CCDictionaryHint Hint)
+{
+    return CCDictionaryHintWeightCreate(Hint,
+                                        CCDictionaryHintHeavyFinding
+                                        | CCDictionaryHintHeavyInserting
+                                        | CCDictionaryHintHeavyDeleting
+                                        | CCDictionaryHintHeavyEnumerating
+                                        | CCDictionaryHintConstantLength,
+                                        0,
+                                        0);
+}
+
+static void *CreateHashMap(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, const CCHashMapInterface *Interface)
 {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wenum-compare"
-    _Static_assert(CCDictionaryEnumeratorActionHead == CCHashMapEnumeratorActionHead &&
-                   CCDictionaryEnumeratorActionTail == CCHashMapEnumeratorActionTail &&
-                   CCDictionaryEnumeratorActionNext == CCHashMapEnumeratorActionNext &&
-                   CCDictionaryEnumeratorActionPrevious == CCHashMapEnumeratorActionPrevious &&
-                   CCDictionaryEnumeratorActionCurrent == CCHashMapEnumeratorActionCurrent &&
-                   CCDictionaryEnumeratorTypeKey == CCHashMapEnumeratorTypeKey &&
-                   CCDictionaryEnumeratorTypeValue == CCHashMapEnumeratorTypeValue, "Must match if we're doing a passthrough");
-#pragma clang diagnostic pop
-    
-    CCDictionaryHashMapInterface.enumerator = (CCDictionaryEnumeratorCallback)CCHashMapSeparateChainingArray->enumerator;
-    CCDictionaryHashMapInterface.enumeratorReference = (CCDictionaryEnumeratorEntryCallback)CCHashMapSeparateChainingArray->enumeratorReference;
-    
     size_t BucketCount = 0;
     switch ((Hint & CCDictionaryHintSizeMask))
     {
@@ -125,7 +189,22 @@ static void *CCDictionaryHashMapConstructor(CCAllocatorType Allocator, CCDiction
             break;
     }
     
-    return CCHashMapCreate(Allocator, KeySize, ValueSize, BucketCount, Hasher, KeyComparator, CCHashMapSeparateChainingArray);
+    return CCHashMapCreate(Allocator, KeySize, ValueSize, BucketCount, Hasher, KeyComparator, Interface);
+}
+
+static void *CCDictionaryHashMapConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    return CreateHashMap(Allocator, Hint, KeySize, ValueSize, Hasher, KeyComparator, CCHashMapSeparateChainingArray);
+}
+
+static void *CCDictionaryHashMapSwissTableConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    return CreateHashMap(Allocator, Hint, KeySize, ValueSize, Hasher, KeyComparator, CCHashMapSwissTable);
+}
+
+static void *CCDictionaryHashMapRobinHoodConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    return CreateHashMap(Allocator, Hint, KeySize, ValueSize, Hasher, KeyComparator, CCHashMapRobinHood);
 }
 
 static CCDictionaryEntry CCDictionaryHashMapFindKey(CCHashMap Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
@@ -202,3 +281,24 @@ static CCOrderedCollection CCDictionaryHashMapGetValues(CCHashMap Internal, CCAl
 {
     return CCHashMapGetValues(Internal);
 }
+
+static void *CCDictionaryHashMapEnumerator(CCHashMap Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type)
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wenum-compare"
+    _Static_assert(CCDictionaryEnumeratorActionHead == CCHashMapEnumeratorActionHead &&
+                   CCDictionaryEnumeratorActionTail == CCHashMapEnumeratorActionTail &&
+                   CCDictionaryEnumeratorActionNext == CCHashMapEnumeratorActionNext &&
+                   CCDictionaryEnumeratorActionPrevious == CCHashMapEnumeratorActionPrevious &&
+                   CCDictionaryEnumeratorActionCurrent == CCHashMapEnumeratorActionCurrent &&
+                   CCDictionaryEnumeratorTypeKey == CCHashMapEnumeratorTypeKey &&
+                   CCDictionaryEnumeratorTypeValue == CCHashMapEnumeratorTypeValue, "Must match if we're doing a passthrough");
+#pragma clang diagnostic pop
+    
+    return Internal->interface->enumerator(Internal, Enumerator, (CCHashMapEnumeratorAction)Action, (CCHashMapEnumeratorType)Type);
+}
+
+static CCDictionaryEntry CCDictionaryHashMapEnumeratorEntry(CCHashMap Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type)
+{
+    return Internal->interface->enumeratorReference(Internal, Enumerator, (CCHashMapEnumeratorType)Type);
+}
@@ -32,6 +32,31 @@
  * - Insertion.
  *
  * Moderate Operations:
+ * - Removal.
+ * - Enumerating of keys.
+ * - Enumerating of values.
+ *
+ * CCDictionaryHashMapSwissTable is an interface for an open addressing (@b CCHashMapSwissTable) hashmap
+ * backed dictionary implementation. Lookups are faster than @b CCDictionaryHashMap, however removals leave
+ * behind tombstones which can only be cleared by a rehash.
+ *
+ * Fast Operations:
+ * - Lookup.
+ * - Insertion.
+ *
+ * Moderate Operations:
+ * - Removal.
+ * - Enumerating of keys.
+ * - Enumerating of values.
+ *
+ * CCDictionaryHashMapRobinHood is an interface for an open addressing (@b CCHashMapRobinHood) hashmap
+ * backed dictionary implementation. Removals never leave behind tombstones and probe lengths remain short
+ * at high load factors, making it suited to constant insertion and removal.
+ *
+ * Fast Operations:
+ * - Lookup.
+ * - Insertion.
+ * - Removal.
  * - Enumerating of keys.
  * - Enumerating of values.
  */
@@ -41,5 +66,7 @@
 #include <CommonC/DictionaryInterface.h>
 
 extern const CCDictionaryInterface * const CCDictionaryHashMap;
+extern const CCDictionaryInterface * const CCDictionaryHashMapSwissTable;
+extern const CCDictionaryInterface * const CCDictionaryHashMapRobinHood;
 
 #endif
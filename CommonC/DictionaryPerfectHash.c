@@ -0,0 +1,758 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "DictionaryPerfectHash.h"
+#include "Assertion.h"
+#include "MemoryAllocation.h"
+#include "Scratch.h"
+#include "OrderedCollection.h"
+#include "Collection.h"
+#include "BitTricks.h"
+#include "Logging.h"
+#include <string.h>
+
+
+typedef struct {
+    CCAllocatorType allocator;
+    size_t keySize, valueSize;
+    CCDictionaryKeyHasher getHash;
+    CCComparator compareKeys;
+    size_t count;
+    size_t entryCount, entryCapacity;
+    uint64_t *hashes;
+    uint8_t *state;
+    void *entries;
+    size_t rebuildThreshold;
+    struct {
+        size_t count; //Entries [0, count) are at the slot the perfect hash maps them to
+        size_t bucketCount;
+        uint32_t *seeds;
+    } table;
+    struct {
+        size_t count;
+        size_t used;
+        size_t capacity;
+        size_t *slots;
+    } overflow;
+} CCDictionaryPerfectHashInternal;
+
+static int CCDictionaryPerfectHashHintWeight(CCDictionaryHint Hint);
+static void *CCDictionaryPerfectHashConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static void CCDictionaryPerfectHashDestructor(CCDictionaryPerfectHashInternal *Internal);
+static size_t CCDictionaryPerfectHashGetCount(CCDictionaryPerfectHashInternal *Internal);
+static _Bool CCDictionaryPerfectHashEntryIsInitialized(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry);
+static CCDictionaryEntry CCDictionaryPerfectHashFindKey(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static CCDictionaryEntry CCDictionaryPerfectHashEntryForKey(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void *CCDictionaryPerfectHashGetKey(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry);
+static void *CCDictionaryPerfectHashGetEntry(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry);
+static void CCDictionaryPerfectHashSetEntry(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry, const void *Value, size_t ValueSize, CCAllocatorType Allocator);
+static void CCDictionaryPerfectHashRemoveEntry(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry, CCAllocatorType Allocator);
+static void *CCDictionaryPerfectHashGetValue(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static void CCDictionaryPerfectHashSetValue(CCDictionaryPerfectHashInternal *Internal, const void *Key, const void *Value, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void CCDictionaryPerfectHashRemoveValue(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static CCOrderedCollection CCDictionaryPerfectHashGetKeys(CCDictionaryPerfectHashInternal *Internal, CCAllocatorType Allocator);
+static CCOrderedCollection CCDictionaryPerfectHashGetValues(CCDictionaryPerfectHashInternal *Internal, CCAllocatorType Allocator);
+static void *CCDictionaryPerfectHashEnumerator(CCDictionaryPerfectHashInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type);
+static CCDictionaryEntry CCDictionaryPerfectHashEnumeratorEntry(CCDictionaryPerfectHashInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type);
+
+
+const CCDictionaryInterface CCDictionaryPerfectHashInterface = {
+    .hintWeight = CCDictionaryPerfectHashHintWeight,
+    .create = CCDictionaryPerfectHashConstructor,
+    .destroy = (CCDictionaryDestructorCallback)CCDictionaryPerfectHashDestructor,
+    .count = (CCDictionaryGetCountCallback)CCDictionaryPerfectHashGetCount,
+    .initialized = (CCDictionaryEntryIsInitializedCallback)CCDictionaryPerfectHashEntryIsInitialized,
+    .findKey = (CCDictionaryFindKeyCallback)CCDictionaryPerfectHashFindKey,
+    .entryForKey = (CCDictionaryEntryForKeyCallback)CCDictionaryPerfectHashEntryForKey,
+    .getKey = (CCDictionaryGetKeyCallback)CCDictionaryPerfectHashGetKey,
+    .getEntry = (CCDictionaryGetEntryCallback)CCDictionaryPerfectHashGetEntry,
+    .setEntry = (CCDictionarySetEntryCallback)CCDictionaryPerfectHashSetEntry,
+    .removeEntry = (CCDictionaryRemoveEntryCallback)CCDictionaryPerfectHashRemoveEntry,
+    .enumerator = (CCDictionaryEnumeratorCallback)CCDictionaryPerfectHashEnumerator,
+    .enumeratorReference = (CCDictionaryEnumeratorEntryCallback)CCDictionaryPerfectHashEnumeratorEntry,
+    .optional = {
+        .getValue = (CCDictionaryGetValueCallback)CCDictionaryPerfectHashGetValue,
+        .setValue = (CCDictionarySetValueCallback)CCDictionaryPerfectHashSetValue,
+        .removeValue = (CCDictionaryRemoveValueCallback)CCDictionaryPerfectHashRemoveValue,
+        .keys = (CCDictionaryGetKeysCallback)CCDictionaryPerfectHashGetKeys,
+        .values = (CCDictionaryGetValuesCallback)CCDictionaryPerfectHashGetValues
+    }
+};
+
+const CCDictionaryInterface * const CCDictionaryPerfectHash = &CCDictionaryPerfectHashInterface;
+
+
+#ifndef CC_DICTIONARY_PERFECT_HASH_BUCKET_LOAD
+#define CC_DICTIONARY_PERFECT_HASH_BUCKET_LOAD 4
+#endif
+
+#define MIN_REBUILD_COUNT 16
+#define MIN_OVERFLOW_CAPACITY 16
+#define MIN_ENTRY_CAPACITY 16
+
+#define ENTRY_USED 1
+#define ENTRY_INITIALIZED 2
+
+#define OVERFLOW_REMOVED SIZE_MAX
+
+static int CCDictionaryPerfectHashHintWeight(CCDictionaryHint Hint)
+{
+    return CCDictionaryHintWeightCreate(Hint,
+                                        CCDictionaryHintHeavyFinding
+                                        | CCDictionaryHintHeavyEnumerating
+                                        | CCDictionaryHintConstantLength
+                                        | CCDictionaryHintConstantElements,
+                                        CCDictionaryHintHeavyInserting
+                                        | CCDictionaryHintHeavyDeleting,
+                                        0);
+}
+
+static inline uint64_t MixHash(uint64_t Hash)
+{
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdULL;
+    Hash ^= Hash >> 33;
+    Hash *= 0xc4ceb9fe1a85ec53ULL;
+    Hash ^= Hash >> 33;
+    
+    return Hash;
+}
+
+static inline size_t BucketForHash(uint64_t Hash, size_t BucketCount)
+{
+    return ((Hash >> 32) * BucketCount) >> 32;
+}
+
+static inline size_t SlotForHash(uint64_t Hash, uint32_t Seed, size_t SlotCount)
+{
+    return ((MixHash(Hash ^ (Seed * 0x9e3779b97f4a7c15ULL)) & UINT32_MAX) * SlotCount) >> 32;
+}
+
+static uint64_t GetKeyHash(const CCDictionaryPerfectHashInternal *Internal, const void *Key)
+{
+    uintmax_t Hash = 0;
+    if (Internal->getHash) Hash = Internal->getHash(Key);
+    else memcpy(&Hash, Key, Internal->keySize < sizeof(uintmax_t) ? Internal->keySize : sizeof(uintmax_t));
+    
+    return MixHash(Hash);
+}
+
+static inline _Bool KeysEqual(const CCDictionaryPerfectHashInternal *Internal, const void *Key, const void *EntryKey)
+{
+    return Internal->compareKeys ? Internal->compareKeys(Key, EntryKey) == CCComparisonResultEqual : !memcmp(Key, EntryKey, Internal->keySize);
+}
+
+static inline void *GetEntryKey(const CCDictionaryPerfectHashInternal *Internal, size_t Index)
+{
+    return Internal->entries + (Index * (Internal->keySize + Internal->valueSize));
+}
+
+static inline void *GetEntryValue(const CCDictionaryPerfectHashInternal *Internal, size_t Index)
+{
+    return GetEntryKey(Internal, Index) + Internal->keySize;
+}
+
+static _Bool CreateEntries(CCDictionaryPerfectHashInternal *Internal, size_t Capacity, uint64_t **Hashes, uint8_t **State, void **Entries)
+{
+    const size_t StateOffset = Capacity * sizeof(uint64_t);
+    const size_t EntryOffset = (StateOffset + Capacity + 15) & ~(size_t)15;
+    void *Block = CCMalloc(Internal->allocator, EntryOffset + (Capacity * (Internal->keySize + Internal->valueSize)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Block) return FALSE;
+    
+    *Hashes = Block;
+    *State = Block + StateOffset;
+    *Entries = Block + EntryOffset;
+    
+    return TRUE;
+}
+
+static _Bool ResizeEntries(CCDictionaryPerfectHashInternal *Internal, size_t Capacity)
+{
+    uint64_t *Hashes;
+    uint8_t *State;
+    void *Entries;
+    if (!CreateEntries(Internal, Capacity, &Hashes, &State, &Entries)) return FALSE;
+    
+    if (Internal->hashes)
+    {
+        memcpy(Hashes, Internal->hashes, Internal->entryCount * sizeof(uint64_t));
+        memcpy(State, Internal->state, Internal->entryCount);
+        memcpy(Entries, Internal->entries, Internal->entryCount * (Internal->keySize + Internal->valueSize));
+        
+        CCFree(Internal->hashes);
+    }
+    
+    Internal->entryCapacity = Capacity;
+    Internal->hashes = Hashes;
+    Internal->state = State;
+    Internal->entries = Entries;
+    
+    return TRUE;
+}
+
+#pragma mark - Overflow
+
+static size_t OverflowFind(const CCDictionaryPerfectHashInternal *Internal, const void *Key, uint64_t Hash)
+{
+    if (!Internal->overflow.count) return 0;
+    
+    const size_t Mask = Internal->overflow.capacity - 1;
+    for (size_t Index = Hash & Mask; Internal->overflow.slots[Index]; Index = (Index + 1) & Mask)
+    {
+        const size_t Entry = Internal->overflow.slots[Index];
+        if ((Entry != OVERFLOW_REMOVED) && (Internal->hashes[Entry - 1] == Hash) && (KeysEqual(Internal, Key, GetEntryKey(Internal, Entry - 1)))) return Entry;
+    }
+    
+    return 0;
+}
+
+static void OverflowPlace(CCDictionaryPerfectHashInternal *Internal, size_t Entry)
+{
+    const size_t Mask = Internal->overflow.capacity - 1;
+    size_t Index = Internal->hashes[Entry] & Mask;
+    while ((Internal->overflow.slots[Index]) && (Internal->overflow.slots[Index] != OVERFLOW_REMOVED)) Index = (Index + 1) & Mask;
+    
+    if (!Internal->overflow.slots[Index]) Internal->overflow.used++;
+    
+    Internal->overflow.slots[Index] = Entry + 1;
+    Internal->overflow.count++;
+}
+
+static _Bool OverflowResize(CCDictionaryPerfectHashInternal *Internal, size_t Count)
+{
+    const size_t Capacity = CCBitNextPowerOf2(Count * 2 > MIN_OVERFLOW_CAPACITY ? Count * 2 : MIN_OVERFLOW_CAPACITY);
+    size_t *Slots = CCMalloc(Internal->allocator, sizeof(size_t) * Capacity, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Slots) return FALSE;
+    
+    memset(Slots, 0, sizeof(size_t) * Capacity);
+    
+    size_t *OldSlots = Internal->overflow.slots;
+    const size_t OldCapacity = Internal->overflow.capacity;
+    
+    Internal->overflow.count = 0;
+    Internal->overflow.used = 0;
+    Internal->overflow.capacity = Capacity;
+    Internal->overflow.slots = Slots;
+    
+    if (OldSlots)
+    {
+        for (size_t Loop = 0; Loop < OldCapacity; Loop++)
+        {
+            if ((OldSlots[Loop]) && (OldSlots[Loop] != OVERFLOW_REMOVED)) OverflowPlace(Internal, OldSlots[Loop] - 1);
+        }
+        
+        CCFree(OldSlots);
+    }
+    
+    return TRUE;
+}
+
+static _Bool OverflowInsert(CCDictionaryPerfectHashInternal *Internal, size_t Entry)
+{
+    if ((Internal->overflow.used + 1) * 2 > Internal->overflow.capacity)
+    {
+        if (!OverflowResize(Internal, Internal->overflow.count + 1)) return FALSE;
+    }
+    
+    OverflowPlace(Internal, Entry);
+    
+    return TRUE;
+}
+
+static void OverflowRemove(CCDictionaryPerfectHashInternal *Internal, size_t Entry)
+{
+    const size_t Mask = Internal->overflow.capacity - 1;
+    size_t Index = Internal->hashes[Entry] & Mask;
+    while (Internal->overflow.slots[Index] != (Entry + 1)) Index = (Index + 1) & Mask;
+    
+    Internal->overflow.slots[Index] = OVERFLOW_REMOVED;
+    Internal->overflow.count--;
+}
+
+static void OverflowReset(CCDictionaryPerfectHashInternal *Internal)
+{
+    if (Internal->overflow.slots) memset(Internal->overflow.slots, 0, sizeof(size_t) * Internal->overflow.capacity);
+    
+    Internal->overflow.count = 0;
+    Internal->overflow.used = 0;
+}
+
+#pragma mark - Perfect Hash
+
+static void Rebuild(CCDictionaryPerfectHashInternal *Internal)
+{
+    const size_t Count = Internal->count;
+    
+    if (!Count)
+    {
+        CC_SAFE_Free(Internal->table.seeds);
+        
+        Internal->entryCount = 0;
+        Internal->table.count = 0;
+        Internal->table.bucketCount = 0;
+        Internal->rebuildThreshold = MIN_REBUILD_COUNT;
+        OverflowReset(Internal);
+        
+        return;
+    }
+    
+    if (Count > UINT32_MAX)
+    {
+        CC_LOG_ERROR("Failed to build perfect hash for dictionary (%p): Too many entries (%zu)", Internal, Count);
+        return;
+    }
+    
+    const CCScratchMark Mark = CCScratchGetMark();
+    
+    const size_t BucketCount = (Count / CC_DICTIONARY_PERFECT_HASH_BUCKET_LOAD) + 1;
+    size_t *Order = CCScratchAllocate(sizeof(size_t) * Count);
+    size_t *Slots = CCScratchAllocate(sizeof(size_t) * Count);
+    size_t *BucketStart = CCScratchAllocate(sizeof(size_t) * (BucketCount + 1));
+    size_t *BucketSize = CCScratchAllocate(sizeof(size_t) * BucketCount);
+    size_t *BucketOrder = CCScratchAllocate(sizeof(size_t) * BucketCount);
+    uint8_t *Taken = CCScratchAllocate(Count);
+    uint32_t *Seeds = CCMalloc(Internal->allocator, sizeof(uint32_t) * BucketCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    uint64_t *Hashes;
+    uint8_t *State;
+    void *Entries;
+    if ((!Order) || (!Slots) || (!BucketStart) || (!BucketSize) || (!BucketOrder) || (!Taken) || (!Seeds) || (!CreateEntries(Internal, Count, &Hashes, &State, &Entries)))
+    {
+        CC_LOG_ERROR("Failed to build perfect hash for dictionary (%p): Failed to allocate memory", Internal);
+        
+        if (Seeds) CCFree(Seeds);
+        CCScratchRelease(Mark);
+        
+        return;
+    }
+    
+    //Group the entries by bucket
+    memset(BucketStart, 0, sizeof(size_t) * (BucketCount + 1));
+    for (size_t Loop = 0; Loop < Internal->entryCount; Loop++)
+    {
+        if (Internal->state[Loop]) BucketStart[BucketForHash(Internal->hashes[Loop], BucketCount) + 1]++;
+    }
+    
+    for (size_t Loop = 0; Loop < BucketCount; Loop++)
+    {
+        BucketStart[Loop + 1] += BucketStart[Loop];
+        BucketSize[Loop] = BucketStart[Loop];
+    }
+    
+    for (size_t Loop = 0; Loop < Internal->entryCount; Loop++)
+    {
+        if (Internal->state[Loop]) Order[BucketSize[BucketForHash(Internal->hashes[Loop], BucketCount)]++] = Loop;
+    }
+    
+    //Identical hashes can never be separated, so move the duplicates to the end of the bucket to be placed in the overflow
+    size_t MaxBucketSize = 0, TableCount = Count;
+    for (size_t Loop = 0; Loop < BucketCount; Loop++)
+    {
+        size_t *Bucket = Order + BucketStart[Loop], Size = BucketStart[Loop + 1] - BucketStart[Loop];
+        
+        for (size_t Index = 1; Index < Size; )
+        {
+            _Bool Duplicate = FALSE;
+            for (size_t Prev = 0; (Prev < Index) && (!Duplicate); Prev++) Duplicate = Internal->hashes[Bucket[Index]] == Internal->hashes[Bucket[Prev]];
+            
+            if (Duplicate)
+            {
+                const size_t Temp = Bucket[Index];
+                Bucket[Index] = Bucket[--Size];
+                Bucket[Size] = Temp;
+                TableCount--;
+            }
+            
+            else Index++;
+        }
+        
+        BucketSize[Loop] = Size;
+        if (Size > MaxBucketSize) MaxBucketSize = Size;
+    }
+    
+    //Place the largest buckets first, while there are the most free slots
+    size_t *SizeStart = CCScratchAllocate(sizeof(size_t) * (MaxBucketSize + 2));
+    if (!SizeStart)
+    {
+        CC_LOG_ERROR("Failed to build perfect hash for dictionary (%p): Failed to allocate memory", Internal);
+        
+        CCFree(Seeds);
+        CCFree(Hashes);
+        CCScratchRelease(Mark);
+        
+        return;
+    }
+    
+    memset(SizeStart, 0, sizeof(size_t) * (MaxBucketSize + 2));
+    for (size_t Loop = 0; Loop < BucketCount; Loop++) SizeStart[MaxBucketSize - BucketSize[Loop] + 1]++;
+    for (size_t Loop = 0; Loop <= MaxBucketSize; Loop++) SizeStart[Loop + 1] += SizeStart[Loop];
+    for (size_t Loop = 0; Loop < BucketCount; Loop++) BucketOrder[SizeStart[MaxBucketSize - BucketSize[Loop]]++] = Loop;
+    
+    memset(Taken, 0, TableCount);
+    memset(Seeds, 0, sizeof(uint32_t) * BucketCount);
+    
+    _Bool Placed = TRUE;
+    for (size_t Loop = 0; (Loop < BucketCount) && (BucketSize[BucketOrder[Loop]]) && (Placed); Loop++)
+    {
+        const size_t Bucket = BucketOrder[Loop], Start = BucketStart[Bucket], Size = BucketSize[Bucket];
+        
+        //Find a seed that displaces every key in the bucket into a free slot
+        for (uint32_t Seed = 0; ; Seed++)
+        {
+            size_t Index = 0;
+            for ( ; Index < Size; Index++)
+            {
+                const size_t Slot = SlotForHash(Internal->hashes[Order[Start + Index]], Seed, TableCount);
+                if (Taken[Slot]) break;
+                
+                Taken[Slot] = TRUE;
+                Slots[Start + Index] = Slot;
+            }
+            
+            if (Index == Size)
+            {
+                Seeds[Bucket] = Seed;
+                break;
+            }
+            
+            while (Index--) Taken[Slots[Start + Index]] = FALSE;
+            
+            if (Seed == UINT32_MAX)
+            {
+                Placed = FALSE;
+                break;
+            }
+        }
+    }
+    
+    if (!Placed)
+    {
+        CC_LOG_ERROR("Failed to build perfect hash for dictionary (%p): No displacement found", Internal);
+        
+        CCFree(Seeds);
+        CCFree(Hashes);
+        CCScratchRelease(Mark);
+        
+        return;
+    }
+    
+    //Lay out the entries in slot order, followed by the overflow
+    const size_t EntrySize = Internal->keySize + Internal->valueSize;
+    size_t OverflowIndex = TableCount;
+    for (size_t Loop = 0; Loop < BucketCount; Loop++)
+    {
+        for (size_t Index = BucketStart[Loop], End = Index + BucketSize[Loop]; Index < BucketStart[Loop + 1]; Index++)
+        {
+            const size_t Entry = Order[Index], Slot = Index < End ? Slots[Index] : OverflowIndex++;
+            
+            Hashes[Slot] = Internal->hashes[Entry];
+            State[Slot] = Internal->state[Entry];
+            memcpy(Entries + (Slot * EntrySize), GetEntryKey(Internal, Entry), EntrySize);
+        }
+    }
+    
+    CCScratchRelease(Mark);
+    
+    CC_SAFE_Free(Internal->hashes);
+    CC_SAFE_Free(Internal->table.seeds);
+    
+    Internal->entryCount = Count;
+    Internal->entryCapacity = Count;
+    Internal->hashes = Hashes;
+    Internal->state = State;
+    Internal->entries = Entries;
+    Internal->table.count = TableCount;
+    Internal->table.bucketCount = BucketCount;
+    Internal->table.seeds = Seeds;
+    
+    OverflowReset(Internal);
+    if (TableCount != Count)
+    {
+        if ((Internal->overflow.capacity < (Count - TableCount) * 2) && (!OverflowResize(Internal, Count - TableCount)))
+        {
+            CC_LOG_ERROR("Failed to build perfect hash for dictionary (%p): Failed to allocate memory", Internal);
+        }
+        
+        for (size_t Loop = TableCount; Loop < Count; Loop++) OverflowPlace(Internal, Loop);
+    }
+    
+    Internal->rebuildThreshold = (Count - TableCount) + (Count > MIN_REBUILD_COUNT ? Count : MIN_REBUILD_COUNT);
+}
+
+void CCDictionaryPerfectHashRebuild(void *Internal)
+{
+    Rebuild(Internal);
+}
+
+static size_t FindEntry(const CCDictionaryPerfectHashInternal *Internal, const void *Key, uint64_t Hash)
+{
+    if (Internal->table.count)
+    {
+        const size_t Slot = SlotForHash(Hash, Internal->table.seeds[BucketForHash(Hash, Internal->table.bucketCount)], Internal->table.count);
+        
+        if ((Internal->state[Slot]) && (KeysEqual(Internal, Key, GetEntryKey(Internal, Slot)))) return Slot + 1;
+    }
+    
+    return OverflowFind(Internal, Key, Hash);
+}
+
+static CCDictionaryEntry AddEntry(CCDictionaryPerfectHashInternal *Internal, const void *Key, uint64_t Hash, const void *Value)
+{
+    if (Internal->overflow.count >= Internal->rebuildThreshold) Rebuild(Internal);
+    
+    if (Internal->entryCount == Internal->entryCapacity)
+    {
+        if (!ResizeEntries(Internal, Internal->entryCapacity ? Internal->entryCapacity * 2 : MIN_ENTRY_CAPACITY)) return 0;
+    }
+    
+    const size_t Entry = Internal->entryCount;
+    Internal->hashes[Entry] = Hash;
+    
+    if (!OverflowInsert(Internal, Entry)) return 0;
+    
+    memcpy(GetEntryKey(Internal, Entry), Key, Internal->keySize);
+    if (Value) memcpy(GetEntryValue(Internal, Entry), Value, Internal->valueSize);
+    Internal->state[Entry] = ENTRY_USED | (Value ? ENTRY_INITIALIZED : 0);
+    
+    Internal->entryCount++;
+    Internal->count++;
+    
+    return Entry + 1;
+}
+
+static void RemoveEntry(CCDictionaryPerfectHashInternal *Internal, size_t Entry)
+{
+    CCAssertLog(Internal->state[Entry], "Entry has been removed");
+    
+    if (Entry >= Internal->table.count) OverflowRemove(Internal, Entry);
+    
+    Internal->state[Entry] = 0;
+    Internal->count--;
+    
+    while ((Internal->entryCount > Internal->table.count) && (!Internal->state[Internal->entryCount - 1])) Internal->entryCount--;
+}
+
+#pragma mark -
+
+static void *CCDictionaryPerfectHashConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    CCDictionaryPerfectHashInternal *Internal = CCMalloc(Allocator, sizeof(CCDictionaryPerfectHashInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Internal)
+    {
+        *Internal = (CCDictionaryPerfectHashInternal){
+            .allocator = Allocator,
+            .keySize = KeySize,
+            .valueSize = ValueSize,
+            .getHash = Hasher,
+            .compareKeys = KeyComparator,
+            .count = 0,
+            .entryCount = 0,
+            .entryCapacity = 0,
+            .hashes = NULL,
+            .state = NULL,
+            .entries = NULL,
+            .rebuildThreshold = MIN_REBUILD_COUNT,
+            .table = { .count = 0, .bucketCount = 0, .seeds = NULL },
+            .overflow = { .count = 0, .used = 0, .capacity = 0, .slots = NULL }
+        };
+    }
+    
+    return Internal;
+}
+
+static void CCDictionaryPerfectHashDestructor(CCDictionaryPerfectHashInternal *Internal)
+{
+    if (Internal->hashes) CC_SAFE_Free(Internal->hashes);
+    if (Internal->table.seeds) CC_SAFE_Free(Internal->table.seeds);
+    if (Internal->overflow.slots) CC_SAFE_Free(Internal->overflow.slots);
+    
+    CC_SAFE_Free(Internal);
+}
+
+static size_t CCDictionaryPerfectHashGetCount(CCDictionaryPerfectHashInternal *Internal)
+{
+    return Internal->count;
+}
+
+static _Bool CCDictionaryPerfectHashEntryIsInitialized(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry)
+{
+    CCAssertLog(Internal->state[Entry - 1], "Entry has been removed");
+    
+    return Internal->state[Entry - 1] & ENTRY_INITIALIZED;
+}
+
+static CCDictionaryEntry CCDictionaryPerfectHashFindKey(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    return FindEntry(Internal, Key, GetKeyHash(Internal, Key));
+}
+
+static CCDictionaryEntry CCDictionaryPerfectHashEntryForKey(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    const uint64_t Hash = GetKeyHash(Internal, Key);
+    
+    CCDictionaryEntry Entry = FindEntry(Internal, Key, Hash);
+    if (!Entry) Entry = AddEntry(Internal, Key, Hash, NULL);
+    
+    return Entry;
+}
+
+static void *CCDictionaryPerfectHashGetKey(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry)
+{
+    CCAssertLog(Internal->state[Entry - 1], "Entry has been removed");
+    
+    return GetEntryKey(Internal, Entry - 1);
+}
+
+static void *CCDictionaryPerfectHashGetEntry(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry)
+{
+    CCAssertLog(Internal->state[Entry - 1], "Entry has been removed");
+    
+    return GetEntryValue(Internal, Entry - 1);
+}
+
+static void CCDictionaryPerfectHashSetEntry(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry, const void *Value, size_t ValueSize, CCAllocatorType Allocator)
+{
+    CCAssertLog(Internal->state[Entry - 1], "Entry has been removed");
+    
+    Internal->state[Entry - 1] |= ENTRY_INITIALIZED;
+    memcpy(GetEntryValue(Internal, Entry - 1), Value, ValueSize);
+}
+
+static void CCDictionaryPerfectHashRemoveEntry(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry, CCAllocatorType Allocator)
+{
+    RemoveEntry(Internal, Entry - 1);
+}
+
+static void *CCDictionaryPerfectHashGetValue(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    const CCDictionaryEntry Entry = FindEntry(Internal, Key, GetKeyHash(Internal, Key));
+    
+    return Entry ? GetEntryValue(Internal, Entry - 1) : NULL;
+}
+
+static void CCDictionaryPerfectHashSetValue(CCDictionaryPerfectHashInternal *Internal, const void *Key, const void *Value, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    const uint64_t Hash = GetKeyHash(Internal, Key);
+    
+    const CCDictionaryEntry Entry = FindEntry(Internal, Key, Hash);
+    if (Entry) CCDictionaryPerfectHashSetEntry(Internal, Entry, Value, ValueSize, Allocator);
+    else AddEntry(Internal, Key, Hash, Value);
+}
+
+static void CCDictionaryPerfectHashRemoveValue(CCDictionaryPerfectHashInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    const CCDictionaryEntry Entry = FindEntry(Internal, Key, GetKeyHash(Internal, Key));
+    if (Entry) RemoveEntry(Internal, Entry - 1);
+}
+
+static CCOrderedCollection CCDictionaryPerfectHashGetKeys(CCDictionaryPerfectHashInternal *Internal, CCAllocatorType Allocator)
+{
+    CCOrderedCollection Keys = CCCollectionCreate(Allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Internal->keySize, NULL);
+    
+    for (size_t Loop = 0; Loop < Internal->entryCount; Loop++)
+    {
+        if (Internal->state[Loop]) CCOrderedCollectionAppendElement(Keys, GetEntryKey(Internal, Loop));
+    }
+    
+    return Keys;
+}
+
+static CCOrderedCollection CCDictionaryPerfectHashGetValues(CCDictionaryPerfectHashInternal *Internal, CCAllocatorType Allocator)
+{
+    CCOrderedCollection Values = CCCollectionCreate(Allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Internal->valueSize, NULL);
+    
+    for (size_t Loop = 0; Loop < Internal->entryCount; Loop++)
+    {
+        if (Internal->state[Loop]) CCOrderedCollectionAppendElement(Values, GetEntryValue(Internal, Loop));
+    }
+    
+    return Values;
+}
+
+static CCDictionaryEntry GetNextEntry(CCDictionaryPerfectHashInternal *Internal, size_t Entry)
+{
+    for ( ; Entry < Internal->entryCount; Entry++)
+    {
+        if (Internal->state[Entry]) return Entry + 1;
+    }
+    
+    return 0;
+}
+
+static CCDictionaryEntry GetPrevEntry(CCDictionaryPerfectHashInternal *Internal, size_t Entry)
+{
+    for ( ; Entry > 0; Entry--)
+    {
+        if (Internal->state[Entry - 1]) return Entry;
+    }
+    
+    return 0;
+}
+
+static void *GetElement(CCDictionaryPerfectHashInternal *Internal, CCDictionaryEntry Entry, CCDictionaryEnumeratorType Type)
+{
+    if (!Entry) return NULL;
+    
+    return Type == CCDictionaryEnumeratorTypeKey ? GetEntryKey(Internal, Entry - 1) : GetEntryValue(Internal, Entry - 1);
+}
+
+static void *CCDictionaryPerfectHashEnumerator(CCDictionaryPerfectHashInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type)
+{
+    switch (Action)
+    {
+        case CCDictionaryEnumeratorActionHead:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetNextEntry(Internal, 0);
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionTail:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetPrevEntry(Internal, Internal->entryCount);
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionNext:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetNextEntry(Internal, Enumerator->internal.extra[0]) : 0;
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionPrevious:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetPrevEntry(Internal, Enumerator->internal.extra[0] - 1) : 0;
+            Enumerator->internal.ptr = GetElement(Internal, Enumerator->internal.extra[0], Type);
+            break;
+            
+        case CCDictionaryEnumeratorActionCurrent:
+            break;
+    }
+    
+    return Enumerator->internal.ptr;
+}
+
+static CCDictionaryEntry CCDictionaryPerfectHashEnumeratorEntry(CCDictionaryPerfectHashInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type)
+{
+    return Enumerator->internal.extra[0];
+}
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCDictionaryPerfectHash
+ * CCDictionaryPerfectHash is an interface for a dictionary implementation backed by a minimal perfect
+ * hash (using hash and displace). Every key that was present when the perfect hash was built maps to a
+ * unique slot, so a lookup only needs to check a single slot and never probes.
+ *
+ * The perfect hash is built by @b CCDictionaryFreeze. Keys inserted afterwards are kept in a separate
+ * overflow table, which is merged into the perfect hash when it has grown as large as the perfect hash.
+ * Any rebuild will invalidate entry references. Keys whose hashes are identical cannot be separated by
+ * the perfect hash, so they will always remain in the overflow table.
+ *
+ * Fast Operations:
+ * - Lookup.
+ * - Enumerating of keys.
+ * - Enumerating of values.
+ *
+ * Moderate Operations:
+ * - Insertion.
+ * - Removal.
+ */
+#ifndef CommonC_DictionaryPerfectHash_h
+#define CommonC_DictionaryPerfectHash_h
+
+#include <CommonC/DictionaryInterface.h>
+
+extern const CCDictionaryInterface * const CCDictionaryPerfectHash;
+
+/*!
+ * @brief Rebuild the perfect hash to include all keys currently in the dictionary.
+ * @description This is used by @b CCDictionaryFreeze, and will invalidate entry references.
+ * @param Internal The internal state of a perfect hash dictionary.
+ */
+void CCDictionaryPerfectHashRebuild(void *Internal);
+
+#endif
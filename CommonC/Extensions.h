@@ -35,6 +35,7 @@
  CC_FORMAT_SCANF(fmt, args): Treats the function usage as if the format and arguments followed that of scanf's, and so will give warnings appropriately. fmt = index of the format string, args = the index of the arguments
  CC_PURE_FUNCTION: Marks the function as having no side effects. Can help the compiler with optimization.
  CC_CONSTANT_FUNCTION: A more strict version of CC_PURE_FUNCTION, it does not allow pointer arguments or global variable access.
+ CC_PREFETCH(ptr): Hints that the memory at ptr will soon be read, so it can start being loaded into the cache.
  
  Optional usage:
  CC_SUPPORT_BLOCKS(...): Allows for code specific to blocks to be used.
@@ -104,6 +105,10 @@
 #define CC_UNLIKELY(e) __builtin_expect(!!(e), 0)
 #endif
 
+#if __has_builtin(__builtin_prefetch) || CC_COMPILER_GCC
+#define CC_PREFETCH(ptr) __builtin_prefetch(ptr)
+#endif
+
 #if __has_attribute(packed)
 #define CC_PACKED __attribute__((packed))
 #endif
@@ -132,6 +137,10 @@
 #define CC_NO_INLINE
 #endif
 
+#ifndef CC_PREFETCH
+#define CC_PREFETCH(ptr) (void)(ptr)
+#endif
+
 #ifndef CC_DEPRECATED
 #define CC_DEPRECATED
 #endif
@@ -157,11 +166,11 @@
 #endif
 
 #ifndef CC_LIKELY
-#define CC_LIKELY(e) (!!(e) == 1)
+#define CC_LIKELY(e) (!!(e))
 #endif
 
 #ifndef CC_UNLIKELY
-#define CC_UNLIKELY(e) (!!(e) == 0)
+#define CC_UNLIKELY(e) (!!(e))
 #endif
 
 #ifndef CC_PACKED
@@ -26,7 +26,15 @@
 #define CC_QUICK_COMPILE
 #include "Hash.h"
 #include "Extensions.h"
+#include "Assertion.h"
 #include <stdint.h>
+#include <string.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX2
+#include <immintrin.h>
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <emmintrin.h>
+#endif
 
 uint32_t CCHashJenkins32(CCData Data)
 {
@@ -70,119 +78,639 @@ Finalizer:
     return Hash;
 }
 
+uint32_t CCHashJenkins32Bytes(const void *Bytes, size_t Size)
+{
+    uint32_t Hash = 0;
+    
+    for (size_t Index = 0; Index < Size; Index++)
+    {
+        Hash += ((const uint8_t*)Bytes)[Index];
+        Hash += (Hash << 10);
+        Hash ^= (Hash >> 6);
+    }
+    
+    Hash += (Hash << 3);
+    Hash ^= (Hash >> 11);
+    Hash += (Hash << 15);
+    
+    return Hash;
+}
+
 static CC_FORCE_INLINE uint32_t CCHashROL32(uint32_t x, uint32_t y)
 {
     return ((x << y) | (x >> (32 - y)));
 }
 
+typedef void (*CCHashUpdate)(void *State, const void *Bytes, size_t Size);
+
+static void CCHashUpdateWithData(CCData Data, CCHashUpdate Update, void *State)
+{
+    size_t PreferredMapSize = CCDataGetPreferredMapSize(Data);
+    if (!PreferredMapSize) PreferredMapSize = SIZE_MAX;
+    
+    for (size_t Read = 0, Size = CCDataGetSize(Data); Read < Size; )
+    {
+        CCBufferMap Map = CCDataMapBuffer(Data, Read, (Size - Read) < PreferredMapSize ? (Size - Read) : PreferredMapSize, CCDataHintRead);
+        
+        Update(State, Map.ptr, Map.size);
+        
+        CCDataUnmapBuffer(Data, Map);
+        
+        if (!Map.size) break;
+        
+        Read += Map.size;
+    }
+}
+
 uint32_t CCHashMurmur32(CCData Data)
 {
-    const uint32_t c1 = 0xcc9e2d51;
-    const uint32_t c2 = 0x1b873593;
-    const uint32_t r1 = 15;
-    const uint32_t r2 = 13;
-    const uint32_t m = 5;
-    const uint32_t n = 0xe6546b64;
+    return CCHashMurmur32WithSeed(Data, 0);
+}
+
+uint32_t CCHashMurmur32WithSeed(CCData Data, uint32_t Seed)
+{
+    CCHashMurmur32State State;
+    CCHashMurmur32Init(&State, Seed);
+    CCHashUpdateWithData(Data, (CCHashUpdate)CCHashMurmur32Update, &State);
     
-    uint32_t Seed = 0;
-    uint32_t Hash = Seed;
+    return CCHashMurmur32Final(&State);
+}
+
+static CC_FORCE_INLINE uint32_t CCHashMurmur32Block(uint32_t Hash, uint32_t k)
+{
+    k *= 0xcc9e2d51;
+    k = CCHashROL32(k, 15);
+    k *= 0x1b873593;
     
-    size_t Read = 0;
-    size_t PreferredMapSize = (CCDataGetPreferredMapSize(Data) / sizeof(uint32_t)) * sizeof(uint32_t), Size = CCDataGetSize(Data);
-    if (!PreferredMapSize) PreferredMapSize = 4;
+    Hash ^= k;
     
-    for (size_t Loop = 0, Count = ((Size / sizeof(uint32_t)) * sizeof(uint32_t)) / PreferredMapSize; Loop < Count; Loop++)
+    return CCHashROL32(Hash, 13) * 5 + 0xe6546b64;
+}
+
+static CC_FORCE_INLINE uint32_t CCHashMurmur32Finalize(uint32_t Hash, const uint8_t *Tail, size_t Size)
+{
+    uint32_t k = 0;
+    switch (Size % sizeof(uint32_t))
     {
-        CCBufferMap Map = CCDataMapBuffer(Data, Loop * PreferredMapSize, PreferredMapSize, CCDataHintRead);
-        
-        size_t BlockCount = Map.size / sizeof(uint32_t);
-        for (size_t Index = 0; Index < BlockCount; Index++)
-        {
-            uint32_t k = ((uint32_t*)Map.ptr)[Index];
-            k *= c1;
-            k = CCHashROL32(k, r1);
-            k *= c2;
+        case 3:
+            k ^= Tail[2] << 16;
+        case 2:
+            k ^= Tail[1] << 8;
+        case 1:
+            k ^= Tail[0];
+            
+            k *= 0xcc9e2d51;
+            k = CCHashROL32(k, 15);
+            k *= 0x1b873593;
             
             Hash ^= k;
-            Hash = CCHashROL32(Hash, r2) * m + n;
-        }
+            break;
+    }
+    
+    Hash ^= Size;
+    Hash ^= (Hash >> 16);
+    Hash *= 0x85ebca6b;
+    Hash ^= (Hash >> 13);
+    Hash *= 0xc2b2ae35;
+    Hash ^= (Hash >> 16);
+    
+    return Hash;
+}
+
+uint32_t CCHashMurmur32Bytes(const void *Bytes, size_t Size, uint32_t Seed)
+{
+    uint32_t Hash = Seed;
+    
+    const size_t BlockCount = Size / sizeof(uint32_t);
+    for (size_t Index = 0; Index < BlockCount; Index++)
+    {
+        uint32_t k;
+        memcpy(&k, Bytes + (Index * sizeof(uint32_t)), sizeof(k));
+        
+        Hash = CCHashMurmur32Block(Hash, k);
+    }
+    
+    return CCHashMurmur32Finalize(Hash, Bytes + (BlockCount * sizeof(uint32_t)), Size);
+}
+
+void CCHashMurmur32Init(CCHashMurmur32State *State, uint32_t Seed)
+{
+    CCAssertLog(State, "State must not be null");
+    
+    *State = (CCHashMurmur32State){ .hash = Seed, .size = 0 };
+}
+
+void CCHashMurmur32Update(CCHashMurmur32State *State, const void *Bytes, size_t Size)
+{
+    CCAssertLog(State, "State must not be null");
+    CCAssertLog(Bytes || !Size, "Bytes must not be null");
+    
+    size_t Pending = State->size % sizeof(uint32_t);
+    State->size += Size;
+    
+    if (Pending)
+    {
+        const size_t Fill = (sizeof(uint32_t) - Pending) < Size ? (sizeof(uint32_t) - Pending) : Size;
+        memcpy(State->tail + Pending, Bytes, Fill);
+        
+        Bytes += Fill;
+        Size -= Fill;
+        
+        if ((Pending + Fill) != sizeof(uint32_t)) return;
+        
+        uint32_t k;
+        memcpy(&k, State->tail, sizeof(k));
+        
+        State->hash = CCHashMurmur32Block(State->hash, k);
+    }
+    
+    const size_t BlockCount = Size / sizeof(uint32_t);
+    for (size_t Index = 0; Index < BlockCount; Index++)
+    {
+        uint32_t k;
+        memcpy(&k, Bytes + (Index * sizeof(uint32_t)), sizeof(k));
         
-        size_t Leftover = Map.size - (BlockCount * sizeof(uint32_t));
-        if (Leftover)
+        State->hash = CCHashMurmur32Block(State->hash, k);
+    }
+    
+    memcpy(State->tail, Bytes + (BlockCount * sizeof(uint32_t)), Size - (BlockCount * sizeof(uint32_t)));
+}
+
+uint32_t CCHashMurmur32Final(const CCHashMurmur32State *State)
+{
+    CCAssertLog(State, "State must not be null");
+    
+    return CCHashMurmur32Finalize(State->hash, State->tail, State->size);
+}
+
+#pragma mark - XXH3
+
+#define CC_HASH_XXH3_STRIPE_SIZE 64
+#define CC_HASH_XXH3_SECRET_SIZE 192
+#define CC_HASH_XXH3_SECRET_MIN_SIZE 136
+#define CC_HASH_XXH3_SECRET_CONSUME_RATE 8
+#define CC_HASH_XXH3_STRIPES_PER_BLOCK ((CC_HASH_XXH3_SECRET_SIZE - CC_HASH_XXH3_STRIPE_SIZE) / CC_HASH_XXH3_SECRET_CONSUME_RATE)
+#define CC_HASH_XXH3_MIDSIZE_MAX 240
+#define CC_HASH_XXH3_MIDSIZE_START_OFFSET 3
+#define CC_HASH_XXH3_MIDSIZE_LAST_OFFSET 17
+#define CC_HASH_XXH3_LAST_ACCUMULATOR_OFFSET 7
+#define CC_HASH_XXH3_MERGE_ACCUMULATORS_OFFSET 11
+
+static const uint32_t CCHashXXH3Prime32[3] = { 0x9e3779b1, 0x85ebca77, 0xc2b2ae3d };
+static const uint64_t CCHashXXH3Prime64[5] = { 0x9e3779b185ebca87, 0xc2b2ae3d27d4eb4f, 0x165667b19e3779f9, 0x85ebca77c2b2ae63, 0x27d4eb2f165667c5 };
+static const uint64_t CCHashXXH3PrimeMX1 = 0x165667919e3779f9, CCHashXXH3PrimeMX2 = 0x9fb21c651e98df25;
+
+static _Alignas(64) const uint8_t CCHashXXH3DefaultSecret[CC_HASH_XXH3_SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+static CC_FORCE_INLINE uint32_t CCHashReadLittle32(const uint8_t *Bytes)
+{
+    uint32_t Value;
+    memcpy(&Value, Bytes, sizeof(Value));
+    
+#if CC_HARDWARE_ENDIAN_BIG
+    Value = __builtin_bswap32(Value);
+#endif
+    
+    return Value;
+}
+
+static CC_FORCE_INLINE uint64_t CCHashReadLittle64(const uint8_t *Bytes)
+{
+    uint64_t Value;
+    memcpy(&Value, Bytes, sizeof(Value));
+    
+#if CC_HARDWARE_ENDIAN_BIG
+    Value = __builtin_bswap64(Value);
+#endif
+    
+    return Value;
+}
+
+static CC_FORCE_INLINE void CCHashWriteLittle64(uint8_t *Bytes, uint64_t Value)
+{
+#if CC_HARDWARE_ENDIAN_BIG
+    Value = __builtin_bswap64(Value);
+#endif
+    
+    memcpy(Bytes, &Value, sizeof(Value));
+}
+
+static CC_FORCE_INLINE uint64_t CCHashROL64(uint64_t x, uint64_t y)
+{
+    return ((x << y) | (x >> (64 - y)));
+}
+
+static CC_FORCE_INLINE uint64_t CCHashXXH3MultiplyFold64(uint64_t a, uint64_t b)
+{
+#if __SIZEOF_INT128__
+    const __uint128_t Product = (__uint128_t)a * b;
+    
+    return (uint64_t)Product ^ (uint64_t)(Product >> 64);
+#else
+    const uint64_t LoLo = (a & UINT32_MAX) * (b & UINT32_MAX);
+    const uint64_t HiLo = (a >> 32) * (b & UINT32_MAX);
+    const uint64_t LoHi = (a & UINT32_MAX) * (b >> 32);
+    const uint64_t HiHi = (a >> 32) * (b >> 32);
+    const uint64_t Cross = (LoLo >> 32) + (HiLo & UINT32_MAX) + LoHi;
+    
+    return ((Cross << 32) | (LoLo & UINT32_MAX)) ^ ((HiLo >> 32) + (Cross >> 32) + HiHi);
+#endif
+}
+
+static CC_FORCE_INLINE uint64_t CCHashXXH64Avalanche(uint64_t Hash)
+{
+    Hash ^= Hash >> 33;
+    Hash *= CCHashXXH3Prime64[1];
+    Hash ^= Hash >> 29;
+    Hash *= CCHashXXH3Prime64[2];
+    Hash ^= Hash >> 32;
+    
+    return Hash;
+}
+
+static CC_FORCE_INLINE uint64_t CCHashXXH3Avalanche(uint64_t Hash)
+{
+    Hash ^= Hash >> 37;
+    Hash *= CCHashXXH3PrimeMX1;
+    Hash ^= Hash >> 32;
+    
+    return Hash;
+}
+
+static CC_FORCE_INLINE uint64_t CCHashXXH3RRMXMX(uint64_t Hash, size_t Size)
+{
+    Hash ^= CCHashROL64(Hash, 49) ^ CCHashROL64(Hash, 24);
+    Hash *= CCHashXXH3PrimeMX2;
+    Hash ^= (Hash >> 35) + Size;
+    Hash *= CCHashXXH3PrimeMX2;
+    
+    return Hash ^ (Hash >> 28);
+}
+
+static CC_FORCE_INLINE uint64_t CCHashXXH3Mix16(const uint8_t *Bytes, const uint8_t *Secret, uint64_t Seed)
+{
+    return CCHashXXH3MultiplyFold64(CCHashReadLittle64(Bytes) ^ (CCHashReadLittle64(Secret) + Seed), CCHashReadLittle64(Bytes + 8) ^ (CCHashReadLittle64(Secret + 8) - Seed));
+}
+
+static uint64_t CCHashXXH3Short(const uint8_t *Bytes, size_t Size, const uint8_t *Secret, uint64_t Seed)
+{
+    if (Size > 8)
+    {
+        const uint64_t Lo = CCHashReadLittle64(Bytes) ^ ((CCHashReadLittle64(Secret + 24) ^ CCHashReadLittle64(Secret + 32)) + Seed);
+        const uint64_t Hi = CCHashReadLittle64(Bytes + Size - 8) ^ ((CCHashReadLittle64(Secret + 40) ^ CCHashReadLittle64(Secret + 48)) - Seed);
+        
+        return CCHashXXH3Avalanche(Size + __builtin_bswap64(Lo) + Hi + CCHashXXH3MultiplyFold64(Lo, Hi));
+    }
+    
+    else if (Size >= 4)
+    {
+        Seed ^= (uint64_t)__builtin_bswap32((uint32_t)Seed) << 32;
+        
+        const uint64_t Input = CCHashReadLittle32(Bytes + Size - 4) + ((uint64_t)CCHashReadLittle32(Bytes) << 32);
+        
+        return CCHashXXH3RRMXMX(Input ^ ((CCHashReadLittle64(Secret + 8) ^ CCHashReadLittle64(Secret + 16)) - Seed), Size);
+    }
+    
+    else if (Size)
+    {
+        const uint32_t Combined = ((uint32_t)Bytes[0] << 16) | ((uint32_t)Bytes[Size >> 1] << 24) | (uint32_t)Bytes[Size - 1] | ((uint32_t)Size << 8);
+        
+        return CCHashXXH64Avalanche((uint64_t)Combined ^ ((CCHashReadLittle32(Secret) ^ CCHashReadLittle32(Secret + 4)) + Seed));
+    }
+    
+    return CCHashXXH64Avalanche(Seed ^ CCHashReadLittle64(Secret + 56) ^ CCHashReadLittle64(Secret + 64));
+}
+
+static uint64_t CCHashXXH3Medium(const uint8_t *Bytes, size_t Size, const uint8_t *Secret, uint64_t Seed)
+{
+    uint64_t Hash = Size * CCHashXXH3Prime64[0];
+    
+    if (Size <= 128)
+    {
+        if (Size > 32)
         {
-            const uint8_t *Tail = Map.ptr + (BlockCount * sizeof(uint32_t));
-            uint32_t k = 0;
-            switch (Leftover)
+            if (Size > 64)
             {
-                case 3:
-                    k ^= Tail[2] << 16;
-                case 2:
-                    k ^= Tail[1] << 8;
-                case 1:
-                    k ^= Tail[0];
-                    
-                    k *= c1;
-                    k = CCHashROL32(k, r1);
-                    k *= c2;
-                    
-                    Hash ^= k;
-                    break;
+                if (Size > 96)
+                {
+                    Hash += CCHashXXH3Mix16(Bytes + 48, Secret + 96, Seed);
+                    Hash += CCHashXXH3Mix16(Bytes + Size - 64, Secret + 112, Seed);
+                }
+                
+                Hash += CCHashXXH3Mix16(Bytes + 32, Secret + 64, Seed);
+                Hash += CCHashXXH3Mix16(Bytes + Size - 48, Secret + 80, Seed);
             }
+            
+            Hash += CCHashXXH3Mix16(Bytes + 16, Secret + 32, Seed);
+            Hash += CCHashXXH3Mix16(Bytes + Size - 32, Secret + 48, Seed);
         }
         
-        CCDataUnmapBuffer(Data, Map);
+        Hash += CCHashXXH3Mix16(Bytes, Secret, Seed);
+        Hash += CCHashXXH3Mix16(Bytes + Size - 16, Secret + 16, Seed);
         
-        Read += Map.size;
-        if (Map.size != PreferredMapSize) goto Finalizer;
+        return CCHashXXH3Avalanche(Hash);
     }
     
-    CCBufferMap Map = CCDataMapBuffer(Data, Read, Size - Read, CCDataHintRead);
+    for (size_t Loop = 0; Loop < 8; Loop++) Hash += CCHashXXH3Mix16(Bytes + (16 * Loop), Secret + (16 * Loop), Seed);
     
-    size_t BlockCount = Map.size / sizeof(uint32_t);
-    for (size_t Index = 0; Index < BlockCount; Index++)
+    Hash = CCHashXXH3Avalanche(Hash);
+    
+    for (size_t Loop = 8, Count = Size / 16; Loop < Count; Loop++) Hash += CCHashXXH3Mix16(Bytes + (16 * Loop), Secret + (16 * (Loop - 8)) + CC_HASH_XXH3_MIDSIZE_START_OFFSET, Seed);
+    
+    Hash += CCHashXXH3Mix16(Bytes + Size - 16, Secret + CC_HASH_XXH3_SECRET_MIN_SIZE - CC_HASH_XXH3_MIDSIZE_LAST_OFFSET, Seed);
+    
+    return CCHashXXH3Avalanche(Hash);
+}
+
+static CC_FORCE_INLINE void CCHashXXH3Accumulate512(uint64_t *Accumulators, const uint8_t *Stripe, const uint8_t *Secret)
+{
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX2
+    for (size_t Loop = 0; Loop < 2; Loop++)
     {
-        uint32_t k = ((uint32_t*)Map.ptr)[Index];
-        k *= c1;
-        k = CCHashROL32(k, r1);
-        k *= c2;
+        const __m256i Data = _mm256_loadu_si256((const __m256i*)(Stripe + (32 * Loop)));
+        const __m256i Key = _mm256_xor_si256(Data, _mm256_loadu_si256((const __m256i*)(Secret + (32 * Loop))));
+        const __m256i Product = _mm256_mul_epu32(Key, _mm256_shuffle_epi32(Key, _MM_SHUFFLE(0, 3, 0, 1)));
+        const __m256i Sum = _mm256_add_epi64(_mm256_load_si256((const __m256i*)Accumulators + Loop), _mm256_shuffle_epi32(Data, _MM_SHUFFLE(1, 0, 3, 2)));
         
-        Hash ^= k;
-        Hash = CCHashROL32(Hash, r2) * m + n;
+        _mm256_store_si256((__m256i*)Accumulators + Loop, _mm256_add_epi64(Product, Sum));
     }
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+    for (size_t Loop = 0; Loop < 4; Loop++)
+    {
+        const __m128i Data = _mm_loadu_si128((const __m128i*)(Stripe + (16 * Loop)));
+        const __m128i Key = _mm_xor_si128(Data, _mm_loadu_si128((const __m128i*)(Secret + (16 * Loop))));
+        const __m128i Product = _mm_mul_epu32(Key, _mm_shuffle_epi32(Key, _MM_SHUFFLE(0, 3, 0, 1)));
+        const __m128i Sum = _mm_add_epi64(_mm_load_si128((const __m128i*)Accumulators + Loop), _mm_shuffle_epi32(Data, _MM_SHUFFLE(1, 0, 3, 2)));
+        
+        _mm_store_si128((__m128i*)Accumulators + Loop, _mm_add_epi64(Product, Sum));
+    }
+#else
+    for (size_t Loop = 0; Loop < 8; Loop++)
+    {
+        const uint64_t Data = CCHashReadLittle64(Stripe + (8 * Loop));
+        const uint64_t Key = Data ^ CCHashReadLittle64(Secret + (8 * Loop));
+        
+        Accumulators[Loop ^ 1] += Data;
+        Accumulators[Loop] += (Key & UINT32_MAX) * (Key >> 32);
+    }
+#endif
+}
+
+static CC_FORCE_INLINE void CCHashXXH3Scramble(uint64_t *Accumulators, const uint8_t *Secret)
+{
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX2
+    const __m256i Prime = _mm256_set1_epi32((int)CCHashXXH3Prime32[0]);
     
-    size_t Leftover = Map.size - (BlockCount * sizeof(uint32_t));
-    if (Leftover)
+    for (size_t Loop = 0; Loop < 2; Loop++)
     {
-        const uint8_t *Tail = Map.ptr + (BlockCount * sizeof(uint32_t));
-        uint32_t k = 0;
-        switch (Leftover)
-        {
-            case 3:
-                k ^= Tail[2] << 16;
-            case 2:
-                k ^= Tail[1] << 8;
-            case 1:
-                k ^= Tail[0];
-                
-                k *= c1;
-                k = CCHashROL32(k, r1);
-                k *= c2;
-                
-                Hash ^= k;
-                break;
-        }
+        __m256i Accumulator = _mm256_load_si256((const __m256i*)Accumulators + Loop);
+        Accumulator = _mm256_xor_si256(_mm256_xor_si256(Accumulator, _mm256_srli_epi64(Accumulator, 47)), _mm256_loadu_si256((const __m256i*)(Secret + (32 * Loop))));
+        
+        const __m256i Lo = _mm256_mul_epu32(Accumulator, Prime);
+        const __m256i Hi = _mm256_mul_epu32(_mm256_shuffle_epi32(Accumulator, _MM_SHUFFLE(0, 3, 0, 1)), Prime);
+        
+        _mm256_store_si256((__m256i*)Accumulators + Loop, _mm256_add_epi64(Lo, _mm256_slli_epi64(Hi, 32)));
     }
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+    const __m128i Prime = _mm_set1_epi32((int)CCHashXXH3Prime32[0]);
     
-    CCDataUnmapBuffer(Data, Map);
-    Read += Map.size;
+    for (size_t Loop = 0; Loop < 4; Loop++)
+    {
+        __m128i Accumulator = _mm_load_si128((const __m128i*)Accumulators + Loop);
+        Accumulator = _mm_xor_si128(_mm_xor_si128(Accumulator, _mm_srli_epi64(Accumulator, 47)), _mm_loadu_si128((const __m128i*)(Secret + (16 * Loop))));
+        
+        const __m128i Lo = _mm_mul_epu32(Accumulator, Prime);
+        const __m128i Hi = _mm_mul_epu32(_mm_shuffle_epi32(Accumulator, _MM_SHUFFLE(0, 3, 0, 1)), Prime);
+        
+        _mm_store_si128((__m128i*)Accumulators + Loop, _mm_add_epi64(Lo, _mm_slli_epi64(Hi, 32)));
+    }
+#else
+    for (size_t Loop = 0; Loop < 8; Loop++)
+    {
+        uint64_t Accumulator = Accumulators[Loop];
+        Accumulator ^= Accumulator >> 47;
+        Accumulator ^= CCHashReadLittle64(Secret + (8 * Loop));
+        Accumulator *= CCHashXXH3Prime32[0];
+        
+        Accumulators[Loop] = Accumulator;
+    }
+#endif
+}
+
+static const uint64_t CCHashXXH3InitialAccumulators[8] = {
+    0xc2b2ae3d, 0x9e3779b185ebca87, 0xc2b2ae3d27d4eb4f, 0x165667b19e3779f9,
+    0x85ebca77c2b2ae63, 0x85ebca77, 0x27d4eb2f165667c5, 0x9e3779b1
+};
+
+static void CCHashXXH3DeriveSecret(uint8_t *Secret, uint64_t Seed)
+{
+    for (size_t Loop = 0; Loop < CC_HASH_XXH3_SECRET_SIZE; Loop += 16)
+    {
+        CCHashWriteLittle64(Secret + Loop, CCHashReadLittle64(CCHashXXH3DefaultSecret + Loop) + Seed);
+        CCHashWriteLittle64(Secret + Loop + 8, CCHashReadLittle64(CCHashXXH3DefaultSecret + Loop + 8) - Seed);
+    }
+}
+
+static CC_FORCE_INLINE void CCHashXXH3ConsumeStripes(uint64_t *Accumulators, size_t *StripeCount, const uint8_t *Bytes, size_t Count, const uint8_t *Secret)
+{
+    const size_t StripesToBlockEnd = CC_HASH_XXH3_STRIPES_PER_BLOCK - *StripeCount;
     
-Finalizer:
-    Hash ^= Read;
-    Hash ^= (Hash >> 16);
-    Hash *= 0x85ebca6b;
-    Hash ^= (Hash >> 13);
-    Hash *= 0xc2b2ae35;
-    Hash ^= (Hash >> 16);
+    if (StripesToBlockEnd <= Count)
+    {
+        for (size_t Loop = 0; Loop < StripesToBlockEnd; Loop++) CCHashXXH3Accumulate512(Accumulators, Bytes + (Loop * CC_HASH_XXH3_STRIPE_SIZE), Secret + ((*StripeCount + Loop) * CC_HASH_XXH3_SECRET_CONSUME_RATE));
+        
+        CCHashXXH3Scramble(Accumulators, Secret + CC_HASH_XXH3_SECRET_SIZE - CC_HASH_XXH3_STRIPE_SIZE);
+        
+        for (size_t Loop = StripesToBlockEnd; Loop < Count; Loop++) CCHashXXH3Accumulate512(Accumulators, Bytes + (Loop * CC_HASH_XXH3_STRIPE_SIZE), Secret + ((Loop - StripesToBlockEnd) * CC_HASH_XXH3_SECRET_CONSUME_RATE));
+        
+        *StripeCount = Count - StripesToBlockEnd;
+    }
     
-    return Hash;
+    else
+    {
+        for (size_t Loop = 0; Loop < Count; Loop++) CCHashXXH3Accumulate512(Accumulators, Bytes + (Loop * CC_HASH_XXH3_STRIPE_SIZE), Secret + ((*StripeCount + Loop) * CC_HASH_XXH3_SECRET_CONSUME_RATE));
+        
+        *StripeCount += Count;
+    }
+}
+
+static uint64_t CCHashXXH3Merge(const uint64_t *Accumulators, const uint8_t *Secret, size_t Size)
+{
+    uint64_t Hash = Size * CCHashXXH3Prime64[0];
+    for (size_t Loop = 0; Loop < 4; Loop++)
+    {
+        const uint8_t *Key = Secret + CC_HASH_XXH3_MERGE_ACCUMULATORS_OFFSET + (16 * Loop);
+        
+        Hash += CCHashXXH3MultiplyFold64(Accumulators[Loop * 2] ^ CCHashReadLittle64(Key), Accumulators[(Loop * 2) + 1] ^ CCHashReadLittle64(Key + 8));
+    }
+    
+    return CCHashXXH3Avalanche(Hash);
+}
+
+static uint64_t CCHashXXH3Long(const uint8_t *Bytes, size_t Size, const uint8_t *Secret)
+{
+    _Alignas(32) uint64_t Accumulators[8];
+    memcpy(Accumulators, CCHashXXH3InitialAccumulators, sizeof(Accumulators));
+    
+    const size_t BlockSize = CC_HASH_XXH3_STRIPE_SIZE * CC_HASH_XXH3_STRIPES_PER_BLOCK;
+    const size_t BlockCount = (Size - 1) / BlockSize;
+    
+    for (size_t Block = 0; Block < BlockCount; Block++)
+    {
+        for (size_t Stripe = 0; Stripe < CC_HASH_XXH3_STRIPES_PER_BLOCK; Stripe++) CCHashXXH3Accumulate512(Accumulators, Bytes + (Block * BlockSize) + (Stripe * CC_HASH_XXH3_STRIPE_SIZE), Secret + (Stripe * CC_HASH_XXH3_SECRET_CONSUME_RATE));
+        
+        CCHashXXH3Scramble(Accumulators, Secret + CC_HASH_XXH3_SECRET_SIZE - CC_HASH_XXH3_STRIPE_SIZE);
+    }
+    
+    for (size_t Stripe = 0, Count = ((Size - 1) - (BlockCount * BlockSize)) / CC_HASH_XXH3_STRIPE_SIZE; Stripe < Count; Stripe++)
+    {
+        CCHashXXH3Accumulate512(Accumulators, Bytes + (BlockCount * BlockSize) + (Stripe * CC_HASH_XXH3_STRIPE_SIZE), Secret + (Stripe * CC_HASH_XXH3_SECRET_CONSUME_RATE));
+    }
+    
+    CCHashXXH3Accumulate512(Accumulators, Bytes + Size - CC_HASH_XXH3_STRIPE_SIZE, Secret + CC_HASH_XXH3_SECRET_SIZE - CC_HASH_XXH3_STRIPE_SIZE - CC_HASH_XXH3_LAST_ACCUMULATOR_OFFSET);
+    
+    return CCHashXXH3Merge(Accumulators, Secret, Size);
+}
+
+uint64_t CCHashXXH3Bytes(const void *Bytes, size_t Size, uint64_t Seed)
+{
+    CCAssertLog(Bytes || !Size, "Bytes must not be null");
+    
+    if (Size <= 16) return CCHashXXH3Short(Bytes, Size, CCHashXXH3DefaultSecret, Seed);
+    else if (Size <= CC_HASH_XXH3_MIDSIZE_MAX) return CCHashXXH3Medium(Bytes, Size, CCHashXXH3DefaultSecret, Seed);
+    else if (!Seed) return CCHashXXH3Long(Bytes, Size, CCHashXXH3DefaultSecret);
+    
+    _Alignas(64) uint8_t Secret[CC_HASH_XXH3_SECRET_SIZE];
+    CCHashXXH3DeriveSecret(Secret, Seed);
+    
+    return CCHashXXH3Long(Bytes, Size, Secret);
+}
+
+void CCHashXXH3Init(CCHashXXH3State *State, uint64_t Seed)
+{
+    CCAssertLog(State, "State must not be null");
+    
+    memcpy(State->accumulators, CCHashXXH3InitialAccumulators, sizeof(State->accumulators));
+    
+    if (Seed) CCHashXXH3DeriveSecret(State->secret, Seed);
+    else memcpy(State->secret, CCHashXXH3DefaultSecret, sizeof(State->secret));
+    
+    State->seed = Seed;
+    State->size = 0;
+    State->buffered = 0;
+    State->stripes = 0;
+}
+
+void CCHashXXH3Update(CCHashXXH3State *State, const void *Bytes, size_t Size)
+{
+    CCAssertLog(State, "State must not be null");
+    CCAssertLog(Bytes || !Size, "Bytes must not be null");
+    
+    State->size += Size;
+    
+    //The buffer is only consumed once more data follows it, so the final stripe is always available to CCHashXXH3Final
+    if ((State->buffered + Size) <= sizeof(State->buffer))
+    {
+        memcpy(State->buffer + State->buffered, Bytes, Size);
+        State->buffered += Size;
+        
+        return;
+    }
+    
+    const uint8_t *Input = Bytes, *End = Input + Size;
+    
+    if (State->buffered)
+    {
+        const size_t Fill = sizeof(State->buffer) - State->buffered;
+        memcpy(State->buffer + State->buffered, Input, Fill);
+        Input += Fill;
+        
+        CCHashXXH3ConsumeStripes(State->accumulators, &State->stripes, State->buffer, sizeof(State->buffer) / CC_HASH_XXH3_STRIPE_SIZE, State->secret);
+        State->buffered = 0;
+    }
+    
+    if ((size_t)(End - Input) > sizeof(State->buffer))
+    {
+        do {
+            CCHashXXH3ConsumeStripes(State->accumulators, &State->stripes, Input, sizeof(State->buffer) / CC_HASH_XXH3_STRIPE_SIZE, State->secret);
+            Input += sizeof(State->buffer);
+        } while ((size_t)(End - Input) > sizeof(State->buffer));
+        
+        memcpy(State->buffer + sizeof(State->buffer) - CC_HASH_XXH3_STRIPE_SIZE, Input - CC_HASH_XXH3_STRIPE_SIZE, CC_HASH_XXH3_STRIPE_SIZE);
+    }
+    
+    memcpy(State->buffer, Input, End - Input);
+    State->buffered = End - Input;
+}
+
+uint64_t CCHashXXH3Final(const CCHashXXH3State *State)
+{
+    CCAssertLog(State, "State must not be null");
+    
+    if (State->size <= CC_HASH_XXH3_MIDSIZE_MAX) return CCHashXXH3Bytes(State->buffer, State->size, State->seed);
+    
+    _Alignas(32) uint64_t Accumulators[8];
+    memcpy(Accumulators, State->accumulators, sizeof(Accumulators));
+    
+    uint8_t Stripe[CC_HASH_XXH3_STRIPE_SIZE];
+    const uint8_t *LastStripe = Stripe;
+    
+    if (State->buffered >= CC_HASH_XXH3_STRIPE_SIZE)
+    {
+        size_t StripeCount = State->stripes;
+        CCHashXXH3ConsumeStripes(Accumulators, &StripeCount, State->buffer, (State->buffered - 1) / CC_HASH_XXH3_STRIPE_SIZE, State->secret);
+        
+        LastStripe = State->buffer + State->buffered - CC_HASH_XXH3_STRIPE_SIZE;
+    }
+    
+    else
+    {
+        const size_t Previous = CC_HASH_XXH3_STRIPE_SIZE - State->buffered;
+        memcpy(Stripe, State->buffer + sizeof(State->buffer) - Previous, Previous);
+        memcpy(Stripe + Previous, State->buffer, State->buffered);
+    }
+    
+    CCHashXXH3Accumulate512(Accumulators, LastStripe, State->secret + CC_HASH_XXH3_SECRET_SIZE - CC_HASH_XXH3_STRIPE_SIZE - CC_HASH_XXH3_LAST_ACCUMULATOR_OFFSET);
+    
+    return CCHashXXH3Merge(Accumulators, State->secret, State->size);
+}
+
+uint64_t CCHashXXH3(CCData Data)
+{
+    return CCHashXXH3WithSeed(Data, 0);
+}
+
+uint64_t CCHashXXH3WithSeed(CCData Data, uint64_t Seed)
+{
+    const size_t Size = CCDataGetSize(Data);
+    
+    if (Size <= CCDataGetPreferredMapSize(Data))
+    {
+        CCBufferMap Map = CCDataMapBuffer(Data, 0, Size, CCDataHintRead);
+        
+        const uint64_t Hash = CCHashXXH3Bytes(Map.ptr, Map.size, Seed);
+        
+        CCDataUnmapBuffer(Data, Map);
+        
+        return Hash;
+    }
+    
+    CCHashXXH3State State;
+    CCHashXXH3Init(&State, Seed);
+    CCHashUpdateWithData(Data, (CCHashUpdate)CCHashXXH3Update, &State);
+    
+    return CCHashXXH3Final(&State);
 }
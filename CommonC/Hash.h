@@ -29,6 +29,32 @@
 #include <CommonC/Base.h>
 #include <CommonC/Data.h>
 
+/*!
+ * @brief The state of an incremental Murmur3 hash.
+ * @description Allows the hash to be computed over data that arrives in pieces. The result is the same
+ *              as hashing the concatenated data with @b CCHashMurmur32Bytes.
+ */
+typedef struct {
+    uint32_t hash;
+    uint8_t tail[4];
+    size_t size;
+} CCHashMurmur32State;
+
+/*!
+ * @brief The state of an incremental XXH3 hash.
+ * @description Allows the hash to be computed over data that arrives in pieces. The result is the same
+ *              as hashing the concatenated data with @b CCHashXXH3Bytes.
+ */
+typedef struct {
+    _Alignas(64) uint64_t accumulators[8];
+    _Alignas(64) uint8_t secret[192];
+    _Alignas(64) uint8_t buffer[256];
+    uint64_t seed;
+    size_t size;
+    size_t buffered;
+    size_t stripes;
+} CCHashXXH3State;
+
 /*!
  * @brief An implementation of Jenkins's one-at-a-time hash
  * @see https://en.wikipedia.org/wiki/Jenkins_hash_function#one-at-a-time
@@ -37,6 +63,15 @@
  */
 uint32_t CCHashJenkins32(CCData Data);
 
+/*!
+ * @brief An implementation of Jenkins's one-at-a-time hash for contiguous memory.
+ * @see https://en.wikipedia.org/wiki/Jenkins_hash_function#one-at-a-time
+ * @param Bytes The bytes to obtain the hash for.
+ * @param Size The number of bytes.
+ * @return The hash.
+ */
+uint32_t CCHashJenkins32Bytes(const void *Bytes, size_t Size);
+
 /*!
  * @brief An implementation of Murmur3 hash
  * @see https://en.wikipedia.org/wiki/MurmurHash#Algorithm
@@ -45,4 +80,105 @@ uint32_t CCHashJenkins32(CCData Data);
  */
 uint32_t CCHashMurmur32(CCData Data);
 
+/*!
+ * @brief An implementation of Murmur3 hash using a custom seed.
+ * @see https://en.wikipedia.org/wiki/MurmurHash#Algorithm
+ * @param Data The data to obtain the hash for.
+ * @param Seed The seed to initialise the hash with.
+ * @return The hash.
+ */
+uint32_t CCHashMurmur32WithSeed(CCData Data, uint32_t Seed);
+
+/*!
+ * @brief An implementation of Murmur3 hash for contiguous memory.
+ * @see https://en.wikipedia.org/wiki/MurmurHash#Algorithm
+ * @param Bytes The bytes to obtain the hash for.
+ * @param Size The number of bytes.
+ * @param Seed The seed to initialise the hash with. The default seed is 0.
+ * @return The hash.
+ */
+uint32_t CCHashMurmur32Bytes(const void *Bytes, size_t Size, uint32_t Seed);
+
+/*!
+ * @brief Initialise the state for an incremental Murmur3 hash.
+ * @param State The state to be initialised.
+ * @param Seed The seed to initialise the hash with. The default seed is 0.
+ */
+void CCHashMurmur32Init(CCHashMurmur32State *State, uint32_t Seed);
+
+/*!
+ * @brief Add bytes to an incremental Murmur3 hash.
+ * @param State The state of the hash.
+ * @param Bytes The bytes to be hashed.
+ * @param Size The number of bytes.
+ */
+void CCHashMurmur32Update(CCHashMurmur32State *State, const void *Bytes, size_t Size);
+
+/*!
+ * @brief Get the hash of all the bytes added to an incremental Murmur3 hash.
+ * @description The state is not modified, so more bytes may continue to be added.
+ * @param State The state of the hash.
+ * @return The hash.
+ */
+uint32_t CCHashMurmur32Final(const CCHashMurmur32State *State);
+
+/*!
+ * @brief An implementation of the 64-bit XXH3 hash.
+ * @description Produces the same results as the reference XXH3_64bits. Inputs larger than 240 bytes
+ *              use the vectorised accumulation path when SSE2 or AVX2 is available.
+ *
+ * @see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ * @param Data The data to obtain the hash for.
+ * @return The hash.
+ */
+uint64_t CCHashXXH3(CCData Data);
+
+/*!
+ * @brief An implementation of the 64-bit XXH3 hash using a custom seed.
+ * @description Randomising the seed makes it impractical to construct keys that intentionally
+ *              collide (hash flooding).
+ *
+ * @see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ * @param Data The data to obtain the hash for.
+ * @param Seed The seed to derive the hash from.
+ * @return The hash.
+ */
+uint64_t CCHashXXH3WithSeed(CCData Data, uint64_t Seed);
+
+/*!
+ * @brief An implementation of the 64-bit XXH3 hash for contiguous memory.
+ * @see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ * @param Bytes The bytes to obtain the hash for.
+ * @param Size The number of bytes.
+ * @param Seed The seed to derive the hash from. The default seed is 0.
+ * @return The hash.
+ */
+uint64_t CCHashXXH3Bytes(const void *Bytes, size_t Size, uint64_t Seed);
+
+/*!
+ * @brief Initialise the state for an incremental XXH3 hash.
+ * @param State The state to be initialised.
+ * @param Seed The seed to derive the hash from. The default seed is 0.
+ */
+void CCHashXXH3Init(CCHashXXH3State *State, uint64_t Seed);
+
+/*!
+ * @brief Add bytes to an incremental XXH3 hash.
+ * @description Memory use is constant regardless of how much data is hashed, so this can be fed
+ *              directly from file or network reads.
+ *
+ * @param State The state of the hash.
+ * @param Bytes The bytes to be hashed.
+ * @param Size The number of bytes.
+ */
+void CCHashXXH3Update(CCHashXXH3State *State, const void *Bytes, size_t Size);
+
+/*!
+ * @brief Get the hash of all the bytes added to an incremental XXH3 hash.
+ * @description The state is not modified, so more bytes may continue to be added.
+ * @param State The state of the hash.
+ * @return The hash.
+ */
+uint64_t CCHashXXH3Final(const CCHashXXH3State *State);
+
 #endif
@@ -29,6 +29,14 @@
 #include "HashMapEnumerator.h"
 #include <string.h>
 
+#ifndef CC_HASH_MAP_FIND_BATCH_SIZE
+#define CC_HASH_MAP_FIND_BATCH_SIZE 16
+#endif
+
+#ifndef CC_HASH_MAP_BUILD_TASK_SIZE
+#define CC_HASH_MAP_BUILD_TASK_SIZE 16384
+#endif
+
 
 static void CCHashMapDestructor(CCHashMap Ptr)
 {
@@ -71,6 +79,107 @@ CCHashMap CCHashMapCreate(CCAllocatorType Allocator, size_t KeySize, size_t Valu
     return Map;
 }
 
+typedef struct {
+    CCHashMap map;
+    const void *keys;
+    uintmax_t *hashes;
+    size_t count;
+} CCHashMapHashKeysInput;
+
+static void CCHashMapHashKeys(const CCHashMapHashKeysInput *In, void *Out)
+{
+    for (size_t Loop = 0; Loop < In->count; Loop++) In->hashes[Loop] = CCHashMapGetKeyHash(In->map, In->keys + (Loop * In->map->keySize));
+}
+
+static _Bool CCHashMapHashKeysConcurrently(CCHashMap Map, const void *Keys, uintmax_t *Hashes, size_t Count, CCTaskQueue Queue)
+{
+    const size_t TaskCount = (Count + (CC_HASH_MAP_BUILD_TASK_SIZE - 1)) / CC_HASH_MAP_BUILD_TASK_SIZE;
+    
+    CCTask *Tasks = CCMalloc(CC_STD_ALLOCATOR, sizeof(CCTask) * TaskCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Tasks) return FALSE;
+    
+    size_t Pushed = 0;
+    for (size_t Index = 0; Index < Count; Index += CC_HASH_MAP_BUILD_TASK_SIZE, Pushed++)
+    {
+        const CCHashMapHashKeysInput Input = {
+            .map = Map,
+            .keys = Keys + (Index * Map->keySize),
+            .hashes = Hashes + Index,
+            .count = (Count - Index) < CC_HASH_MAP_BUILD_TASK_SIZE ? (Count - Index) : CC_HASH_MAP_BUILD_TASK_SIZE
+        };
+        
+        CCTask Task = CCTaskCreate(CC_STD_ALLOCATOR, (CCTaskFunction)CCHashMapHashKeys, 0, NULL, sizeof(Input), &Input, NULL);
+        if (!Task)
+        {
+            //Hash whatever wasn't pushed on this thread instead
+            CCHashMapHashKeys(&(CCHashMapHashKeysInput){ .map = Map, .keys = Input.keys, .hashes = Input.hashes, .count = Count - Index }, NULL);
+            break;
+        }
+        
+        Tasks[Pushed] = CCRetain(Task);
+        CCTaskQueuePush(Queue, Task);
+    }
+    
+    //Help execute the queue, so the build doesn't rely on other threads servicing it
+    for (size_t Loop = 0; Loop < Pushed; Loop++)
+    {
+        CCTask Task = Tasks[Loop];
+        while (!CCTaskIsFinished(Task))
+        {
+            CCTask Next = CCTaskQueuePop(Queue);
+            if (Next)
+            {
+                CCTaskRun(Next);
+                CCTaskDestroy(Next);
+            }
+            
+            else CC_SPIN_WAIT();
+        }
+        
+        CCTaskDestroy(Task);
+    }
+    
+    CCFree(Tasks);
+    
+    return TRUE;
+}
+
+CCHashMap CCHashMapCreateFromArrays(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, const void *Keys, const void *Values, size_t Count, CCHashMapKeyHasher Hasher, CCComparator KeyComparator, const CCHashMapInterface *Interface, CCTaskQueue Queue)
+{
+    CCAssertLog(Keys || !Count, "Keys must not be null");
+    
+    CCHashMap Map = CCHashMapCreate(Allocator, KeySize, ValueSize, Count ? Count : 1, Hasher, KeyComparator, Interface);
+    if ((!Map) || (!Count)) return Map;
+    
+    uintmax_t *Hashes = NULL;
+    if (Interface->optional.build)
+    {
+        Hashes = CCMalloc(CC_STD_ALLOCATOR, sizeof(uintmax_t) * Count, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        
+        if ((Hashes) && ((!Queue) || (Count <= CC_HASH_MAP_BUILD_TASK_SIZE) || (!CCHashMapHashKeysConcurrently(Map, Keys, Hashes, Count, Queue))))
+        {
+            CCHashMapHashKeys(&(CCHashMapHashKeysInput){ .map = Map, .keys = Keys, .hashes = Hashes, .count = Count }, NULL);
+        }
+    }
+    
+    if (Hashes)
+    {
+        Interface->optional.build(Map, Keys, Values, Hashes, Count);
+        CCFree(Hashes);
+    }
+    
+    else
+    {
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCHashMapEntry Entry = CCHashMapEntryForKey(Map, Keys + (Loop * KeySize), NULL);
+            if (Values) CCHashMapSetEntry(Map, Entry, Values + (Loop * ValueSize));
+        }
+    }
+    
+    return Map;
+}
+
 void CCHashMapDestroy(CCHashMap Map)
 {
     CCAssertLog(Map, "Map must not be null");
@@ -150,6 +259,51 @@ CCHashMapEntry CCHashMapFindKey(CCHashMap Map, const void *Key)
     return Map->interface->findKey(Map, Key);
 }
 
+CCHashMapEntry CCHashMapFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash)
+{
+    CCAssertLog(Map, "Map must not be null");
+    
+    if (Map->interface->optional.findKeyWithHash) return Map->interface->optional.findKeyWithHash(Map, Key, Hash);
+    else return Map->interface->findKey(Map, Key);
+}
+
+void CCHashMapFindKeys(CCHashMap Map, const void *Keys, const uintmax_t *Hashes, size_t Count, CCHashMapEntry *Entries)
+{
+    CCAssertLog(Map, "Map must not be null");
+    CCAssertLog(Keys || !Count, "Keys must not be null");
+    CCAssertLog(Entries || !Count, "Entries must not be null");
+    
+    const CCHashMapFindKeyWithHashCallback FindKeyWithHash = Map->interface->optional.findKeyWithHash;
+    const CCHashMapPrefetchCallback Prefetch = Map->interface->optional.prefetch;
+    
+    if (!FindKeyWithHash)
+    {
+        for (size_t Loop = 0; Loop < Count; Loop++) Entries[Loop] = Map->interface->findKey(Map, Keys + (Loop * Map->keySize));
+        
+        return;
+    }
+    
+    uintmax_t BatchHashes[CC_HASH_MAP_FIND_BATCH_SIZE];
+    for (size_t Index = 0; Index < Count; Index += CC_HASH_MAP_FIND_BATCH_SIZE)
+    {
+        const size_t BatchCount = (Count - Index) < CC_HASH_MAP_FIND_BATCH_SIZE ? (Count - Index) : CC_HASH_MAP_FIND_BATCH_SIZE;
+        const void *BatchKeys = Keys + (Index * Map->keySize);
+        const uintmax_t *Batch = Hashes ? Hashes + Index : BatchHashes;
+        
+        if (!Hashes)
+        {
+            for (size_t Loop = 0; Loop < BatchCount; Loop++) BatchHashes[Loop] = CCHashMapGetKeyHash(Map, BatchKeys + (Loop * Map->keySize));
+        }
+        
+        if (Prefetch)
+        {
+            for (size_t Loop = 0; Loop < BatchCount; Loop++) Prefetch(Map, Batch[Loop]);
+        }
+        
+        for (size_t Loop = 0; Loop < BatchCount; Loop++) Entries[Index + Loop] = FindKeyWithHash(Map, BatchKeys + (Loop * Map->keySize), Batch[Loop]);
+    }
+}
+
 CCHashMapEntry CCHashMapEntryForKey(CCHashMap Map, const void *Key, _Bool *Created)
 {
     CCAssertLog(Map, "Map must not be null");
@@ -199,6 +353,13 @@ void *CCHashMapGetValue(CCHashMap Map, const void *Key)
     else return CCHashMapGetEntry(Map, CCHashMapFindKey(Map, Key));
 }
 
+void *CCHashMapGetValueWithHash(CCHashMap Map, const void *Key, uintmax_t Hash)
+{
+    CCAssertLog(Map, "Map must not be null");
+    
+    return CCHashMapGetEntry(Map, CCHashMapFindKeyWithHash(Map, Key, Hash));
+}
+
 void CCHashMapSetValue(CCHashMap Map, const void *Key, const void *Value)
 {
     CCAssertLog(Map, "Map must not be null");
@@ -273,6 +434,38 @@ CCOrderedCollection CCHashMapGetValues(CCHashMap Map)
     return Values;
 }
 
+#define CC_HASH_MAP_CURSOR_STARTED 0x80000000
+#define CC_HASH_MAP_CURSOR_FINISHED 0x40000000
+
+size_t CCHashMapGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values)
+{
+    CCAssertLog(Map, "Map must not be null");
+    CCAssertLog(Cursor, "Cursor must not be null");
+    
+    if (Map->interface->optional.batch) return Map->interface->optional.batch(Map, Cursor, Keys, Values);
+    
+    //Otherwise step through the enumerator, with each entry being a batch of one
+    if (Cursor->type & CC_HASH_MAP_CURSOR_FINISHED) return 0;
+    
+    CCEnumerator Enumerator = { .ref = Map, .option = CCHashMapEnumeratorTypeKey, .state = *Cursor };
+    
+    void *Key = Cursor->type & CC_HASH_MAP_CURSOR_STARTED ? CCHashMapEnumeratorNext(&Enumerator) : CCHashMapEnumeratorGetHead(&Enumerator);
+    
+    *Cursor = Enumerator.state;
+    Cursor->type |= CC_HASH_MAP_CURSOR_STARTED;
+    
+    if (!Key)
+    {
+        Cursor->type |= CC_HASH_MAP_CURSOR_FINISHED;
+        return 0;
+    }
+    
+    if (Keys) *Keys = (CCEnumeratorState){ .batch = { .ptr = Key, .count = 1, .stride = Map->keySize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+    if (Values) *Values = (CCEnumeratorState){ .batch = { .ptr = CCHashMapGetEntry(Map, CCHashMapEnumeratorGetEntry(&Enumerator)), .count = 1, .stride = Map->valueSize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+    
+    return 1;
+}
+
 void CCHashMapGetKeyEnumerator(CCHashMap Map, CCEnumerator *Enumerator)
 {
     CCAssertLog(Map, "Map must not be null");
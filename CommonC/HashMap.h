@@ -33,8 +33,27 @@
 #include <CommonC/Enumerator.h>
 #include <CommonC/Comparator.h>
 #include <CommonC/Assertion.h>
+#include <CommonC/TaskQueue.h>
 
 
+#ifndef CC_HASH_MAP_INCREMENTAL_REHASH_STEP
+/*!
+ * @define CC_HASH_MAP_INCREMENTAL_REHASH_STEP
+ * @abstract The number of buckets an implementation supporting incremental rehashing will migrate on
+ *           each insertion, while a rehash is in progress.
+ */
+#define CC_HASH_MAP_INCREMENTAL_REHASH_STEP 4
+#endif
+
+#ifndef CC_HASH_MAP_BUCKET_INLINE_COUNT
+/*!
+ * @define CC_HASH_MAP_BUCKET_INLINE_COUNT
+ * @abstract The number of entries an implementation using array buckets will store in the same
+ *           allocation as the bucket, before the bucket's entries need a separate allocation.
+ */
+#define CC_HASH_MAP_BUCKET_INLINE_COUNT 2
+#endif
+
 CC_CONTAINER_DECLARE_PRESET_2(CCHashMap);
 
 /*!
@@ -104,6 +123,37 @@ typedef struct CCHashMapInfo {
  */
 CC_NEW CCHashMap CCHashMapCreate(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount, CCHashMapKeyHasher Hasher, CCComparator KeyComparator, const CCHashMapInterface *Interface);
 
+/*!
+ * @brief Create a hashmap populated from arrays of keys and values.
+ * @description This is faster than setting each value individually, as the map is sized for all of
+ *              the entries up front and implementations that support it will fill their buckets
+ *              without reallocating. If a key appears more than once, the last value for that key
+ *              is used.
+ *
+ *              If a task queue is provided, the keys will be hashed in parallel by pushing tasks
+ *              to that queue. The calling thread will also execute tasks from the queue until the
+ *              hashing has completed, so it will still progress if no other threads are servicing
+ *              the queue.
+ *
+ * @warning If a task queue is provided then the hasher must be threadsafe.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param KeySize The size of the keys.
+ * @param ValueSize The size of the values.
+ * @param Keys The array of keys.
+ * @param Values The array of values, or NULL if the entries should be left uninitialized.
+ * @param Count The number of keys.
+ * @param Hasher The hashing function to be used to generate a hash for a given key. If
+ *        NULL, the key will default as the hash itself.
+ *
+ * @param KeyComparator The key comparison function to be used to determine if two keys
+ *        match. If NULL, a byte level comparison is performed.
+ *
+ * @param Interface The interface to the internal implementation to be used.
+ * @param Queue The optional task queue to hash the keys on.
+ * @return A hashmap, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCHashMap CCHashMapCreateFromArrays(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, const void *Keys, const void *Values, size_t Count, CCHashMapKeyHasher Hasher, CCComparator KeyComparator, const CCHashMapInterface *Interface, CCTaskQueue Queue);
+
 /*!
  * @brief Destroy an hashmap.
  * @param Map The hashmap to be destroyed.
@@ -184,6 +234,37 @@ _Bool CCHashMapEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry);
  */
 CCHashMapEntry CCHashMapFindKey(CCHashMap Map, const void *Key);
 
+/*!
+ * @brief Find a given key using its precomputed hash.
+ * @description Avoids hashing the key again when its hash is already known. If no key is found,
+ *              the entry reference will be NULL.
+ *
+ * @warning The hash must be the same as the one @b CCHashMapGetKeyHash produces for the key.
+ * @param Map The hashmap to find the key of.
+ * @param Key The pointer to the key to be found.
+ * @param Hash The hash of the key.
+ * @return The entry reference.
+ */
+CCHashMapEntry CCHashMapFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash);
+
+/*!
+ * @brief Find multiple keys.
+ * @description Lookups are performed in batches, where the memory for every lookup in the batch
+ *              is prefetched before any of them are probed. This allows the memory latency of the
+ *              lookups to overlap. If a key is not found, its entry reference will be NULL.
+ *
+ * @warning If hashes are provided they must be the same as the ones @b CCHashMapGetKeyHash
+ *          produces for the keys.
+ *
+ * @param Map The hashmap to find the keys of.
+ * @param Keys The array of keys to be found.
+ * @param Hashes The optional array of hashes for the keys. If NULL the hashes will be computed.
+ * @param Count The number of keys.
+ * @param Entries The array to store the entry references in. Must be large enough to fit
+ *        @b Count entries.
+ */
+void CCHashMapFindKeys(CCHashMap Map, const void *Keys, const uintmax_t *Hashes, size_t Count, CCHashMapEntry *Entries);
+
 /*!
  * @brief Get the value of a given entry reference.
  * @param Map The hashmap to get the value of.
@@ -201,6 +282,16 @@ void *CCHashMapGetEntry(CCHashMap Map, CCHashMapEntry Entry);
  */
 void *CCHashMapGetValue(CCHashMap Map, const void *Key);
 
+/*!
+ * @brief Get the value of a given key using its precomputed hash.
+ * @warning The hash must be the same as the one @b CCHashMapGetKeyHash produces for the key.
+ * @param Map The hashmap to get the value of.
+ * @param Key The pointer to the key to be used to get the value for.
+ * @param Hash The hash of the key.
+ * @return The pointer to the value, or NULL if the key could not be found.
+ */
+void *CCHashMapGetValueWithHash(CCHashMap Map, const void *Key, uintmax_t Hash);
+
 /*!
  * @brief Get the key of a given entry reference.
  * @param Map The hashmap to get the value of.
@@ -231,6 +322,26 @@ CC_NEW CCOrderedCollection CCHashMapGetKeys(CCHashMap Map);
  */
 CC_NEW CCOrderedCollection CCHashMapGetValues(CCHashMap Map);
 
+/*!
+ * @brief Get the next batch of entries in the hashmap.
+ * @description Batches are runs of entries whose keys (and values) are stored at a fixed stride from one
+ *              another, so they can be processed in a tight loop without the per element overhead of
+ *              the enumerators. Batches follow the same order as the enumerators.
+ *
+ *              The returned states use @b CCEnumeratorFormatBatch, so the elements of a batch are
+ *              at @b batch.ptr + (index * @b batch.stride) for index in [0, @b batch.count). Values
+ *              of uninitialized entries are included. A batch is only valid until the hashmap is mutated.
+ *
+ * @param Map The hashmap to get the batch from.
+ * @param Cursor The cursor used to track the position. This must be zero initialized before retrieving
+ *        the first batch.
+ *
+ * @param Keys The enumerator state to be set to the keys of the batch, or NULL if the keys are not needed.
+ * @param Values The enumerator state to be set to the values of the batch, or NULL if the values are not needed.
+ * @return The number of entries in the batch, or 0 if there are no more entries.
+ */
+size_t CCHashMapGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values);
+
 /*!
  * @brief Get a key enumerator for the hashmap.
  * @param Map The hashmap to obtain a key enumerator for.
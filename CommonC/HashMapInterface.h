@@ -193,6 +193,56 @@ typedef void (*CCHashMapRehashCallback)(CCHashMap Map, size_t BucketCount);
  */
 typedef void *(*CCHashMapGetValueCallback)(CCHashMap Map, const void *Key);
 
+/*!
+ * @brief An optional callback to find a given key using its precomputed hash.
+ * @param Map The hashmap to find the key of.
+ * @param Key The pointer to the key to be found.
+ * @param Hash The hash of the key, as returned by @b CCHashMapGetKeyHash.
+ * @return The entry reference.
+ */
+typedef CCHashMapEntry (*CCHashMapFindKeyWithHashCallback)(CCHashMap Map, const void *Key, uintmax_t Hash);
+
+/*!
+ * @brief An optional callback to prefetch the memory a lookup for a given hash will first access.
+ * @description This must not block on the memory it is prefetching.
+ * @param Map The hashmap to prefetch.
+ * @param Hash The hash of the key that will be looked up.
+ */
+typedef void (*CCHashMapPrefetchCallback)(CCHashMap Map, uintmax_t Hash);
+
+/*!
+ * @brief An optional callback to populate an empty hashmap from arrays of keys and values.
+ * @description This allows the implementation to size its storage for all of the entries up front,
+ *              rather than growing as each entry is added. If a key appears more than once, the
+ *              last value for that key is used.
+ *
+ * @param Map The empty hashmap to populate.
+ * @param Keys The array of keys.
+ * @param Values The array of values, or NULL if the entries should be left uninitialized.
+ * @param Hashes The hashes of the keys, as returned by @b CCHashMapGetKeyHash.
+ * @param Count The number of keys.
+ */
+typedef void (*CCHashMapBuildCallback)(CCHashMap Map, const void *Keys, const void *Values, const uintmax_t *Hashes, size_t Count);
+
+/*!
+ * @brief An optional callback to get the next batch of entries.
+ * @description A batch is a run of entries whose keys (and values) are stored at a fixed stride from
+ *              one another. Batches must follow the same order as the enumerator.
+ *
+ * @param Map The hashmap to get the batch from.
+ * @param Cursor The cursor used to track the position. It is zero initialized before the first batch
+ *        is retrieved, after which it is owned by the implementation.
+ *
+ * @param Keys The enumerator state to be set to the keys of the batch using @b CCEnumeratorFormatBatch,
+ *        or NULL if the keys are not needed.
+ *
+ * @param Values The enumerator state to be set to the values of the batch using @b CCEnumeratorFormatBatch,
+ *        or NULL if the values are not needed.
+ *
+ * @return The number of entries in the batch, or 0 if there are no more entries.
+ */
+typedef size_t (*CCHashMapBatchCallback)(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values);
+
 /*!
  * @brief An optional callback to set the value at a given key.
  * @param Map The hashmap to set the value of.
@@ -257,6 +307,10 @@ typedef struct {
         CCHashMapRemoveValueCallback removeValue;
         CCHashMapGetKeysCallback keys;
         CCHashMapGetValuesCallback values;
+        CCHashMapFindKeyWithHashCallback findKeyWithHash;
+        CCHashMapPrefetchCallback prefetch;
+        CCHashMapBuildCallback build;
+        CCHashMapBatchCallback batch;
     } optional;
 } CCHashMapInterface;
 
@@ -0,0 +1,620 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "HashMapRobinHood.h"
+#include "HashMap.h"
+#include "MemoryAllocation.h"
+#include "OrderedCollection.h"
+#include "BitTricks.h"
+#include "Logging.h"
+#include <string.h>
+
+
+typedef struct {
+    size_t entry;
+    uint32_t hash;
+    uint32_t distance; //0 if empty, otherwise the probe distance + 1
+} CCHashMapRobinHoodSlot;
+
+typedef struct {
+    size_t count;
+    size_t capacity;
+    size_t entryCount;
+    CCHashMapRobinHoodSlot *slots;
+    uint32_t *hashes;
+    uint8_t *state;
+    void *entries;
+} CCHashMapRobinHoodInternal;
+
+static void *CCHashMapRobinHoodConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount);
+static void CCHashMapRobinHoodDestructor(CCHashMapRobinHoodInternal *Internal);
+static size_t CCHashMapRobinHoodGetCount(CCHashMap Map);
+static void CCHashMapRobinHoodRehash(CCHashMap Map, size_t BucketCount);
+static _Bool CCHashMapRobinHoodEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry);
+static CCHashMapEntry CCHashMapRobinHoodFindKey(CCHashMap Map, const void *Key);
+static CCHashMapEntry CCHashMapRobinHoodFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash);
+static void CCHashMapRobinHoodPrefetch(CCHashMap Map, uintmax_t Hash);
+static void CCHashMapRobinHoodBuild(CCHashMap Map, const void *Keys, const void *Values, const uintmax_t *Hashes, size_t Count);
+static CCHashMapEntry CCHashMapRobinHoodEntryForKey(CCHashMap Map, const void *Key, _Bool *Created);
+static void *CCHashMapRobinHoodGetKey(CCHashMap Map, CCHashMapEntry Entry);
+static void *CCHashMapRobinHoodGetEntry(CCHashMap Map, CCHashMapEntry Entry);
+static void CCHashMapRobinHoodSetEntry(CCHashMap Map, CCHashMapEntry Entry, const void *Value);
+static void CCHashMapRobinHoodRemoveEntry(CCHashMap Map, CCHashMapEntry Entry);
+static void *CCHashMapRobinHoodGetValue(CCHashMap Map, const void *Key);
+static void CCHashMapRobinHoodSetValue(CCHashMap Map, const void *Key, const void *Value);
+static void CCHashMapRobinHoodRemoveValue(CCHashMap Map, const void *Key);
+static CCOrderedCollection CCHashMapRobinHoodGetKeys(CCHashMap Map);
+static CCOrderedCollection CCHashMapRobinHoodGetValues(CCHashMap Map);
+static void *CCHashMapRobinHoodEnumerator(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorAction Action, CCHashMapEnumeratorType Type);
+static CCHashMapEntry CCHashMapRobinHoodEnumeratorEntry(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorType Type);
+static size_t CCHashMapRobinHoodGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values);
+
+
+const CCHashMapInterface CCHashMapRobinHoodInterface = {
+    .create = CCHashMapRobinHoodConstructor,
+    .destroy = (CCHashMapDestructorCallback)CCHashMapRobinHoodDestructor,
+    .count = CCHashMapRobinHoodGetCount,
+    .initialized = CCHashMapRobinHoodEntryIsInitialized,
+    .findKey = CCHashMapRobinHoodFindKey,
+    .entryForKey = CCHashMapRobinHoodEntryForKey,
+    .getKey = CCHashMapRobinHoodGetKey,
+    .getEntry = CCHashMapRobinHoodGetEntry,
+    .setEntry = CCHashMapRobinHoodSetEntry,
+    .removeEntry = CCHashMapRobinHoodRemoveEntry,
+    .enumerator = CCHashMapRobinHoodEnumerator,
+    .enumeratorReference = CCHashMapRobinHoodEnumeratorEntry,
+    .optional = {
+        .rehash = CCHashMapRobinHoodRehash,
+        .getValue = CCHashMapRobinHoodGetValue,
+        .setValue = CCHashMapRobinHoodSetValue,
+        .removeValue = CCHashMapRobinHoodRemoveValue,
+        .keys = CCHashMapRobinHoodGetKeys,
+        .values = CCHashMapRobinHoodGetValues,
+        .findKeyWithHash = CCHashMapRobinHoodFindKeyWithHash,
+        .prefetch = CCHashMapRobinHoodPrefetch,
+        .build = CCHashMapRobinHoodBuild,
+        .batch = CCHashMapRobinHoodGetNextBatch
+    }
+};
+
+const CCHashMapInterface * const CCHashMapRobinHood = &CCHashMapRobinHoodInterface;
+
+
+#define MIN_CAPACITY 16
+
+#define ENTRY_USED 1
+#define ENTRY_INITIALIZED 2
+
+static inline uint32_t MixHash(uintmax_t Hash)
+{
+    //Spread the bits so keys hashed to themselves (the default) don't all cluster together
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdULL;
+    Hash ^= Hash >> 33;
+    
+    return (uint32_t)Hash;
+}
+
+static inline size_t CapacityForBucketCount(size_t BucketCount)
+{
+    return BucketCount > MIN_CAPACITY ? CCBitNextPowerOf2(BucketCount) : MIN_CAPACITY;
+}
+
+static inline size_t MaxLoad(size_t Capacity)
+{
+    return Capacity - (Capacity / 8);
+}
+
+static inline void *GetEntryKey(CCHashMap Map, size_t Entry)
+{
+    return ((CCHashMapRobinHoodInternal*)Map->internal)->entries + (Entry * (Map->keySize + Map->valueSize));
+}
+
+static inline void *GetEntryValue(CCHashMap Map, size_t Entry)
+{
+    return GetEntryKey(Map, Entry) + Map->keySize;
+}
+
+static _Bool CreateTable(CCHashMap Map, size_t Capacity)
+{
+    CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    const size_t HashOffset = Capacity * sizeof(CCHashMapRobinHoodSlot);
+    const size_t StateOffset = HashOffset + (MaxLoad(Capacity) * sizeof(uint32_t));
+    const size_t EntryOffset = (StateOffset + MaxLoad(Capacity) + 15) & ~(size_t)15;
+    void *Table = CCMalloc(Map->allocator, EntryOffset + (MaxLoad(Capacity) * (Map->keySize + Map->valueSize)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Table) return FALSE;
+    
+    memset(Table, 0, HashOffset);
+    memset(Table + StateOffset, 0, MaxLoad(Capacity));
+    
+    Internal->capacity = Capacity;
+    Internal->entryCount = 0;
+    Internal->slots = Table;
+    Internal->hashes = Table + HashOffset;
+    Internal->state = Table + StateOffset;
+    Internal->entries = Table + EntryOffset;
+    
+    return TRUE;
+}
+
+static _Bool FindSlot(CCHashMap Map, const void *Key, uint32_t Hash, size_t *Slot)
+{
+    const CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    if (!Internal->slots) return FALSE;
+    
+    const size_t Mask = Internal->capacity - 1;
+    
+    /*
+     An entry can never be further from its ideal slot than the key would be at that point, otherwise the
+     key would've displaced it when inserted. So the probe can stop at the first such entry (or empty slot).
+     */
+    for (size_t Index = Hash & Mask, Distance = 1; Internal->slots[Index].distance >= Distance; Index = (Index + 1) & Mask, Distance++)
+    {
+        if (Internal->slots[Index].hash == Hash)
+        {
+            const void *EntryKey = GetEntryKey(Map, Internal->slots[Index].entry);
+            
+            if (Map->compareKeys ? Map->compareKeys(Key, EntryKey) == CCComparisonResultEqual : !memcmp(Key, EntryKey, Map->keySize))
+            {
+                *Slot = Index;
+                return TRUE;
+            }
+        }
+    }
+    
+    return FALSE;
+}
+
+static void InsertSlot(CCHashMapRobinHoodInternal *Internal, size_t Entry, uint32_t Hash)
+{
+    const size_t Mask = Internal->capacity - 1;
+    
+    CCHashMapRobinHoodSlot Slot = { .entry = Entry, .hash = Hash, .distance = 1 };
+    for (size_t Index = Hash & Mask; ; Index = (Index + 1) & Mask, Slot.distance++)
+    {
+        if (!Internal->slots[Index].distance)
+        {
+            Internal->slots[Index] = Slot;
+            break;
+        }
+        
+        else if (Internal->slots[Index].distance < Slot.distance)
+        {
+            const CCHashMapRobinHoodSlot Displaced = Internal->slots[Index];
+            Internal->slots[Index] = Slot;
+            Slot = Displaced;
+        }
+    }
+}
+
+static CCHashMapEntry AddValue(CCHashMap Map, uint32_t Hash, const void *Key, const void *Value)
+{
+    CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    if (!Internal->slots)
+    {
+        if (!CreateTable(Map, Internal->capacity)) return 0;
+    }
+    
+    else if (Internal->entryCount == MaxLoad(Internal->capacity))
+    {
+        //Only grow if the map is actually full, otherwise it's cheaper to compact the removed entries
+        CCHashMapRehash(Map, Internal->count >= (Internal->capacity / 2) ? Internal->capacity * 2 : Internal->capacity);
+        
+        if (Internal->entryCount == MaxLoad(Internal->capacity))
+        {
+            CC_LOG_ERROR("Failed to insert into hashmap (%p): No available slots", Map);
+            return 0;
+        }
+    }
+    
+    const size_t Entry = Internal->entryCount++;
+    
+    memcpy(GetEntryKey(Map, Entry), Key, Map->keySize);
+    if (Value) memcpy(GetEntryValue(Map, Entry), Value, Map->valueSize);
+    Internal->state[Entry] = ENTRY_USED | (Value ? ENTRY_INITIALIZED : 0);
+    Internal->hashes[Entry] = Hash;
+    
+    InsertSlot(Internal, Entry, Hash);
+    Internal->count++;
+    
+    return Entry + 1;
+}
+
+static void RemoveSlot(CCHashMap Map, size_t Index)
+{
+    CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    Internal->state[Internal->slots[Index].entry] = 0;
+    Internal->count--;
+    
+    //Reclaim any trailing removed entries, so insert/remove churn doesn't require compaction
+    while ((Internal->entryCount) && (!Internal->state[Internal->entryCount - 1])) Internal->entryCount--;
+    
+    //Backward shift the following displaced slots, so no tombstone is needed
+    const size_t Mask = Internal->capacity - 1;
+    for (size_t Next = (Index + 1) & Mask; Internal->slots[Next].distance > 1; Index = Next, Next = (Next + 1) & Mask)
+    {
+        Internal->slots[Index] = Internal->slots[Next];
+        Internal->slots[Index].distance--;
+    }
+    
+    Internal->slots[Index].distance = 0;
+}
+
+static void *CCHashMapRobinHoodConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount)
+{
+    CCHashMapRobinHoodInternal *Map = CCMalloc(Allocator, sizeof(CCHashMapRobinHoodInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Map)
+    {
+        *Map = (CCHashMapRobinHoodInternal){
+            .count = 0,
+            .capacity = CapacityForBucketCount(BucketCount),
+            .entryCount = 0,
+            .slots = NULL,
+            .hashes = NULL,
+            .state = NULL,
+            .entries = NULL
+        };
+    }
+    
+    return Map;
+}
+
+static void CCHashMapRobinHoodDestructor(CCHashMapRobinHoodInternal *Internal)
+{
+    if (Internal->slots) CC_SAFE_Free(Internal->slots);
+    
+    CC_SAFE_Free(Internal);
+}
+
+static size_t CCHashMapRobinHoodGetCount(CCHashMap Map)
+{
+    return ((CCHashMapRobinHoodInternal*)Map->internal)->count;
+}
+
+static void CCHashMapRobinHoodRehash(CCHashMap Map, size_t BucketCount)
+{
+    CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    size_t Capacity = CapacityForBucketCount(BucketCount);
+    while (MaxLoad(Capacity) <= Internal->count) Capacity *= 2;
+    
+    if (!Internal->slots)
+    {
+        Internal->capacity = Capacity;
+        return;
+    }
+    
+    //Nothing to do if the size is unchanged and there are no removed entries
+    if ((Capacity == Internal->capacity) && (Internal->entryCount == Internal->count)) return;
+    
+    const CCHashMapRobinHoodInternal Old = *Internal;
+    if (!CreateTable(Map, Capacity)) return;
+    
+    const size_t EntrySize = Map->keySize + Map->valueSize;
+    for (size_t Loop = 0; Loop < Old.capacity; Loop++)
+    {
+        if (Old.slots[Loop].distance)
+        {
+            const size_t Entry = Internal->entryCount++;
+            
+            memcpy(Internal->entries + (Entry * EntrySize), Old.entries + (Old.slots[Loop].entry * EntrySize), EntrySize);
+            Internal->state[Entry] = Old.state[Old.slots[Loop].entry];
+            Internal->hashes[Entry] = Old.slots[Loop].hash;
+            
+            InsertSlot(Internal, Entry, Old.slots[Loop].hash);
+        }
+    }
+    
+    CCFree(Old.slots);
+}
+
+static void CCHashMapRobinHoodBuild(CCHashMap Map, const void *Keys, const void *Values, const uintmax_t *Hashes, size_t Count)
+{
+    CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    CCAssertLog(!Internal->slots, "Map must be empty");
+    
+    //Size the table so it never needs to grow while adding the entries
+    size_t Capacity = CapacityForBucketCount(Count);
+    while (MaxLoad(Capacity) < Count) Capacity *= 2;
+    
+    Internal->capacity = Capacity;
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const void *Key = Keys + (Loop * Map->keySize), *Value = Values ? Values + (Loop * Map->valueSize) : NULL;
+        const uint32_t Hash = MixHash(Hashes[Loop]);
+        
+        size_t Slot;
+        if (FindSlot(Map, Key, Hash, &Slot))
+        {
+            if (Value)
+            {
+                memcpy(GetEntryValue(Map, Internal->slots[Slot].entry), Value, Map->valueSize);
+                Internal->state[Internal->slots[Slot].entry] |= ENTRY_INITIALIZED;
+            }
+        }
+        
+        else AddValue(Map, Hash, Key, Value);
+    }
+}
+
+static _Bool CCHashMapRobinHoodEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry)
+{
+    if (Entry)
+    {
+        const uint8_t State = ((CCHashMapRobinHoodInternal*)Map->internal)->state[Entry - 1];
+        
+        CCAssertLog(State & ENTRY_USED, "Entry has been removed");
+        
+        return State & ENTRY_INITIALIZED;
+    }
+    
+    return FALSE;
+}
+
+static CCHashMapEntry CCHashMapRobinHoodFindKey(CCHashMap Map, const void *Key)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(CCHashMapGetKeyHash(Map, Key)), &Slot)) return ((CCHashMapRobinHoodInternal*)Map->internal)->slots[Slot].entry + 1;
+    
+    return 0;
+}
+
+static CCHashMapEntry CCHashMapRobinHoodFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(Hash), &Slot)) return ((CCHashMapRobinHoodInternal*)Map->internal)->slots[Slot].entry + 1;
+    
+    return 0;
+}
+
+static void CCHashMapRobinHoodPrefetch(CCHashMap Map, uintmax_t Hash)
+{
+    const CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    if (Internal->slots) CC_PREFETCH(&Internal->slots[MixHash(Hash) & (Internal->capacity - 1)]);
+}
+
+static CCHashMapEntry CCHashMapRobinHoodEntryForKey(CCHashMap Map, const void *Key, _Bool *Created)
+{
+    const uint32_t Hash = MixHash(CCHashMapGetKeyHash(Map, Key));
+    
+    size_t Slot;
+    if (FindSlot(Map, Key, Hash, &Slot))
+    {
+        if (Created) *Created = FALSE;
+        return ((CCHashMapRobinHoodInternal*)Map->internal)->slots[Slot].entry + 1;
+    }
+    
+    else
+    {
+        if (Created) *Created = TRUE;
+        return AddValue(Map, Hash, Key, NULL);
+    }
+}
+
+static void *CCHashMapRobinHoodGetKey(CCHashMap Map, CCHashMapEntry Entry)
+{
+    void *Key = NULL;
+    if (Entry)
+    {
+        CCAssertLog(((CCHashMapRobinHoodInternal*)Map->internal)->state[Entry - 1] & ENTRY_USED, "Entry has been removed");
+        
+        Key = GetEntryKey(Map, Entry - 1);
+    }
+    
+    return Key;
+}
+
+static void *CCHashMapRobinHoodGetEntry(CCHashMap Map, CCHashMapEntry Entry)
+{
+    void *Value = NULL;
+    if (Entry)
+    {
+        CCAssertLog(((CCHashMapRobinHoodInternal*)Map->internal)->state[Entry - 1] & ENTRY_USED, "Entry has been removed");
+        
+        Value = GetEntryValue(Map, Entry - 1);
+    }
+    
+    return Value;
+}
+
+static void CCHashMapRobinHoodSetEntry(CCHashMap Map, CCHashMapEntry Entry, const void *Value)
+{
+    if (Entry)
+    {
+        uint8_t *State = &((CCHashMapRobinHoodInternal*)Map->internal)->state[Entry - 1];
+        
+        CCAssertLog(*State & ENTRY_USED, "Entry has been removed");
+        
+        *State |= ENTRY_INITIALIZED;
+        memcpy(GetEntryValue(Map, Entry - 1), Value, Map->valueSize);
+    }
+}
+
+static void CCHashMapRobinHoodRemoveEntry(CCHashMap Map, CCHashMapEntry Entry)
+{
+    if (Entry)
+    {
+        const CCHashMapRobinHoodInternal *Internal = Map->internal;
+        
+        CCAssertLog(Internal->state[Entry - 1] & ENTRY_USED, "Entry has been removed");
+        
+        //The key is not rehashed, as it may have already been destroyed by the owner
+        const size_t Mask = Internal->capacity - 1;
+        size_t Index = Internal->hashes[Entry - 1] & Mask;
+        while (Internal->slots[Index].entry != (Entry - 1) || !Internal->slots[Index].distance) Index = (Index + 1) & Mask;
+        
+        RemoveSlot(Map, Index);
+    }
+}
+
+static void *CCHashMapRobinHoodGetValue(CCHashMap Map, const void *Key)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(CCHashMapGetKeyHash(Map, Key)), &Slot)) return GetEntryValue(Map, ((CCHashMapRobinHoodInternal*)Map->internal)->slots[Slot].entry);
+    
+    return NULL;
+}
+
+static void CCHashMapRobinHoodSetValue(CCHashMap Map, const void *Key, const void *Value)
+{
+    const uint32_t Hash = MixHash(CCHashMapGetKeyHash(Map, Key));
+    
+    size_t Slot;
+    if (FindSlot(Map, Key, Hash, &Slot))
+    {
+        CCHashMapRobinHoodInternal *Internal = Map->internal;
+        const size_t Entry = Internal->slots[Slot].entry;
+        
+        Internal->state[Entry] |= ENTRY_INITIALIZED;
+        memcpy(GetEntryValue(Map, Entry), Value, Map->valueSize);
+    }
+    
+    else AddValue(Map, Hash, Key, Value);
+}
+
+static void CCHashMapRobinHoodRemoveValue(CCHashMap Map, const void *Key)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(CCHashMapGetKeyHash(Map, Key)), &Slot)) RemoveSlot(Map, Slot);
+}
+
+static CCOrderedCollection CCHashMapRobinHoodGetKeys(CCHashMap Map)
+{
+    const CCHashMapRobinHoodInternal *Internal = Map->internal;
+    CCOrderedCollection Keys = CCCollectionCreate(Map->allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Map->keySize, NULL);
+    
+    for (size_t Loop = 0; Loop < Internal->entryCount; Loop++)
+    {
+        if (Internal->state[Loop]) CCOrderedCollectionAppendElement(Keys, GetEntryKey(Map, Loop));
+    }
+    
+    return Keys;
+}
+
+static CCOrderedCollection CCHashMapRobinHoodGetValues(CCHashMap Map)
+{
+    const CCHashMapRobinHoodInternal *Internal = Map->internal;
+    CCOrderedCollection Values = CCCollectionCreate(Map->allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Map->valueSize, NULL);
+    
+    for (size_t Loop = 0; Loop < Internal->entryCount; Loop++)
+    {
+        if (Internal->state[Loop]) CCOrderedCollectionAppendElement(Values, GetEntryValue(Map, Loop));
+    }
+    
+    return Values;
+}
+
+static CCHashMapEntry GetNextEntry(CCHashMap Map, size_t Entry)
+{
+    const CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    for ( ; Entry < Internal->entryCount; Entry++)
+    {
+        if (Internal->state[Entry]) return Entry + 1;
+    }
+    
+    return 0;
+}
+
+static CCHashMapEntry GetPrevEntry(CCHashMap Map, size_t Entry)
+{
+    const CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    for ( ; Entry > 0; Entry--)
+    {
+        if (Internal->state[Entry - 1]) return Entry;
+    }
+    
+    return 0;
+}
+
+static void *CCHashMapRobinHoodEnumerator(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorAction Action, CCHashMapEnumeratorType Type)
+{
+    void *(*GetElement)(CCHashMap, CCHashMapEntry) = Type == CCHashMapEnumeratorTypeKey ? CCHashMapRobinHoodGetKey : CCHashMapRobinHoodGetEntry;
+    
+    switch (Action)
+    {
+        case CCCollectionEnumeratorActionHead:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetNextEntry(Map, 0);
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionTail:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetPrevEntry(Map, ((CCHashMapRobinHoodInternal*)Map->internal)->entryCount);
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionNext:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetNextEntry(Map, Enumerator->internal.extra[0]) : 0;
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionPrevious:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetPrevEntry(Map, Enumerator->internal.extra[0] - 1) : 0;
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionCurrent:
+            break;
+    }
+    
+    return Enumerator->internal.ptr;
+}
+
+static CCHashMapEntry CCHashMapRobinHoodEnumeratorEntry(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorType Type)
+{
+    return Enumerator->internal.extra[0];
+}
+
+static size_t CCHashMapRobinHoodGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values)
+{
+    const CCHashMapRobinHoodInternal *Internal = Map->internal;
+    
+    //The cursor holds the entry following the previous batch
+    size_t Entry = Cursor->internal.extra[0];
+    while ((Entry < Internal->entryCount) && (!Internal->state[Entry])) Entry++;
+    
+    size_t Count = 0;
+    while ((Entry + Count < Internal->entryCount) && (Internal->state[Entry + Count])) Count++;
+    
+    if (!Count) return 0;
+    
+    Cursor->internal.extra[0] = Entry + Count;
+    
+    if (Keys) *Keys = (CCEnumeratorState){ .batch = { .ptr = GetEntryKey(Map, Entry), .count = Count, .stride = Map->keySize + Map->valueSize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+    if (Values) *Values = (CCEnumeratorState){ .batch = { .ptr = GetEntryValue(Map, Entry), .count = Count, .stride = Map->keySize + Map->valueSize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+    
+    return Count;
+}
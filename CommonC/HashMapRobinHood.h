@@ -0,0 +1,54 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCHashMapRobinHood
+ * CCHashMapRobinHood is an interface for an open addressing hashmap implementation using Robin Hood
+ * hashing. Every slot stores the probe distance of its entry, an insertion will displace any entry that
+ * is closer to its ideal slot, which keeps probe lengths short even at high load factors and allows a
+ * lookup to terminate as soon as it reaches an entry closer to its ideal slot than the key would be.
+ *
+ * Removals use backward shift deletion, so no tombstones are ever left behind.
+ *
+ * The slots only reference the keys and values, which are stored densely in a separate array. This keeps
+ * entry references valid across other insertions and removals. The bucket count is used as the minimum
+ * slot capacity (rounded up to a power of 2). The map will grow itself (or compact the removed entries)
+ * if it becomes too full, at which point any entry references will be invalidated.
+ *
+ * Fast Operations:
+ * - Lookup.
+ * - Insertion.
+ * - Removal.
+ * - Enumerating of keys.
+ * - Enumerating of values.
+ */
+#ifndef CommonC_HashMapRobinHood_h
+#define CommonC_HashMapRobinHood_h
+
+#include <CommonC/HashMapInterface.h>
+
+extern const CCHashMapInterface * const CCHashMapRobinHood;
+
+#endif
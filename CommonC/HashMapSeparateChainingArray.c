@@ -36,13 +36,21 @@
 typedef struct {
     size_t count;
     CCArray buckets;
+    struct {
+        CCArray buckets;
+        size_t index;
+    } rehash;
 } CCHashMapSeparateChainingArrayInternal;
 
 static void *CCHashMapSeparateChainingArrayConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount);
 static void CCHashMapSeparateChainingArrayDestructor(CCHashMapSeparateChainingArrayInternal *Internal);
 static size_t CCHashMapSeparateChainingArrayGetCount(CCHashMap Map);
+static void CCHashMapSeparateChainingArrayRehash(CCHashMap Map, size_t BucketCount);
 static _Bool CCHashMapSeparateChainingArrayEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry);
 static CCHashMapEntry CCHashMapSeparateChainingArrayFindKey(CCHashMap Map, const void *Key);
+static CCHashMapEntry CCHashMapSeparateChainingArrayFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash);
+static void CCHashMapSeparateChainingArrayPrefetch(CCHashMap Map, uintmax_t Hash);
+static void CCHashMapSeparateChainingArrayBuild(CCHashMap Map, const void *Keys, const void *Values, const uintmax_t *Hashes, size_t Count);
 static CCHashMapEntry CCHashMapSeparateChainingArrayEntryForKey(CCHashMap Map, const void *Key, _Bool *Created);
 static void *CCHashMapSeparateChainingArrayGetKey(CCHashMap Map, CCHashMapEntry Entry);
 static void *CCHashMapSeparateChainingArrayGetEntry(CCHashMap Map, CCHashMapEntry Entry);
@@ -55,6 +63,7 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayGetKeys(CCHashMap Map);
 static CCOrderedCollection CCHashMapSeparateChainingArrayGetValues(CCHashMap Map);
 static void *CCHashMapSeparateChainingArrayEnumerator(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorAction Action, CCHashMapEnumeratorType Type);
 static CCHashMapEntry CCHashMapSeparateChainingArrayEnumeratorEntry(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorType Type);
+static size_t CCHashMapSeparateChainingArrayGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values);
 
 
 const CCHashMapInterface CCHashMapSeparateChainingArrayInterface = {
@@ -71,21 +80,42 @@ const CCHashMapInterface CCHashMapSeparateChainingArrayInterface = {
     .enumerator = CCHashMapSeparateChainingArrayEnumerator,
     .enumeratorReference = CCHashMapSeparateChainingArrayEnumeratorEntry,
     .optional = {
-        .rehash = NULL,
+        .rehash = CCHashMapSeparateChainingArrayRehash,
         .getValue = CCHashMapSeparateChainingArrayGetValue,
         .setValue = CCHashMapSeparateChainingArraySetValue,
         .removeValue = CCHashMapSeparateChainingArrayRemoveValue,
         .keys = CCHashMapSeparateChainingArrayGetKeys,
-        .values = CCHashMapSeparateChainingArrayGetValues
+        .values = CCHashMapSeparateChainingArrayGetValues,
+        .findKeyWithHash = CCHashMapSeparateChainingArrayFindKeyWithHash,
+        .prefetch = CCHashMapSeparateChainingArrayPrefetch,
+        .build = CCHashMapSeparateChainingArrayBuild,
+        .batch = CCHashMapSeparateChainingArrayGetNextBatch
     }
 };
 
 const CCHashMapInterface * const CCHashMapSeparateChainingArray = &CCHashMapSeparateChainingArrayInterface;
 
 
+static inline size_t GetBucketCount(CCHashMap Map)
+{
+    const CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    return Map->bucketCount + (Internal->rehash.buckets ? CCArrayGetCount(Internal->rehash.buckets) : 0);
+}
+
+static inline CCArray *GetBucket(CCHashMap Map, size_t BucketIndex)
+{
+    const CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    //Indexes past the current buckets refer to the buckets of a rehash still in progress
+    if (BucketIndex < Map->bucketCount) return CCArrayGetElementAtIndex(Internal->buckets, BucketIndex);
+    
+    return CCArrayGetElementAtIndex(Internal->rehash.buckets, BucketIndex - Map->bucketCount);
+}
+
 static CCHashMapEntry IndexToEntry(CCHashMap Map, size_t BucketIndex, size_t ItemIndex)
 {
-    const uintmax_t BucketMask = CCBitMaskForValue(Map->bucketCount + 1);
+    const uintmax_t BucketMask = CCBitMaskForValue(GetBucketCount(Map) + 1);
     const uintmax_t ItemMask = ~BucketMask, ItemShift = CCBitCountSet(BucketMask);
     
     if ((ItemIndex & (ItemMask >> ItemShift)) == ItemIndex)
@@ -93,7 +123,7 @@ static CCHashMapEntry IndexToEntry(CCHashMap Map, size_t BucketIndex, size_t Ite
         return (ItemIndex << ItemShift) | (BucketIndex + 1);
     }
     
-    CC_LOG_WARNING("HashMap bucket size (%zu, %zu) exceeds representable threshold for an entry reference", Map->bucketCount, CCArrayGetCount(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayInternal*)Map->internal)->buckets, BucketIndex)));
+    CC_LOG_WARNING("HashMap bucket size (%zu, %zu) exceeds representable threshold for an entry reference", Map->bucketCount, CCArrayGetCount(*(CCArray*)GetBucket(Map, BucketIndex)));
     
     return 0;
 }
@@ -102,7 +132,7 @@ static _Bool EntryToIndex(CCHashMap Map, CCHashMapEntry Entry, size_t *BucketInd
 {
     if (Entry)
     {
-        const uintmax_t BucketMask = CCBitMaskForValue(Map->bucketCount + 1);
+        const uintmax_t BucketMask = CCBitMaskForValue(GetBucketCount(Map) + 1);
         const uintmax_t ItemMask = ~BucketMask;
         
         *BucketIndex = (Entry & BucketMask) - 1;
@@ -158,12 +188,9 @@ static inline void SetItemValue(CCHashMap Map, void *Item, const void *Value)
     memcpy(Item + sizeof(uintmax_t) + Map->keySize, Value, Map->valueSize);
 }
 
-static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
+static size_t InsertValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
 {
     CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
-    Internal->count++;
-    
-    if (Value) Hash |= HASH_INIT_BIT;
     
     //hash/key/value
     if (!Internal->buckets)
@@ -175,7 +202,7 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, BucketIndex);
     if (!Bucket)
     {
-        Bucket = CCArrayCreate(Map->allocator, sizeof(uintmax_t) + Map->keySize + Map->valueSize, 1);
+        Bucket = CCArrayCreateSmall(Map->allocator, sizeof(uintmax_t) + Map->keySize + Map->valueSize, 1, CC_HASH_MAP_BUCKET_INLINE_COUNT);
         CCArrayReplaceElementAtIndex(Internal->buckets, BucketIndex, &Bucket);
     }
     
@@ -204,6 +231,53 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     return Index;
 }
 
+static void MigrateBuckets(CCHashMap Map, size_t Count)
+{
+    CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    if (!Internal->rehash.buckets) return;
+    
+    for (const size_t OldCount = CCArrayGetCount(Internal->rehash.buckets); (Count--) && (Internal->rehash.index < OldCount); Internal->rehash.index++)
+    {
+        CCArray *Slot = CCArrayGetElementAtIndex(Internal->rehash.buckets, Internal->rehash.index);
+        if (*Slot)
+        {
+            for (size_t Loop = 0, ItemCount = CCArrayGetCount(*Slot); Loop < ItemCount; Loop++)
+            {
+                void *Item = CCArrayGetElementAtIndex(*Slot, Loop);
+                const uintmax_t Hash = *GetItemHash(Map, Item);
+                if (!HashIsEmpty(Hash))
+                {
+                    InsertValue(Map, (Hash & HASH_RESERVED_MASK) % Map->bucketCount, Hash, GetItemKey(Map, Item), HashIsInitialized(Hash) ? GetItemValue(Map, Item) : NULL);
+                }
+            }
+            
+            CCArrayDestroy(*Slot);
+            *Slot = NULL;
+        }
+    }
+    
+    if (Internal->rehash.index == CCArrayGetCount(Internal->rehash.buckets))
+    {
+        CCArrayDestroy(Internal->rehash.buckets);
+        Internal->rehash.buckets = NULL;
+        Internal->rehash.index = 0;
+    }
+}
+
+static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
+{
+    CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    MigrateBuckets(Map, CC_HASH_MAP_INCREMENTAL_REHASH_STEP);
+    
+    Internal->count++;
+    
+    if (Value) Hash |= HASH_INIT_BIT;
+    
+    return InsertValue(Map, BucketIndex, Hash, Key, Value);
+}
+
 static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
 {
     if (Entry)
@@ -213,7 +287,7 @@ static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
         {
             CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
             
-            uintmax_t *Hash = GetItemHash(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, BucketIndex), ItemIndex));
+            uintmax_t *Hash = GetItemHash(Map, CCArrayGetElementAtIndex(*(CCArray*)GetBucket(Map, BucketIndex), ItemIndex));
             
             CCAssertLog(!HashIsEmpty(*Hash), "Hash has been removed");
             
@@ -224,9 +298,41 @@ static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
     }
 }
 
-static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+static _Bool FindInBucket(CCHashMap Map, CCArray Bucket, const void *Key, uintmax_t Hash, size_t *ItemIndex)
 {
-    const uintmax_t Hash = CCHashMapGetKeyHash(Map, Key) & HASH_RESERVED_MASK;
+    if (Bucket)
+    {
+        for (size_t Loop = 0, Count = CCArrayGetCount(Bucket); Loop < Count; Loop++)
+        {
+            void *Item = CCArrayGetElementAtIndex(Bucket, Loop);
+            const uintmax_t EntryHash = *GetItemHash(Map, Item) & ~HASH_INIT_BIT;
+            if (Hash == EntryHash)
+            {
+                const void *EntryKey = GetItemKey(Map, Item);
+                if (Map->compareKeys)
+                {
+                    if (Map->compareKeys(Key, EntryKey) == CCComparisonResultEqual)
+                    {
+                        *ItemIndex = Loop;
+                        return TRUE;
+                    }
+                }
+                
+                else if (!memcmp(Key, EntryKey, Map->keySize))
+                {
+                    *ItemIndex = Loop;
+                    return TRUE;
+                }
+            }
+        }
+    }
+    
+    return FALSE;
+}
+
+static _Bool GetKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+{
+    Hash &= HASH_RESERVED_MASK;
     const size_t Index = Hash % Map->bucketCount;
     
     if (HashValue) *HashValue = Hash;
@@ -236,31 +342,15 @@ static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t
     
     if (Internal->buckets)
     {
-        CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Index);
-        if (Bucket)
+        if (FindInBucket(Map, *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Index), Key, Hash, ItemIndex)) return TRUE;
+        
+        if (Internal->rehash.buckets)
         {
-            for (size_t Loop = 0, Count = CCArrayGetCount(Bucket); Loop < Count; Loop++)
+            const size_t OldIndex = Hash % CCArrayGetCount(Internal->rehash.buckets);
+            if ((OldIndex >= Internal->rehash.index) && (FindInBucket(Map, *(CCArray*)CCArrayGetElementAtIndex(Internal->rehash.buckets, OldIndex), Key, Hash, ItemIndex)))
             {
-                void *Item = CCArrayGetElementAtIndex(Bucket, Loop);
-                const uintmax_t EntryHash = *GetItemHash(Map, Item) & ~HASH_INIT_BIT;
-                if (Hash == EntryHash)
-                {
-                    const void *EntryKey = GetItemKey(Map, Item);
-                    if (Map->compareKeys)
-                    {
-                        if (Map->compareKeys(Key, EntryKey) == CCComparisonResultEqual)
-                        {
-                            *ItemIndex = Loop;
-                            return TRUE;
-                        }
-                    }
-                    
-                    else if (!memcmp(Key, EntryKey, Map->keySize))
-                    {
-                        *ItemIndex = Loop;
-                        return TRUE;
-                    }
-                }
+                *BucketIndex = Map->bucketCount + OldIndex;
+                return TRUE;
             }
         }
     }
@@ -268,6 +358,11 @@ static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t
     return FALSE;
 }
 
+static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+{
+    return GetKeyWithHash(Map, Key, CCHashMapGetKeyHash(Map, Key), HashValue, BucketIndex, ItemIndex);
+}
+
 static void *CCHashMapSeparateChainingArrayConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount)
 {
     CCHashMapSeparateChainingArrayInternal *Map = CCMalloc(Allocator, sizeof(CCHashMapSeparateChainingArrayInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
@@ -275,7 +370,11 @@ static void *CCHashMapSeparateChainingArrayConstructor(CCAllocatorType Allocator
     {
         *Map = (CCHashMapSeparateChainingArrayInternal){
             .count = 0,
-            .buckets = NULL
+            .buckets = NULL,
+            .rehash = {
+                .buckets = NULL,
+                .index = 0
+            }
         };
     }
     
@@ -296,10 +395,115 @@ static void BucketDestroy(CCArray Buckets)
 static void CCHashMapSeparateChainingArrayDestructor(CCHashMapSeparateChainingArrayInternal *Internal)
 {
     if (Internal->buckets) BucketDestroy(Internal->buckets);
+    if (Internal->rehash.buckets) BucketDestroy(Internal->rehash.buckets);
     
     CC_SAFE_Free(Internal);
 }
 
+static CCArray CreateBuckets(CCHashMap Map, size_t BucketCount)
+{
+    CCArray Buckets = CCArrayCreate(Map->allocator, sizeof(CCArray), BucketCount);
+    for (size_t Loop = 0; Loop < BucketCount; Loop++) CCArrayAppendElement(Buckets, &(CCArray){ NULL });
+    
+    return Buckets;
+}
+
+static void CCHashMapSeparateChainingArrayRehash(CCHashMap Map, size_t BucketCount)
+{
+    CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    if (!Internal->buckets) return;
+    
+    MigrateBuckets(Map, SIZE_MAX);
+    
+    if (!Internal->count)
+    {
+        BucketDestroy(Internal->buckets);
+        Internal->buckets = NULL;
+        
+        return;
+    }
+    
+    Internal->rehash.buckets = Internal->buckets;
+    Internal->rehash.index = 0;
+    
+    Internal->buckets = CreateBuckets(Map, BucketCount);
+}
+
+static void CCHashMapSeparateChainingArrayBuild(CCHashMap Map, const void *Keys, const void *Values, const uintmax_t *Hashes, size_t Count)
+{
+    CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    CCAssertLog(!Internal->buckets, "Map must be empty");
+    
+    size_t *Offsets = CCMalloc(CC_STD_ALLOCATOR, sizeof(size_t) * Map->bucketCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    size_t *Order = CCMalloc(CC_STD_ALLOCATOR, sizeof(size_t) * Count, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    if ((!Offsets) || (!Order))
+    {
+        if (Offsets) CCFree(Offsets);
+        if (Order) CCFree(Order);
+        
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCHashMapEntry Entry = CCHashMapSeparateChainingArrayEntryForKey(Map, Keys + (Loop * Map->keySize), NULL);
+            if (Values) CCHashMapSeparateChainingArraySetEntry(Map, Entry, Values + (Loop * Map->valueSize));
+        }
+        
+        return;
+    }
+    
+    //Partition the keys by bucket (preserving their order), so each bucket can be filled in one pass at its final size
+    memset(Offsets, 0, sizeof(size_t) * Map->bucketCount);
+    for (size_t Loop = 0; Loop < Count; Loop++) Offsets[(Hashes[Loop] & HASH_RESERVED_MASK) % Map->bucketCount]++;
+    
+    for (size_t Loop = 0, Offset = 0; Loop < Map->bucketCount; Loop++)
+    {
+        const size_t Size = Offsets[Loop];
+        Offsets[Loop] = Offset;
+        Offset += Size;
+    }
+    
+    for (size_t Loop = 0; Loop < Count; Loop++) Order[Offsets[(Hashes[Loop] & HASH_RESERVED_MASK) % Map->bucketCount]++] = Loop;
+    
+    //Each offset now marks the end of its bucket's partition
+    Internal->buckets = CreateBuckets(Map, Map->bucketCount);
+    for (size_t Loop = 0, Start = 0; Loop < Map->bucketCount; Start = Offsets[Loop++])
+    {
+        if (Start == Offsets[Loop]) continue;
+        
+        CCArray Bucket = CCArrayCreateSmall(Map->allocator, sizeof(uintmax_t) + Map->keySize + Map->valueSize, Offsets[Loop] - Start, Offsets[Loop] - Start);
+        CCArrayReplaceElementAtIndex(Internal->buckets, Loop, &Bucket);
+        
+        for (size_t Index = Start; Index < Offsets[Loop]; Index++)
+        {
+            const size_t Entry = Order[Index];
+            const void *Key = Keys + (Entry * Map->keySize);
+            const uintmax_t Hash = Hashes[Entry] & HASH_RESERVED_MASK;
+            
+            size_t ItemIndex;
+            if (!FindInBucket(Map, Bucket, Key, Hash, &ItemIndex))
+            {
+                ItemIndex = CCArrayAppendElement(Bucket, NULL);
+                SetItemKey(Map, CCArrayGetElementAtIndex(Bucket, ItemIndex), Key);
+                Internal->count++;
+            }
+            
+            void *Item = CCArrayGetElementAtIndex(Bucket, ItemIndex);
+            if (Values)
+            {
+                SetItemHash(Map, Item, Hash | HASH_INIT_BIT);
+                SetItemValue(Map, Item, Values + (Entry * Map->valueSize));
+            }
+            
+            else SetItemHash(Map, Item, Hash);
+        }
+    }
+    
+    CCFree(Offsets);
+    CCFree(Order);
+}
+
 static size_t CCHashMapSeparateChainingArrayGetCount(CCHashMap Map)
 {
     return ((CCHashMapSeparateChainingArrayInternal*)Map->internal)->count;
@@ -311,7 +515,7 @@ static _Bool CCHashMapSeparateChainingArrayEntryIsInitialized(CCHashMap Map, CCH
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        const uintmax_t Hash = *GetItemHash(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayInternal*)Map->internal)->buckets, BucketIndex), ItemIndex));
+        const uintmax_t Hash = *GetItemHash(Map, CCArrayGetElementAtIndex(*(CCArray*)GetBucket(Map, BucketIndex), ItemIndex));
         
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(Hash), "Entry has been removed");
@@ -334,6 +538,24 @@ static CCHashMapEntry CCHashMapSeparateChainingArrayFindKey(CCHashMap Map, const
     return 0;
 }
 
+static CCHashMapEntry CCHashMapSeparateChainingArrayFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash)
+{
+    size_t BucketIndex, ItemIndex;
+    if (GetKeyWithHash(Map, Key, Hash, NULL, &BucketIndex, &ItemIndex))
+    {
+        return IndexToEntry(Map, BucketIndex, ItemIndex);
+    }
+    
+    return 0;
+}
+
+static void CCHashMapSeparateChainingArrayPrefetch(CCHashMap Map, uintmax_t Hash)
+{
+    const CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    if (Internal->buckets) CC_PREFETCH(CCArrayGetElementAtIndex(Internal->buckets, (Hash & HASH_RESERVED_MASK) % Map->bucketCount));
+}
+
 static CCHashMapEntry CCHashMapSeparateChainingArrayEntryForKey(CCHashMap Map, const void *Key, _Bool *Created)
 {
     uintmax_t Hash;
@@ -357,7 +579,7 @@ static void *CCHashMapSeparateChainingArrayGetKey(CCHashMap Map, CCHashMapEntry
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        void *Item = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayInternal*)Map->internal)->buckets, BucketIndex), ItemIndex);
+        void *Item = CCArrayGetElementAtIndex(*(CCArray*)GetBucket(Map, BucketIndex), ItemIndex);
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(*GetItemHash(Map, Item)), "Entry has been removed");
 #endif
@@ -374,7 +596,7 @@ static void *CCHashMapSeparateChainingArrayGetEntry(CCHashMap Map, CCHashMapEntr
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        void *Item = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayInternal*)Map->internal)->buckets, BucketIndex), ItemIndex);
+        void *Item = CCArrayGetElementAtIndex(*(CCArray*)GetBucket(Map, BucketIndex), ItemIndex);
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(*GetItemHash(Map, Item)), "Entry has been removed");
 #endif
@@ -390,7 +612,7 @@ static void CCHashMapSeparateChainingArraySetEntry(CCHashMap Map, CCHashMapEntry
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        void *Item = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayInternal*)Map->internal)->buckets, BucketIndex), ItemIndex);
+        void *Item = CCArrayGetElementAtIndex(*(CCArray*)GetBucket(Map, BucketIndex), ItemIndex);
         uintmax_t *Hash = GetItemHash(Map, Item);
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(*Hash), "Entry has been removed");
@@ -410,7 +632,7 @@ static void *CCHashMapSeparateChainingArrayGetValue(CCHashMap Map, const void *K
 {
     void *Value = NULL;
     size_t BucketIndex, ItemIndex;
-    if (GetKey(Map, Key, NULL, &BucketIndex, &ItemIndex)) Value = GetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayInternal*)Map->internal)->buckets, BucketIndex), ItemIndex));
+    if (GetKey(Map, Key, NULL, &BucketIndex, &ItemIndex)) Value = GetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)GetBucket(Map, BucketIndex), ItemIndex));
     
     return Value;
 }
@@ -421,7 +643,7 @@ static void CCHashMapSeparateChainingArraySetValue(CCHashMap Map, const void *Ke
     size_t BucketIndex, ItemIndex;
     if (GetKey(Map, Key, &Hash, &BucketIndex, &ItemIndex))
     {
-        void *Item = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayInternal*)Map->internal)->buckets, BucketIndex), ItemIndex);
+        void *Item = CCArrayGetElementAtIndex(*(CCArray*)GetBucket(Map, BucketIndex), ItemIndex);
         if (!HashIsInitialized(Hash))
         {
             uintmax_t *Hash = GetItemHash(Map, Item);
@@ -450,9 +672,9 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayGetKeys(CCHashMap Map)
     
     if (Internal->buckets)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->buckets); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop);
+            CCArray Bucket = *(CCArray*)GetBucket(Map, Loop);
             if (Bucket)
             {
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(Bucket); Loop2 < Count2; Loop2++)
@@ -477,9 +699,9 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayGetValues(CCHashMap Map
     
     if (Internal->buckets)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->buckets); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop);
+            CCArray Bucket = *(CCArray*)GetBucket(Map, Loop);
             if (Bucket)
             {
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(Bucket); Loop2 < Count2; Loop2++)
@@ -503,9 +725,9 @@ static CCHashMapEntry GetHeadEntry(CCHashMap Map)
     
     if (Internal->buckets)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->buckets); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop);
+            CCArray Bucket = *(CCArray*)GetBucket(Map, Loop);
             if (Bucket)
             {
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(Bucket); Loop2 < Count2; Loop2++)
@@ -528,9 +750,9 @@ static CCHashMapEntry GetTailEntry(CCHashMap Map)
     
     if (Internal->buckets)
     {
-        for (size_t Loop = CCArrayGetCount(Internal->buckets); Loop > 0; Loop--)
+        for (size_t Loop = GetBucketCount(Map); Loop > 0; Loop--)
         {
-            CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop - 1);
+            CCArray Bucket = *(CCArray*)GetBucket(Map, Loop - 1);
             if (Bucket)
             {
                 for (size_t Loop2 = CCArrayGetCount(Bucket); Loop2 > 0; Loop2--)
@@ -558,9 +780,9 @@ static CCHashMapEntry GetNextEntry(CCHashMap Map, CCHashMapEntry Entry)
         
         ItemIndex++;
         
-        for (size_t Loop = BucketIndex, Count = CCArrayGetCount(Internal->buckets); Loop < Count; Loop++)
+        for (size_t Loop = BucketIndex, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop);
+            CCArray Bucket = *(CCArray*)GetBucket(Map, Loop);
             if (Bucket)
             {
                 for (size_t Loop2 = ItemIndex, Count2 = CCArrayGetCount(Bucket); Loop2 < Count2; Loop2++)
@@ -592,7 +814,7 @@ static CCHashMapEntry GetPrevEntry(CCHashMap Map, CCHashMapEntry Entry)
         
         for (size_t Loop = BucketIndex + 1; Loop > 0; Loop--)
         {
-            CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop - 1);
+            CCArray Bucket = *(CCArray*)GetBucket(Map, Loop - 1);
             if (Bucket)
             {
                 for (size_t Loop2 = ItemIndex ? ItemIndex - 1 : CCArrayGetCount(Bucket); Loop2 > 0; Loop2--)
@@ -650,3 +872,37 @@ static CCHashMapEntry CCHashMapSeparateChainingArrayEnumeratorEntry(CCHashMap Ma
 {
     return Enumerator->internal.extra[0];
 }
+
+static size_t CCHashMapSeparateChainingArrayGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values)
+{
+    const CCHashMapSeparateChainingArrayInternal *Internal = Map->internal;
+    
+    if (!Internal->buckets) return 0;
+    
+    //The cursor holds the bucket and item following the previous batch
+    for (size_t Count = GetBucketCount(Map); Cursor->internal.extra[0] < Count; Cursor->internal.extra[0]++, Cursor->internal.extra[1] = 0)
+    {
+        CCArray Bucket = *(CCArray*)GetBucket(Map, Cursor->internal.extra[0]);
+        if (Bucket)
+        {
+            size_t Index = Cursor->internal.extra[1], ItemCount = CCArrayGetCount(Bucket);
+            while ((Index < ItemCount) && (HashIsEmpty(*GetItemHash(Map, CCArrayGetElementAtIndex(Bucket, Index))))) Index++;
+            
+            size_t BatchCount = 0;
+            while ((Index + BatchCount < ItemCount) && (!HashIsEmpty(*GetItemHash(Map, CCArrayGetElementAtIndex(Bucket, Index + BatchCount))))) BatchCount++;
+            
+            if (BatchCount)
+            {
+                Cursor->internal.extra[1] = Index + BatchCount;
+                
+                void *Item = CCArrayGetElementAtIndex(Bucket, Index);
+                if (Keys) *Keys = (CCEnumeratorState){ .batch = { .ptr = GetItemKey(Map, Item), .count = BatchCount, .stride = CCArrayGetElementSize(Bucket), .index = 0 }, .type = CCEnumeratorFormatBatch };
+                if (Values) *Values = (CCEnumeratorState){ .batch = { .ptr = GetItemValue(Map, Item), .count = BatchCount, .stride = CCArrayGetElementSize(Bucket), .index = 0 }, .type = CCEnumeratorFormatBatch };
+
+                return BatchCount;
+            }
+        }
+    }
+    
+    return 0;
+}
@@ -35,6 +35,9 @@
  * Moderate Operations:
  * - Enumerating of keys. (slower than other @b CCHashMapSeparateChainingArray* variants)
  * - Enumerating of values. (slower than other @b CCHashMapSeparateChainingArray* variants)
+ *
+ * Rehashing is performed incrementally, the old buckets are migrated over the following insertions. While
+ * a rehash is in progress, an insertion may invalidate any entry references.
  */
 #ifndef CommonC_HashMapSeparateChainingArray_h
 #define CommonC_HashMapSeparateChainingArray_h
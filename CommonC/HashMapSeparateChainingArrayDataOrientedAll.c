@@ -38,13 +38,22 @@ typedef struct {
     CCArray hashes;
     CCArray keys;
     CCArray values;
+    struct {
+        CCArray hashes;
+        CCArray keys;
+        CCArray values;
+        size_t index;
+    } rehash;
 } CCHashMapSeparateChainingArrayDataOrientedAllInternal;
 
 static void *CCHashMapSeparateChainingArrayDataOrientedAllConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount);
 static void CCHashMapSeparateChainingArrayDataOrientedAllDestructor(CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal);
 static size_t CCHashMapSeparateChainingArrayDataOrientedAllGetCount(CCHashMap Map);
+static void CCHashMapSeparateChainingArrayDataOrientedAllRehash(CCHashMap Map, size_t BucketCount);
 static _Bool CCHashMapSeparateChainingArrayDataOrientedAllEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry);
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllFindKey(CCHashMap Map, const void *Key);
+static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash);
+static void CCHashMapSeparateChainingArrayDataOrientedAllPrefetch(CCHashMap Map, uintmax_t Hash);
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllEntryForKey(CCHashMap Map, const void *Key, _Bool *Created);
 static void *CCHashMapSeparateChainingArrayDataOrientedAllGetKey(CCHashMap Map, CCHashMapEntry Entry);
 static void *CCHashMapSeparateChainingArrayDataOrientedAllGetEntry(CCHashMap Map, CCHashMapEntry Entry);
@@ -57,6 +66,7 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedAllGetKeys(
 static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedAllGetValues(CCHashMap Map);
 static void *CCHashMapSeparateChainingArrayDataOrientedAllEnumerator(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorAction Action, CCHashMapEnumeratorType Type);
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllEnumeratorEntry(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorType Type);
+static size_t CCHashMapSeparateChainingArrayDataOrientedAllGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values);
 
 
 const CCHashMapInterface CCHashMapSeparateChainingArrayDataOrientedAllInterface = {
@@ -73,21 +83,60 @@ const CCHashMapInterface CCHashMapSeparateChainingArrayDataOrientedAllInterface
     .enumerator = CCHashMapSeparateChainingArrayDataOrientedAllEnumerator,
     .enumeratorReference = CCHashMapSeparateChainingArrayDataOrientedAllEnumeratorEntry,
     .optional = {
-        .rehash = NULL,
+        .rehash = CCHashMapSeparateChainingArrayDataOrientedAllRehash,
         .getValue = CCHashMapSeparateChainingArrayDataOrientedAllGetValue,
         .setValue = CCHashMapSeparateChainingArrayDataOrientedAllSetValue,
         .removeValue = CCHashMapSeparateChainingArrayDataOrientedAllRemoveValue,
         .keys = CCHashMapSeparateChainingArrayDataOrientedAllGetKeys,
-        .values = CCHashMapSeparateChainingArrayDataOrientedAllGetValues
+        .values = CCHashMapSeparateChainingArrayDataOrientedAllGetValues,
+        .findKeyWithHash = CCHashMapSeparateChainingArrayDataOrientedAllFindKeyWithHash,
+        .prefetch = CCHashMapSeparateChainingArrayDataOrientedAllPrefetch,
+        .batch = CCHashMapSeparateChainingArrayDataOrientedAllGetNextBatch
     }
 };
 
 const CCHashMapInterface * const CCHashMapSeparateChainingArrayDataOrientedAll = &CCHashMapSeparateChainingArrayDataOrientedAllInterface;
 
 
+static inline size_t GetBucketCount(CCHashMap Map)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    return Map->bucketCount + (Internal->rehash.hashes ? CCArrayGetCount(Internal->rehash.hashes) : 0);
+}
+
+static inline CCArray *GetBucket(CCHashMap Map, CCArray Buckets, CCArray RehashBuckets, size_t BucketIndex)
+{
+    //Indexes past the current buckets refer to the buckets of a rehash still in progress
+    if (BucketIndex < Map->bucketCount) return CCArrayGetElementAtIndex(Buckets, BucketIndex);
+    
+    return CCArrayGetElementAtIndex(RehashBuckets, BucketIndex - Map->bucketCount);
+}
+
+static inline CCArray *GetHashBucket(CCHashMap Map, size_t BucketIndex)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    return GetBucket(Map, Internal->hashes, Internal->rehash.hashes, BucketIndex);
+}
+
+static inline CCArray *GetKeyBucket(CCHashMap Map, size_t BucketIndex)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    return GetBucket(Map, Internal->keys, Internal->rehash.keys, BucketIndex);
+}
+
+static inline CCArray *GetValueBucket(CCHashMap Map, size_t BucketIndex)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    return GetBucket(Map, Internal->values, Internal->rehash.values, BucketIndex);
+}
+
 static CCHashMapEntry IndexToEntry(CCHashMap Map, size_t BucketIndex, size_t ItemIndex)
 {
-    const uintmax_t BucketMask = CCBitMaskForValue(Map->bucketCount + 1);
+    const uintmax_t BucketMask = CCBitMaskForValue(GetBucketCount(Map) + 1);
     const uintmax_t ItemMask = ~BucketMask, ItemShift = CCBitCountSet(BucketMask);
     
     if ((ItemIndex & (ItemMask >> ItemShift)) == ItemIndex)
@@ -95,7 +144,7 @@ static CCHashMapEntry IndexToEntry(CCHashMap Map, size_t BucketIndex, size_t Ite
         return (ItemIndex << ItemShift) | (BucketIndex + 1);
     }
     
-    CC_LOG_WARNING("HashMap bucket size (%zu, %zu) exceeds representable threshold for an entry reference", Map->bucketCount, CCArrayGetCount(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->values, BucketIndex)));
+    CC_LOG_WARNING("HashMap bucket size (%zu, %zu) exceeds representable threshold for an entry reference", Map->bucketCount, CCArrayGetCount(*(CCArray*)GetValueBucket(Map, BucketIndex)));
     
     return 0;
 }
@@ -104,7 +153,7 @@ static _Bool EntryToIndex(CCHashMap Map, CCHashMapEntry Entry, size_t *BucketInd
 {
     if (Entry)
     {
-        const uintmax_t BucketMask = CCBitMaskForValue(Map->bucketCount + 1);
+        const uintmax_t BucketMask = CCBitMaskForValue(GetBucketCount(Map) + 1);
         const uintmax_t ItemMask = ~BucketMask;
         
         *BucketIndex = (Entry & BucketMask) - 1;
@@ -130,12 +179,9 @@ static inline _Bool HashIsInitialized(uintmax_t Hash)
     return Hash & HASH_INIT_BIT;
 }
 
-static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
+static size_t InsertValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
 {
     CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
-    Internal->count++;
-    
-    if (Value) Hash |= HASH_INIT_BIT;
     
     //hash
     if (!Internal->hashes)
@@ -147,7 +193,7 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, BucketIndex);
     if (!HashBucket)
     {
-        HashBucket = CCArrayCreate(Map->allocator, sizeof(uintmax_t), 1);
+        HashBucket = CCArrayCreateSmall(Map->allocator, sizeof(uintmax_t), 1, CC_HASH_MAP_BUCKET_INLINE_COUNT);
         CCArrayReplaceElementAtIndex(Internal->hashes, BucketIndex, &HashBucket);
     }
     
@@ -177,7 +223,7 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     CCArray KeyBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->keys, BucketIndex);
     if (!KeyBucket)
     {
-        KeyBucket = CCArrayCreate(Map->allocator, Map->keySize, 1);
+        KeyBucket = CCArrayCreateSmall(Map->allocator, Map->keySize, 1, CC_HASH_MAP_BUCKET_INLINE_COUNT);
         CCArrayReplaceElementAtIndex(Internal->keys, BucketIndex, &KeyBucket);
     }
     
@@ -193,13 +239,70 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     CCArray ValueBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->values, BucketIndex);
     if (!ValueBucket)
     {
-        ValueBucket = CCArrayCreate(Map->allocator, Map->valueSize, 1);
+        ValueBucket = CCArrayCreateSmall(Map->allocator, Map->valueSize, 1, CC_HASH_MAP_BUCKET_INLINE_COUNT);
         CCArrayReplaceElementAtIndex(Internal->values, BucketIndex, &ValueBucket);
     }
     
     return CCArrayAppendElement(ValueBucket, Value);
 }
 
+static void MigrateBuckets(CCHashMap Map, size_t Count)
+{
+    CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    if (!Internal->rehash.hashes) return;
+    
+    for (const size_t OldCount = CCArrayGetCount(Internal->rehash.hashes); (Count--) && (Internal->rehash.index < OldCount); Internal->rehash.index++)
+    {
+        CCArray *HashSlot = CCArrayGetElementAtIndex(Internal->rehash.hashes, Internal->rehash.index);
+        if (*HashSlot)
+        {
+            CCArray *KeySlot = CCArrayGetElementAtIndex(Internal->rehash.keys, Internal->rehash.index);
+            CCArray *ValueSlot = CCArrayGetElementAtIndex(Internal->rehash.values, Internal->rehash.index);
+            
+            for (size_t Loop = 0, ItemCount = CCArrayGetCount(*HashSlot); Loop < ItemCount; Loop++)
+            {
+                const uintmax_t Hash = *(uintmax_t*)CCArrayGetElementAtIndex(*HashSlot, Loop);
+                if (!HashIsEmpty(Hash))
+                {
+                    InsertValue(Map, (Hash & HASH_RESERVED_MASK) % Map->bucketCount, Hash, CCArrayGetElementAtIndex(*KeySlot, Loop), HashIsInitialized(Hash) ? CCArrayGetElementAtIndex(*ValueSlot, Loop) : NULL);
+                }
+            }
+            
+            CCArrayDestroy(*HashSlot);
+            CCArrayDestroy(*KeySlot);
+            CCArrayDestroy(*ValueSlot);
+            *HashSlot = NULL;
+            *KeySlot = NULL;
+            *ValueSlot = NULL;
+        }
+    }
+    
+    if (Internal->rehash.index == CCArrayGetCount(Internal->rehash.hashes))
+    {
+        CCArrayDestroy(Internal->rehash.hashes);
+        CCArrayDestroy(Internal->rehash.keys);
+        CCArrayDestroy(Internal->rehash.values);
+        Internal->rehash.hashes = NULL;
+        Internal->rehash.keys = NULL;
+        Internal->rehash.values = NULL;
+        Internal->rehash.index = 0;
+    }
+}
+
+static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
+{
+    CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    MigrateBuckets(Map, CC_HASH_MAP_INCREMENTAL_REHASH_STEP);
+    
+    Internal->count++;
+    
+    if (Value) Hash |= HASH_INIT_BIT;
+    
+    return InsertValue(Map, BucketIndex, Hash, Key, Value);
+}
+
 static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
 {
     if (Entry)
@@ -209,7 +312,7 @@ static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
         {
             CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
             
-            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, BucketIndex), ItemIndex);
+            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
             
             CCAssertLog(!HashIsEmpty(*Hash), "Hash has been removed");
             
@@ -220,9 +323,40 @@ static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
     }
 }
 
-static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+static _Bool FindInBucket(CCHashMap Map, CCArray HashBucket, CCArray KeyBucket, const void *Key, uintmax_t Hash, size_t *ItemIndex)
 {
-    const uintmax_t Hash = CCHashMapGetKeyHash(Map, Key) & HASH_RESERVED_MASK;
+    if (HashBucket)
+    {
+        for (size_t Loop = 0, Count = CCArrayGetCount(HashBucket); Loop < Count; Loop++)
+        {
+            const uintmax_t EntryHash = *(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop) & ~HASH_INIT_BIT;
+            if (Hash == EntryHash)
+            {
+                const void *EntryKey = CCArrayGetElementAtIndex(KeyBucket, Loop);
+                if (Map->compareKeys)
+                {
+                    if (Map->compareKeys(Key, EntryKey) == CCComparisonResultEqual)
+                    {
+                        *ItemIndex = Loop;
+                        return TRUE;
+                    }
+                }
+                
+                else if (!memcmp(Key, EntryKey, Map->keySize))
+                {
+                    *ItemIndex = Loop;
+                    return TRUE;
+                }
+            }
+        }
+    }
+    
+    return FALSE;
+}
+
+static _Bool GetKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+{
+    Hash &= HASH_RESERVED_MASK;
     const size_t Index = Hash % Map->bucketCount;
     
     if (HashValue) *HashValue = Hash;
@@ -232,30 +366,15 @@ static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t
     
     if (Internal->hashes)
     {
-        CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Index);
-        if (HashBucket)
+        if (FindInBucket(Map, *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Index), *(CCArray*)CCArrayGetElementAtIndex(Internal->keys, Index), Key, Hash, ItemIndex)) return TRUE;
+        
+        if (Internal->rehash.hashes)
         {
-            for (size_t Loop = 0, Count = CCArrayGetCount(HashBucket); Loop < Count; Loop++)
+            const size_t OldIndex = Hash % CCArrayGetCount(Internal->rehash.hashes);
+            if ((OldIndex >= Internal->rehash.index) && (FindInBucket(Map, *(CCArray*)CCArrayGetElementAtIndex(Internal->rehash.hashes, OldIndex), *(CCArray*)CCArrayGetElementAtIndex(Internal->rehash.keys, OldIndex), Key, Hash, ItemIndex)))
             {
-                const uintmax_t EntryHash = *(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop) & ~HASH_INIT_BIT;
-                if (Hash == EntryHash)
-                {
-                    const void *EntryKey = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(Internal->keys, Index), Loop);
-                    if (Map->compareKeys)
-                    {
-                        if (Map->compareKeys(Key, EntryKey) == CCComparisonResultEqual)
-                        {
-                            *ItemIndex = Loop;
-                            return TRUE;
-                        }
-                    }
-                    
-                    else if (!memcmp(Key, EntryKey, Map->keySize))
-                    {
-                        *ItemIndex = Loop;
-                        return TRUE;
-                    }
-                }
+                *BucketIndex = Map->bucketCount + OldIndex;
+                return TRUE;
             }
         }
     }
@@ -263,6 +382,11 @@ static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t
     return FALSE;
 }
 
+static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+{
+    return GetKeyWithHash(Map, Key, CCHashMapGetKeyHash(Map, Key), HashValue, BucketIndex, ItemIndex);
+}
+
 static void *CCHashMapSeparateChainingArrayDataOrientedAllConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount)
 {
     CCHashMapSeparateChainingArrayDataOrientedAllInternal *Map = CCMalloc(Allocator, sizeof(CCHashMapSeparateChainingArrayDataOrientedAllInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
@@ -272,7 +396,13 @@ static void *CCHashMapSeparateChainingArrayDataOrientedAllConstructor(CCAllocato
             .count = 0,
             .hashes = NULL,
             .keys = NULL,
-            .values = NULL
+            .values = NULL,
+            .rehash = {
+                .hashes = NULL,
+                .keys = NULL,
+                .values = NULL,
+                .index = 0
+            }
         };
     }
     
@@ -295,10 +425,51 @@ static void CCHashMapSeparateChainingArrayDataOrientedAllDestructor(CCHashMapSep
     if (Internal->hashes) BucketDestroy(Internal->hashes);
     if (Internal->keys) BucketDestroy(Internal->keys);
     if (Internal->values) BucketDestroy(Internal->values);
+    if (Internal->rehash.hashes) BucketDestroy(Internal->rehash.hashes);
+    if (Internal->rehash.keys) BucketDestroy(Internal->rehash.keys);
+    if (Internal->rehash.values) BucketDestroy(Internal->rehash.values);
     
     CC_SAFE_Free(Internal);
 }
 
+static CCArray CreateBuckets(CCHashMap Map, size_t BucketCount)
+{
+    CCArray Buckets = CCArrayCreate(Map->allocator, sizeof(CCArray), BucketCount);
+    for (size_t Loop = 0; Loop < BucketCount; Loop++) CCArrayAppendElement(Buckets, &(CCArray){ NULL });
+    
+    return Buckets;
+}
+
+static void CCHashMapSeparateChainingArrayDataOrientedAllRehash(CCHashMap Map, size_t BucketCount)
+{
+    CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    if (!Internal->hashes) return;
+    
+    MigrateBuckets(Map, SIZE_MAX);
+    
+    if (!Internal->count)
+    {
+        BucketDestroy(Internal->hashes);
+        BucketDestroy(Internal->keys);
+        BucketDestroy(Internal->values);
+        Internal->hashes = NULL;
+        Internal->keys = NULL;
+        Internal->values = NULL;
+        
+        return;
+    }
+    
+    Internal->rehash.hashes = Internal->hashes;
+    Internal->rehash.keys = Internal->keys;
+    Internal->rehash.values = Internal->values;
+    Internal->rehash.index = 0;
+    
+    Internal->hashes = CreateBuckets(Map, BucketCount);
+    Internal->keys = CreateBuckets(Map, BucketCount);
+    Internal->values = CreateBuckets(Map, BucketCount);
+}
+
 static size_t CCHashMapSeparateChainingArrayDataOrientedAllGetCount(CCHashMap Map)
 {
     return ((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->count;
@@ -310,7 +481,7 @@ static _Bool CCHashMapSeparateChainingArrayDataOrientedAllEntryIsInitialized(CCH
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        const uintmax_t Hash = *(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->hashes, BucketIndex), ItemIndex);
+        const uintmax_t Hash = *(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
         
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(Hash), "Entry has been removed");
@@ -333,6 +504,24 @@ static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllFindKey(CCHas
     return 0;
 }
 
+static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash)
+{
+    size_t BucketIndex, ItemIndex;
+    if (GetKeyWithHash(Map, Key, Hash, NULL, &BucketIndex, &ItemIndex))
+    {
+        return IndexToEntry(Map, BucketIndex, ItemIndex);
+    }
+    
+    return 0;
+}
+
+static void CCHashMapSeparateChainingArrayDataOrientedAllPrefetch(CCHashMap Map, uintmax_t Hash)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    if (Internal->hashes) CC_PREFETCH(CCArrayGetElementAtIndex(Internal->hashes, (Hash & HASH_RESERVED_MASK) % Map->bucketCount));
+}
+
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllEntryForKey(CCHashMap Map, const void *Key, _Bool *Created)
 {
     uintmax_t Hash;
@@ -357,10 +546,10 @@ static void *CCHashMapSeparateChainingArrayDataOrientedAllGetKey(CCHashMap Map,
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
 #if !CC_NO_ASSERT
-        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->hashes, BucketIndex), ItemIndex)), "Entry has been removed");
+        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex)), "Entry has been removed");
 #endif
         
-        Key = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->keys, BucketIndex), ItemIndex);
+        Key = CCArrayGetElementAtIndex(*(CCArray*)GetKeyBucket(Map, BucketIndex), ItemIndex);
     }
     
     return Key;
@@ -373,10 +562,10 @@ static void *CCHashMapSeparateChainingArrayDataOrientedAllGetEntry(CCHashMap Map
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
 #if !CC_NO_ASSERT
-        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->hashes, BucketIndex), ItemIndex)), "Entry has been removed");
+        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex)), "Entry has been removed");
 #endif
         
-        Value = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->values, BucketIndex), ItemIndex);
+        Value = CCArrayGetElementAtIndex(*(CCArray*)GetValueBucket(Map, BucketIndex), ItemIndex);
     }
     
     return Value;
@@ -387,13 +576,13 @@ static void CCHashMapSeparateChainingArrayDataOrientedAllSetEntry(CCHashMap Map,
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->hashes, BucketIndex), ItemIndex);
+        uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(*Hash), "Entry has been removed");
 #endif
         
         *Hash |= HASH_INIT_BIT;
-        CCArrayReplaceElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->values, BucketIndex), ItemIndex, Value);
+        CCArrayReplaceElementAtIndex(*(CCArray*)GetValueBucket(Map, BucketIndex), ItemIndex, Value);
     }
 }
 
@@ -406,7 +595,7 @@ static void *CCHashMapSeparateChainingArrayDataOrientedAllGetValue(CCHashMap Map
 {
     void *Value = NULL;
     size_t BucketIndex, ItemIndex;
-    if (GetKey(Map, Key, NULL, &BucketIndex, &ItemIndex)) Value = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->values, BucketIndex), ItemIndex);
+    if (GetKey(Map, Key, NULL, &BucketIndex, &ItemIndex)) Value = CCArrayGetElementAtIndex(*(CCArray*)GetValueBucket(Map, BucketIndex), ItemIndex);
     
     return Value;
 }
@@ -419,11 +608,11 @@ static void CCHashMapSeparateChainingArrayDataOrientedAllSetValue(CCHashMap Map,
     {
         if (!HashIsInitialized(Hash))
         {
-            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->hashes, BucketIndex), ItemIndex);
+            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
             *Hash |= HASH_INIT_BIT;
         }
         
-        CCArrayReplaceElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedAllInternal*)Map->internal)->values, BucketIndex), ItemIndex, Value);
+        CCArrayReplaceElementAtIndex(*(CCArray*)GetValueBucket(Map, BucketIndex), ItemIndex, Value);
     }
     
     else
@@ -445,12 +634,12 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedAllGetKeys(
     
     if (Internal->hashes)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
-                CCArray KeyBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->keys, Loop);
+                CCArray KeyBucket = *(CCArray*)GetKeyBucket(Map, Loop);
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
                 {
                     if (!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop2)))
@@ -472,12 +661,12 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedAllGetValue
     
     if (Internal->hashes)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
-                CCArray ValueBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->values, Loop);
+                CCArray ValueBucket = *(CCArray*)GetValueBucket(Map, Loop);
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
                 {
                     if (!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop2)))
@@ -498,9 +687,9 @@ static CCHashMapEntry GetHeadEntry(CCHashMap Map)
     
     if (Internal->hashes)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
@@ -523,9 +712,9 @@ static CCHashMapEntry GetTailEntry(CCHashMap Map)
     
     if (Internal->hashes)
     {
-        for (size_t Loop = CCArrayGetCount(Internal->hashes); Loop > 0; Loop--)
+        for (size_t Loop = GetBucketCount(Map); Loop > 0; Loop--)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop - 1);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop - 1);
             if (HashBucket)
             {
                 for (size_t Loop2 = CCArrayGetCount(HashBucket); Loop2 > 0; Loop2--)
@@ -553,9 +742,9 @@ static CCHashMapEntry GetNextEntry(CCHashMap Map, CCHashMapEntry Entry)
         
         ItemIndex++;
         
-        for (size_t Loop = BucketIndex, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = BucketIndex, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
                 for (size_t Loop2 = ItemIndex, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
@@ -587,7 +776,7 @@ static CCHashMapEntry GetPrevEntry(CCHashMap Map, CCHashMapEntry Entry)
         
         for (size_t Loop = BucketIndex + 1; Loop > 0; Loop--)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop - 1);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop - 1);
             if (HashBucket)
             {
                 for (size_t Loop2 = ItemIndex ? ItemIndex - 1 : CCArrayGetCount(HashBucket); Loop2 > 0; Loop2--)
@@ -645,3 +834,45 @@ static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedAllEnumeratorEnt
 {
     return Enumerator->internal.extra[0];
 }
+
+static size_t CCHashMapSeparateChainingArrayDataOrientedAllGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedAllInternal *Internal = Map->internal;
+    
+    if (!Internal->hashes) return 0;
+    
+    //The cursor holds the bucket and item following the previous batch
+    for (size_t Count = GetBucketCount(Map); Cursor->internal.extra[0] < Count; Cursor->internal.extra[0]++, Cursor->internal.extra[1] = 0)
+    {
+        CCArray Bucket = *(CCArray*)GetHashBucket(Map, Cursor->internal.extra[0]);
+        if (Bucket)
+        {
+            size_t Index = Cursor->internal.extra[1], ItemCount = CCArrayGetCount(Bucket);
+            while ((Index < ItemCount) && (HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(Bucket, Index)))) Index++;
+            
+            size_t BatchCount = 0;
+            while ((Index + BatchCount < ItemCount) && (!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(Bucket, Index + BatchCount)))) BatchCount++;
+            
+            if (BatchCount)
+            {
+                Cursor->internal.extra[1] = Index + BatchCount;
+                
+                if (Keys)
+                {
+                    CCArray KeyBucket = *(CCArray*)GetKeyBucket(Map, Cursor->internal.extra[0]);
+                    *Keys = (CCEnumeratorState){ .batch = { .ptr = CCArrayGetElementAtIndex(KeyBucket, Index), .count = BatchCount, .stride = Map->keySize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+                }
+                
+                if (Values)
+                {
+                    CCArray ValueBucket = *(CCArray*)GetValueBucket(Map, Cursor->internal.extra[0]);
+                    *Values = (CCEnumeratorState){ .batch = { .ptr = CCArrayGetElementAtIndex(ValueBucket, Index), .count = BatchCount, .stride = Map->valueSize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+                }
+
+                return BatchCount;
+            }
+        }
+    }
+    
+    return 0;
+}
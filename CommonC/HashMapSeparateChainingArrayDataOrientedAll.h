@@ -39,6 +39,9 @@
  * Moderate Operations:
  * - Enumerating of keys. (faster than other @b CCHashMapSeparateChainingArray* variants)
  * - Enumerating of values. (faster than other @b CCHashMapSeparateChainingArray* variants)
+ *
+ * Rehashing is performed incrementally, the old buckets are migrated over the following insertions. While
+ * a rehash is in progress, an insertion may invalidate any entry references.
  */
 #ifndef CommonC_HashMapSeparateChainingArrayDataOrientedAll_h
 #define CommonC_HashMapSeparateChainingArrayDataOrientedAll_h
@@ -37,13 +37,21 @@ typedef struct {
     size_t count;
     CCArray hashes;
     CCArray buckets;
+    struct {
+        CCArray hashes;
+        CCArray buckets;
+        size_t index;
+    } rehash;
 } CCHashMapSeparateChainingArrayDataOrientedHashInternal;
 
 static void *CCHashMapSeparateChainingArrayDataOrientedHashConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount);
 static void CCHashMapSeparateChainingArrayDataOrientedHashDestructor(CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal);
 static size_t CCHashMapSeparateChainingArrayDataOrientedHashGetCount(CCHashMap Map);
+static void CCHashMapSeparateChainingArrayDataOrientedHashRehash(CCHashMap Map, size_t BucketCount);
 static _Bool CCHashMapSeparateChainingArrayDataOrientedHashEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry);
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashFindKey(CCHashMap Map, const void *Key);
+static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash);
+static void CCHashMapSeparateChainingArrayDataOrientedHashPrefetch(CCHashMap Map, uintmax_t Hash);
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashEntryForKey(CCHashMap Map, const void *Key, _Bool *Created);
 static void *CCHashMapSeparateChainingArrayDataOrientedHashGetKey(CCHashMap Map, CCHashMapEntry Entry);
 static void *CCHashMapSeparateChainingArrayDataOrientedHashGetEntry(CCHashMap Map, CCHashMapEntry Entry);
@@ -56,6 +64,7 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedHashGetKeys
 static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedHashGetValues(CCHashMap Map);
 static void *CCHashMapSeparateChainingArrayDataOrientedHashEnumerator(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorAction Action, CCHashMapEnumeratorType Type);
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashEnumeratorEntry(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorType Type);
+static size_t CCHashMapSeparateChainingArrayDataOrientedHashGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values);
 
 
 const CCHashMapInterface CCHashMapSeparateChainingArrayDataOrientedHashInterface = {
@@ -72,21 +81,53 @@ const CCHashMapInterface CCHashMapSeparateChainingArrayDataOrientedHashInterface
     .enumerator = CCHashMapSeparateChainingArrayDataOrientedHashEnumerator,
     .enumeratorReference = CCHashMapSeparateChainingArrayDataOrientedHashEnumeratorEntry,
     .optional = {
-        .rehash = NULL,
+        .rehash = CCHashMapSeparateChainingArrayDataOrientedHashRehash,
         .getValue = CCHashMapSeparateChainingArrayDataOrientedHashGetValue,
         .setValue = CCHashMapSeparateChainingArrayDataOrientedHashSetValue,
         .removeValue = CCHashMapSeparateChainingArrayDataOrientedHashRemoveValue,
         .keys = CCHashMapSeparateChainingArrayDataOrientedHashGetKeys,
-        .values = CCHashMapSeparateChainingArrayDataOrientedHashGetValues
+        .values = CCHashMapSeparateChainingArrayDataOrientedHashGetValues,
+        .findKeyWithHash = CCHashMapSeparateChainingArrayDataOrientedHashFindKeyWithHash,
+        .prefetch = CCHashMapSeparateChainingArrayDataOrientedHashPrefetch,
+        .batch = CCHashMapSeparateChainingArrayDataOrientedHashGetNextBatch
     }
 };
 
 const CCHashMapInterface * const CCHashMapSeparateChainingArrayDataOrientedHash = &CCHashMapSeparateChainingArrayDataOrientedHashInterface;
 
 
+static inline size_t GetBucketCount(CCHashMap Map)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    return Map->bucketCount + (Internal->rehash.hashes ? CCArrayGetCount(Internal->rehash.hashes) : 0);
+}
+
+static inline CCArray *GetBucket(CCHashMap Map, CCArray Buckets, CCArray RehashBuckets, size_t BucketIndex)
+{
+    //Indexes past the current buckets refer to the buckets of a rehash still in progress
+    if (BucketIndex < Map->bucketCount) return CCArrayGetElementAtIndex(Buckets, BucketIndex);
+    
+    return CCArrayGetElementAtIndex(RehashBuckets, BucketIndex - Map->bucketCount);
+}
+
+static inline CCArray *GetHashBucket(CCHashMap Map, size_t BucketIndex)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    return GetBucket(Map, Internal->hashes, Internal->rehash.hashes, BucketIndex);
+}
+
+static inline CCArray *GetItemBucket(CCHashMap Map, size_t BucketIndex)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    return GetBucket(Map, Internal->buckets, Internal->rehash.buckets, BucketIndex);
+}
+
 static CCHashMapEntry IndexToEntry(CCHashMap Map, size_t BucketIndex, size_t ItemIndex)
 {
-    const uintmax_t BucketMask = CCBitMaskForValue(Map->bucketCount + 1);
+    const uintmax_t BucketMask = CCBitMaskForValue(GetBucketCount(Map) + 1);
     const uintmax_t ItemMask = ~BucketMask, ItemShift = CCBitCountSet(BucketMask);
     
     if ((ItemIndex & (ItemMask >> ItemShift)) == ItemIndex)
@@ -94,7 +135,7 @@ static CCHashMapEntry IndexToEntry(CCHashMap Map, size_t BucketIndex, size_t Ite
         return (ItemIndex << ItemShift) | (BucketIndex + 1);
     }
     
-    CC_LOG_WARNING("HashMap bucket size (%zu, %zu) exceeds representable threshold for an entry reference", Map->bucketCount, CCArrayGetCount(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->buckets, BucketIndex)));
+    CC_LOG_WARNING("HashMap bucket size (%zu, %zu) exceeds representable threshold for an entry reference", Map->bucketCount, CCArrayGetCount(*(CCArray*)GetItemBucket(Map, BucketIndex)));
     
     return 0;
 }
@@ -103,7 +144,7 @@ static _Bool EntryToIndex(CCHashMap Map, CCHashMapEntry Entry, size_t *BucketInd
 {
     if (Entry)
     {
-        const uintmax_t BucketMask = CCBitMaskForValue(Map->bucketCount + 1);
+        const uintmax_t BucketMask = CCBitMaskForValue(GetBucketCount(Map) + 1);
         const uintmax_t ItemMask = ~BucketMask;
         
         *BucketIndex = (Entry & BucketMask) - 1;
@@ -149,12 +190,9 @@ static inline void SetItemValue(CCHashMap Map, void *Item, const void *Value)
     memcpy(Item + Map->keySize, Value, Map->valueSize);
 }
 
-static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
+static size_t InsertValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
 {
     CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
-    Internal->count++;
-    
-    if (Value) Hash |= HASH_INIT_BIT;
     
     //hash
     if (!Internal->hashes)
@@ -166,7 +204,7 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, BucketIndex);
     if (!HashBucket)
     {
-        HashBucket = CCArrayCreate(Map->allocator, sizeof(uintmax_t), 1);
+        HashBucket = CCArrayCreateSmall(Map->allocator, sizeof(uintmax_t), 1, CC_HASH_MAP_BUCKET_INLINE_COUNT);
         CCArrayReplaceElementAtIndex(Internal->hashes, BucketIndex, &HashBucket);
     }
     
@@ -198,7 +236,7 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     CCArray Bucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, BucketIndex);
     if (!Bucket)
     {
-        Bucket = CCArrayCreate(Map->allocator, Map->keySize + Map->valueSize, 1);
+        Bucket = CCArrayCreateSmall(Map->allocator, Map->keySize + Map->valueSize, 1, CC_HASH_MAP_BUCKET_INLINE_COUNT);
         CCArrayReplaceElementAtIndex(Internal->buckets, BucketIndex, &Bucket);
     }
     
@@ -210,6 +248,59 @@ static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const
     return Index;
 }
 
+static void MigrateBuckets(CCHashMap Map, size_t Count)
+{
+    CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    if (!Internal->rehash.hashes) return;
+    
+    for (const size_t OldCount = CCArrayGetCount(Internal->rehash.hashes); (Count--) && (Internal->rehash.index < OldCount); Internal->rehash.index++)
+    {
+        CCArray *HashSlot = CCArrayGetElementAtIndex(Internal->rehash.hashes, Internal->rehash.index);
+        if (*HashSlot)
+        {
+            CCArray *ItemSlot = CCArrayGetElementAtIndex(Internal->rehash.buckets, Internal->rehash.index);
+            
+            for (size_t Loop = 0, ItemCount = CCArrayGetCount(*HashSlot); Loop < ItemCount; Loop++)
+            {
+                const uintmax_t Hash = *(uintmax_t*)CCArrayGetElementAtIndex(*HashSlot, Loop);
+                if (!HashIsEmpty(Hash))
+                {
+                    void *Item = CCArrayGetElementAtIndex(*ItemSlot, Loop);
+                    InsertValue(Map, (Hash & HASH_RESERVED_MASK) % Map->bucketCount, Hash, GetItemKey(Map, Item), HashIsInitialized(Hash) ? GetItemValue(Map, Item) : NULL);
+                }
+            }
+            
+            CCArrayDestroy(*HashSlot);
+            CCArrayDestroy(*ItemSlot);
+            *HashSlot = NULL;
+            *ItemSlot = NULL;
+        }
+    }
+    
+    if (Internal->rehash.index == CCArrayGetCount(Internal->rehash.hashes))
+    {
+        CCArrayDestroy(Internal->rehash.hashes);
+        CCArrayDestroy(Internal->rehash.buckets);
+        Internal->rehash.hashes = NULL;
+        Internal->rehash.buckets = NULL;
+        Internal->rehash.index = 0;
+    }
+}
+
+static size_t AddValue(CCHashMap Map, size_t BucketIndex, uintmax_t Hash, const void *Key, const void *Value)
+{
+    CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    MigrateBuckets(Map, CC_HASH_MAP_INCREMENTAL_REHASH_STEP);
+    
+    Internal->count++;
+    
+    if (Value) Hash |= HASH_INIT_BIT;
+    
+    return InsertValue(Map, BucketIndex, Hash, Key, Value);
+}
+
 static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
 {
     if (Entry)
@@ -219,7 +310,7 @@ static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
         {
             CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
             
-            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, BucketIndex), ItemIndex);
+            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
             
             CCAssertLog(!HashIsEmpty(*Hash), "Hash has been removed");
             
@@ -230,9 +321,40 @@ static void RemoveValue(CCHashMap Map, CCHashMapEntry Entry)
     }
 }
 
-static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+static _Bool FindInBucket(CCHashMap Map, CCArray HashBucket, CCArray ItemBucket, const void *Key, uintmax_t Hash, size_t *ItemIndex)
 {
-    const uintmax_t Hash = CCHashMapGetKeyHash(Map, Key) & HASH_RESERVED_MASK;
+    if (HashBucket)
+    {
+        for (size_t Loop = 0, Count = CCArrayGetCount(HashBucket); Loop < Count; Loop++)
+        {
+            const uintmax_t EntryHash = *(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop) & ~HASH_INIT_BIT;
+            if (Hash == EntryHash)
+            {
+                const void *EntryKey = GetItemKey(Map, CCArrayGetElementAtIndex(ItemBucket, Loop));
+                if (Map->compareKeys)
+                {
+                    if (Map->compareKeys(Key, EntryKey) == CCComparisonResultEqual)
+                    {
+                        *ItemIndex = Loop;
+                        return TRUE;
+                    }
+                }
+                
+                else if (!memcmp(Key, EntryKey, Map->keySize))
+                {
+                    *ItemIndex = Loop;
+                    return TRUE;
+                }
+            }
+        }
+    }
+    
+    return FALSE;
+}
+
+static _Bool GetKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+{
+    Hash &= HASH_RESERVED_MASK;
     const size_t Index = Hash % Map->bucketCount;
     
     if (HashValue) *HashValue = Hash;
@@ -242,30 +364,15 @@ static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t
     
     if (Internal->hashes)
     {
-        CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Index);
-        if (HashBucket)
+        if (FindInBucket(Map, *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Index), *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Index), Key, Hash, ItemIndex)) return TRUE;
+        
+        if (Internal->rehash.hashes)
         {
-            for (size_t Loop = 0, Count = CCArrayGetCount(HashBucket); Loop < Count; Loop++)
+            const size_t OldIndex = Hash % CCArrayGetCount(Internal->rehash.hashes);
+            if ((OldIndex >= Internal->rehash.index) && (FindInBucket(Map, *(CCArray*)CCArrayGetElementAtIndex(Internal->rehash.hashes, OldIndex), *(CCArray*)CCArrayGetElementAtIndex(Internal->rehash.buckets, OldIndex), Key, Hash, ItemIndex)))
             {
-                const uintmax_t EntryHash = *(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop) & ~HASH_INIT_BIT;
-                if (Hash == EntryHash)
-                {
-                    const void *EntryKey = GetItemKey(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Index), Loop));
-                    if (Map->compareKeys)
-                    {
-                        if (Map->compareKeys(Key, EntryKey) == CCComparisonResultEqual)
-                        {
-                            *ItemIndex = Loop;
-                            return TRUE;
-                        }
-                    }
-                    
-                    else if (!memcmp(Key, EntryKey, Map->keySize))
-                    {
-                        *ItemIndex = Loop;
-                        return TRUE;
-                    }
-                }
+                *BucketIndex = Map->bucketCount + OldIndex;
+                return TRUE;
             }
         }
     }
@@ -273,6 +380,11 @@ static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t
     return FALSE;
 }
 
+static _Bool GetKey(CCHashMap Map, const void *Key, uintmax_t *HashValue, size_t *BucketIndex, size_t *ItemIndex)
+{
+    return GetKeyWithHash(Map, Key, CCHashMapGetKeyHash(Map, Key), HashValue, BucketIndex, ItemIndex);
+}
+
 static void *CCHashMapSeparateChainingArrayDataOrientedHashConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount)
 {
     CCHashMapSeparateChainingArrayDataOrientedHashInternal *Map = CCMalloc(Allocator, sizeof(CCHashMapSeparateChainingArrayDataOrientedHashInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
@@ -281,7 +393,12 @@ static void *CCHashMapSeparateChainingArrayDataOrientedHashConstructor(CCAllocat
         *Map = (CCHashMapSeparateChainingArrayDataOrientedHashInternal){
             .count = 0,
             .hashes = NULL,
-            .buckets = NULL
+            .buckets = NULL,
+            .rehash = {
+                .hashes = NULL,
+                .buckets = NULL,
+                .index = 0
+            }
         };
     }
     
@@ -303,10 +420,46 @@ static void CCHashMapSeparateChainingArrayDataOrientedHashDestructor(CCHashMapSe
 {
     if (Internal->hashes) BucketDestroy(Internal->hashes);
     if (Internal->buckets) BucketDestroy(Internal->buckets);
+    if (Internal->rehash.hashes) BucketDestroy(Internal->rehash.hashes);
+    if (Internal->rehash.buckets) BucketDestroy(Internal->rehash.buckets);
     
     CC_SAFE_Free(Internal);
 }
 
+static CCArray CreateBuckets(CCHashMap Map, size_t BucketCount)
+{
+    CCArray Buckets = CCArrayCreate(Map->allocator, sizeof(CCArray), BucketCount);
+    for (size_t Loop = 0; Loop < BucketCount; Loop++) CCArrayAppendElement(Buckets, &(CCArray){ NULL });
+    
+    return Buckets;
+}
+
+static void CCHashMapSeparateChainingArrayDataOrientedHashRehash(CCHashMap Map, size_t BucketCount)
+{
+    CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    if (!Internal->hashes) return;
+    
+    MigrateBuckets(Map, SIZE_MAX);
+    
+    if (!Internal->count)
+    {
+        BucketDestroy(Internal->hashes);
+        BucketDestroy(Internal->buckets);
+        Internal->hashes = NULL;
+        Internal->buckets = NULL;
+        
+        return;
+    }
+    
+    Internal->rehash.hashes = Internal->hashes;
+    Internal->rehash.buckets = Internal->buckets;
+    Internal->rehash.index = 0;
+    
+    Internal->hashes = CreateBuckets(Map, BucketCount);
+    Internal->buckets = CreateBuckets(Map, BucketCount);
+}
+
 static size_t CCHashMapSeparateChainingArrayDataOrientedHashGetCount(CCHashMap Map)
 {
     return ((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->count;
@@ -318,7 +471,7 @@ static _Bool CCHashMapSeparateChainingArrayDataOrientedHashEntryIsInitialized(CC
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        const uintmax_t Hash = *(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->hashes, BucketIndex), ItemIndex);
+        const uintmax_t Hash = *(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
         
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(Hash), "Entry has been removed");
@@ -341,6 +494,24 @@ static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashFindKey(CCHa
     return 0;
 }
 
+static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash)
+{
+    size_t BucketIndex, ItemIndex;
+    if (GetKeyWithHash(Map, Key, Hash, NULL, &BucketIndex, &ItemIndex))
+    {
+        return IndexToEntry(Map, BucketIndex, ItemIndex);
+    }
+    
+    return 0;
+}
+
+static void CCHashMapSeparateChainingArrayDataOrientedHashPrefetch(CCHashMap Map, uintmax_t Hash)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    if (Internal->hashes) CC_PREFETCH(CCArrayGetElementAtIndex(Internal->hashes, (Hash & HASH_RESERVED_MASK) % Map->bucketCount));
+}
+
 static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashEntryForKey(CCHashMap Map, const void *Key, _Bool *Created)
 {
     uintmax_t Hash;
@@ -365,10 +536,10 @@ static void *CCHashMapSeparateChainingArrayDataOrientedHashGetKey(CCHashMap Map,
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
 #if !CC_NO_ASSERT
-        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->hashes, BucketIndex), ItemIndex)), "Entry has been removed");
+        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex)), "Entry has been removed");
 #endif
         
-        Key = GetItemKey(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->buckets, BucketIndex), ItemIndex));
+        Key = GetItemKey(Map, CCArrayGetElementAtIndex(*(CCArray*)GetItemBucket(Map, BucketIndex), ItemIndex));
     }
     
     return Key;
@@ -381,10 +552,10 @@ static void *CCHashMapSeparateChainingArrayDataOrientedHashGetEntry(CCHashMap Ma
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
 #if !CC_NO_ASSERT
-        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->hashes, BucketIndex), ItemIndex)), "Entry has been removed");
+        CCAssertLog(!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex)), "Entry has been removed");
 #endif
         
-        Value = GetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->buckets, BucketIndex), ItemIndex));
+        Value = GetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)GetItemBucket(Map, BucketIndex), ItemIndex));
     }
     
     return Value;
@@ -395,13 +566,13 @@ static void CCHashMapSeparateChainingArrayDataOrientedHashSetEntry(CCHashMap Map
     size_t BucketIndex, ItemIndex;
     if (EntryToIndex(Map, Entry, &BucketIndex, &ItemIndex))
     {
-        uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->hashes, BucketIndex), ItemIndex);
+        uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
 #if !CC_NO_ASSERT
         CCAssertLog(!HashIsEmpty(*Hash), "Entry has been removed");
 #endif
         
         *Hash |= HASH_INIT_BIT;
-        SetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->buckets, BucketIndex), ItemIndex), Value);
+        SetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)GetItemBucket(Map, BucketIndex), ItemIndex), Value);
     }
 }
 
@@ -414,7 +585,7 @@ static void *CCHashMapSeparateChainingArrayDataOrientedHashGetValue(CCHashMap Ma
 {
     void *Value = NULL;
     size_t BucketIndex, ItemIndex;
-    if (GetKey(Map, Key, NULL, &BucketIndex, &ItemIndex)) Value = GetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->buckets, BucketIndex), ItemIndex));
+    if (GetKey(Map, Key, NULL, &BucketIndex, &ItemIndex)) Value = GetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)GetItemBucket(Map, BucketIndex), ItemIndex));
     
     return Value;
 }
@@ -427,11 +598,11 @@ static void CCHashMapSeparateChainingArrayDataOrientedHashSetValue(CCHashMap Map
     {
         if (!HashIsInitialized(Hash))
         {
-            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->hashes, BucketIndex), ItemIndex);
+            uintmax_t *Hash = CCArrayGetElementAtIndex(*(CCArray*)GetHashBucket(Map, BucketIndex), ItemIndex);
             *Hash |= HASH_INIT_BIT;
         }
         
-        SetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)CCArrayGetElementAtIndex(((CCHashMapSeparateChainingArrayDataOrientedHashInternal*)Map->internal)->buckets, BucketIndex), ItemIndex), Value);
+        SetItemValue(Map, CCArrayGetElementAtIndex(*(CCArray*)GetItemBucket(Map, BucketIndex), ItemIndex), Value);
     }
     
     else
@@ -453,12 +624,12 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedHashGetKeys
     
     if (Internal->hashes)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
-                CCArray KeyBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop);
+                CCArray KeyBucket = *(CCArray*)GetItemBucket(Map, Loop);
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
                 {
                     if (!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop2)))
@@ -480,12 +651,12 @@ static CCOrderedCollection CCHashMapSeparateChainingArrayDataOrientedHashGetValu
     
     if (Internal->hashes)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
-                CCArray ValueBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->buckets, Loop);
+                CCArray ValueBucket = *(CCArray*)GetItemBucket(Map, Loop);
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
                 {
                     if (!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(HashBucket, Loop2)))
@@ -506,9 +677,9 @@ static CCHashMapEntry GetHeadEntry(CCHashMap Map)
     
     if (Internal->hashes)
     {
-        for (size_t Loop = 0, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = 0, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
                 for (size_t Loop2 = 0, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
@@ -531,9 +702,9 @@ static CCHashMapEntry GetTailEntry(CCHashMap Map)
     
     if (Internal->hashes)
     {
-        for (size_t Loop = CCArrayGetCount(Internal->hashes); Loop > 0; Loop--)
+        for (size_t Loop = GetBucketCount(Map); Loop > 0; Loop--)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop - 1);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop - 1);
             if (HashBucket)
             {
                 for (size_t Loop2 = CCArrayGetCount(HashBucket); Loop2 > 0; Loop2--)
@@ -561,9 +732,9 @@ static CCHashMapEntry GetNextEntry(CCHashMap Map, CCHashMapEntry Entry)
         
         ItemIndex++;
         
-        for (size_t Loop = BucketIndex, Count = CCArrayGetCount(Internal->hashes); Loop < Count; Loop++)
+        for (size_t Loop = BucketIndex, Count = GetBucketCount(Map); Loop < Count; Loop++)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop);
             if (HashBucket)
             {
                 for (size_t Loop2 = ItemIndex, Count2 = CCArrayGetCount(HashBucket); Loop2 < Count2; Loop2++)
@@ -595,7 +766,7 @@ static CCHashMapEntry GetPrevEntry(CCHashMap Map, CCHashMapEntry Entry)
         
         for (size_t Loop = BucketIndex + 1; Loop > 0; Loop--)
         {
-            CCArray HashBucket = *(CCArray*)CCArrayGetElementAtIndex(Internal->hashes, Loop - 1);
+            CCArray HashBucket = *(CCArray*)GetHashBucket(Map, Loop - 1);
             if (HashBucket)
             {
                 for (size_t Loop2 = ItemIndex ? ItemIndex - 1 : CCArrayGetCount(HashBucket); Loop2 > 0; Loop2--)
@@ -653,3 +824,38 @@ static CCHashMapEntry CCHashMapSeparateChainingArrayDataOrientedHashEnumeratorEn
 {
     return Enumerator->internal.extra[0];
 }
+
+static size_t CCHashMapSeparateChainingArrayDataOrientedHashGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values)
+{
+    const CCHashMapSeparateChainingArrayDataOrientedHashInternal *Internal = Map->internal;
+    
+    if (!Internal->hashes) return 0;
+    
+    //The cursor holds the bucket and item following the previous batch
+    for (size_t Count = GetBucketCount(Map); Cursor->internal.extra[0] < Count; Cursor->internal.extra[0]++, Cursor->internal.extra[1] = 0)
+    {
+        CCArray Bucket = *(CCArray*)GetHashBucket(Map, Cursor->internal.extra[0]);
+        if (Bucket)
+        {
+            size_t Index = Cursor->internal.extra[1], ItemCount = CCArrayGetCount(Bucket);
+            while ((Index < ItemCount) && (HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(Bucket, Index)))) Index++;
+            
+            size_t BatchCount = 0;
+            while ((Index + BatchCount < ItemCount) && (!HashIsEmpty(*(uintmax_t*)CCArrayGetElementAtIndex(Bucket, Index + BatchCount)))) BatchCount++;
+            
+            if (BatchCount)
+            {
+                Cursor->internal.extra[1] = Index + BatchCount;
+                
+                CCArray ItemBucket = *(CCArray*)GetItemBucket(Map, Cursor->internal.extra[0]);
+                void *Item = CCArrayGetElementAtIndex(ItemBucket, Index);
+                if (Keys) *Keys = (CCEnumeratorState){ .batch = { .ptr = GetItemKey(Map, Item), .count = BatchCount, .stride = CCArrayGetElementSize(ItemBucket), .index = 0 }, .type = CCEnumeratorFormatBatch };
+                if (Values) *Values = (CCEnumeratorState){ .batch = { .ptr = GetItemValue(Map, Item), .count = BatchCount, .stride = CCArrayGetElementSize(ItemBucket), .index = 0 }, .type = CCEnumeratorFormatBatch };
+
+                return BatchCount;
+            }
+        }
+    }
+    
+    return 0;
+}
@@ -37,6 +37,9 @@
  * Moderate Operations:
  * - Enumerating of keys. (faster than other @b CCHashMapSeparateChainingArray variant)
  * - Enumerating of values. (faster than other @b CCHashMapSeparateChainingArray variant)
+ *
+ * Rehashing is performed incrementally, the old buckets are migrated over the following insertions. While
+ * a rehash is in progress, an insertion may invalidate any entry references.
  */
 #ifndef CommonC_HashMapSeparateChainingArrayDataOrientedHash_h
 #define CommonC_HashMapSeparateChainingArrayDataOrientedHash_h
@@ -0,0 +1,684 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "HashMapSwissTable.h"
+#include "HashMap.h"
+#include "MemoryAllocation.h"
+#include "OrderedCollection.h"
+#include "BitTricks.h"
+#include "Logging.h"
+#include <string.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <emmintrin.h>
+#endif
+
+
+typedef struct {
+    size_t count;
+    size_t capacity;
+    size_t growthLeft;
+    int8_t *control;
+    uint8_t *initialized;
+    void *slots;
+} CCHashMapSwissTableInternal;
+
+static void *CCHashMapSwissTableConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount);
+static void CCHashMapSwissTableDestructor(CCHashMapSwissTableInternal *Internal);
+static size_t CCHashMapSwissTableGetCount(CCHashMap Map);
+static void CCHashMapSwissTableRehash(CCHashMap Map, size_t BucketCount);
+static _Bool CCHashMapSwissTableEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry);
+static CCHashMapEntry CCHashMapSwissTableFindKey(CCHashMap Map, const void *Key);
+static CCHashMapEntry CCHashMapSwissTableFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash);
+static void CCHashMapSwissTablePrefetch(CCHashMap Map, uintmax_t Hash);
+static void CCHashMapSwissTableBuild(CCHashMap Map, const void *Keys, const void *Values, const uintmax_t *Hashes, size_t Count);
+static CCHashMapEntry CCHashMapSwissTableEntryForKey(CCHashMap Map, const void *Key, _Bool *Created);
+static void *CCHashMapSwissTableGetKey(CCHashMap Map, CCHashMapEntry Entry);
+static void *CCHashMapSwissTableGetEntry(CCHashMap Map, CCHashMapEntry Entry);
+static void CCHashMapSwissTableSetEntry(CCHashMap Map, CCHashMapEntry Entry, const void *Value);
+static void CCHashMapSwissTableRemoveEntry(CCHashMap Map, CCHashMapEntry Entry);
+static void *CCHashMapSwissTableGetValue(CCHashMap Map, const void *Key);
+static void CCHashMapSwissTableSetValue(CCHashMap Map, const void *Key, const void *Value);
+static void CCHashMapSwissTableRemoveValue(CCHashMap Map, const void *Key);
+static CCOrderedCollection CCHashMapSwissTableGetKeys(CCHashMap Map);
+static CCOrderedCollection CCHashMapSwissTableGetValues(CCHashMap Map);
+static void *CCHashMapSwissTableEnumerator(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorAction Action, CCHashMapEnumeratorType Type);
+static CCHashMapEntry CCHashMapSwissTableEnumeratorEntry(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorType Type);
+static size_t CCHashMapSwissTableGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values);
+
+
+const CCHashMapInterface CCHashMapSwissTableInterface = {
+    .create = CCHashMapSwissTableConstructor,
+    .destroy = (CCHashMapDestructorCallback)CCHashMapSwissTableDestructor,
+    .count = CCHashMapSwissTableGetCount,
+    .initialized = CCHashMapSwissTableEntryIsInitialized,
+    .findKey = CCHashMapSwissTableFindKey,
+    .entryForKey = CCHashMapSwissTableEntryForKey,
+    .getKey = CCHashMapSwissTableGetKey,
+    .getEntry = CCHashMapSwissTableGetEntry,
+    .setEntry = CCHashMapSwissTableSetEntry,
+    .removeEntry = CCHashMapSwissTableRemoveEntry,
+    .enumerator = CCHashMapSwissTableEnumerator,
+    .enumeratorReference = CCHashMapSwissTableEnumeratorEntry,
+    .optional = {
+        .rehash = CCHashMapSwissTableRehash,
+        .getValue = CCHashMapSwissTableGetValue,
+        .setValue = CCHashMapSwissTableSetValue,
+        .removeValue = CCHashMapSwissTableRemoveValue,
+        .keys = CCHashMapSwissTableGetKeys,
+        .values = CCHashMapSwissTableGetValues,
+        .findKeyWithHash = CCHashMapSwissTableFindKeyWithHash,
+        .prefetch = CCHashMapSwissTablePrefetch,
+        .build = CCHashMapSwissTableBuild,
+        .batch = CCHashMapSwissTableGetNextBatch
+    }
+};
+
+const CCHashMapInterface * const CCHashMapSwissTable = &CCHashMapSwissTableInterface;
+
+
+#define GROUP_WIDTH 16
+
+#define CONTROL_EMPTY ((int8_t)-128)
+#define CONTROL_DELETED ((int8_t)-2)
+
+static inline _Bool ControlIsFull(int8_t Control)
+{
+    return Control >= 0;
+}
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE2
+static inline uint32_t GroupMatch(const int8_t *Group, int8_t Control)
+{
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Control), _mm_loadu_si128((const __m128i*)Group)));
+}
+
+static inline uint32_t GroupMatchEmptyOrDeleted(const int8_t *Group)
+{
+    return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), _mm_loadu_si128((const __m128i*)Group)));
+}
+#else
+static inline uint32_t GroupMatch(const int8_t *Group, int8_t Control)
+{
+    uint32_t Mask = 0;
+    for (size_t Loop = 0; Loop < GROUP_WIDTH; Loop++) Mask |= (uint32_t)(Group[Loop] == Control) << Loop;
+    
+    return Mask;
+}
+
+static inline uint32_t GroupMatchEmptyOrDeleted(const int8_t *Group)
+{
+    uint32_t Mask = 0;
+    for (size_t Loop = 0; Loop < GROUP_WIDTH; Loop++) Mask |= (uint32_t)(Group[Loop] < -1) << Loop;
+    
+    return Mask;
+}
+#endif
+
+static inline size_t GroupMatchIndex(uint32_t Mask)
+{
+    return CCBitCountSet(CCBitLowestSet(Mask) - 1);
+}
+
+static inline uint64_t MixHash(uintmax_t Hash)
+{
+    //Spread the bits so keys hashed to themselves (the default) don't all share the same group or tag
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdULL;
+    Hash ^= Hash >> 33;
+    
+    return Hash;
+}
+
+static inline int8_t HashTag(uint64_t Hash)
+{
+    return Hash & 0x7f;
+}
+
+static inline size_t HashGroup(uint64_t Hash)
+{
+    return Hash >> 7;
+}
+
+static inline size_t CapacityForBucketCount(size_t BucketCount)
+{
+    return BucketCount > GROUP_WIDTH ? CCBitNextPowerOf2(BucketCount) : GROUP_WIDTH;
+}
+
+static inline size_t MaxLoad(size_t Capacity)
+{
+    return Capacity - (Capacity / 8);
+}
+
+static inline void *GetSlotKey(CCHashMap Map, size_t Slot)
+{
+    return ((CCHashMapSwissTableInternal*)Map->internal)->slots + (Slot * (Map->keySize + Map->valueSize));
+}
+
+static inline void *GetSlotValue(CCHashMap Map, size_t Slot)
+{
+    return GetSlotKey(Map, Slot) + Map->keySize;
+}
+
+static inline _Bool SlotIsInitialized(CCHashMap Map, size_t Slot)
+{
+    return ((CCHashMapSwissTableInternal*)Map->internal)->initialized[Slot / 8] & (1 << (Slot % 8));
+}
+
+static inline void SetSlotInitialized(CCHashMap Map, size_t Slot, _Bool Initialized)
+{
+    uint8_t *Flags = &((CCHashMapSwissTableInternal*)Map->internal)->initialized[Slot / 8];
+    
+    if (Initialized) *Flags |= (1 << (Slot % 8));
+    else *Flags &= ~(1 << (Slot % 8));
+}
+
+static _Bool CreateTable(CCHashMap Map, size_t Capacity)
+{
+    CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    const size_t SlotOffset = (Capacity + (Capacity / 8) + (GROUP_WIDTH - 1)) & ~(size_t)(GROUP_WIDTH - 1);
+    void *Table = CCMalloc(Map->allocator, SlotOffset + (Capacity * (Map->keySize + Map->valueSize)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Table) return FALSE;
+    
+    memset(Table, CONTROL_EMPTY, Capacity);
+    memset(Table + Capacity, 0, Capacity / 8);
+    
+    Internal->capacity = Capacity;
+    Internal->growthLeft = MaxLoad(Capacity) - Internal->count;
+    Internal->control = Table;
+    Internal->initialized = Table + Capacity;
+    Internal->slots = Table + SlotOffset;
+    
+    return TRUE;
+}
+
+static _Bool FindSlot(CCHashMap Map, const void *Key, uint64_t Hash, size_t *Slot)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    if (!Internal->control) return FALSE;
+    
+    const int8_t Tag = HashTag(Hash);
+    const size_t GroupMask = (Internal->capacity / GROUP_WIDTH) - 1;
+    
+    //Triangular probing over groups, which will visit every group as the group count is a power of 2
+    for (size_t Group = HashGroup(Hash) & GroupMask, Probe = 0; Probe <= GroupMask; Group = (Group + ++Probe) & GroupMask)
+    {
+        const int8_t *Control = Internal->control + (Group * GROUP_WIDTH);
+        for (uint32_t Match = GroupMatch(Control, Tag); Match; Match &= Match - 1)
+        {
+            const size_t Index = (Group * GROUP_WIDTH) + GroupMatchIndex(Match);
+            const void *SlotKey = GetSlotKey(Map, Index);
+            
+            if (Map->compareKeys ? Map->compareKeys(Key, SlotKey) == CCComparisonResultEqual : !memcmp(Key, SlotKey, Map->keySize))
+            {
+                *Slot = Index;
+                return TRUE;
+            }
+        }
+        
+        if (GroupMatch(Control, CONTROL_EMPTY)) break;
+    }
+    
+    return FALSE;
+}
+
+static _Bool FindInsertSlot(CCHashMap Map, uint64_t Hash, size_t *Slot)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    const size_t GroupMask = (Internal->capacity / GROUP_WIDTH) - 1;
+    
+    for (size_t Group = HashGroup(Hash) & GroupMask, Probe = 0; Probe <= GroupMask; Group = (Group + ++Probe) & GroupMask)
+    {
+        const uint32_t Match = GroupMatchEmptyOrDeleted(Internal->control + (Group * GROUP_WIDTH));
+        if (Match)
+        {
+            *Slot = (Group * GROUP_WIDTH) + GroupMatchIndex(Match);
+            return TRUE;
+        }
+    }
+    
+    return FALSE;
+}
+
+static CCHashMapEntry AddValue(CCHashMap Map, uint64_t Hash, const void *Key, const void *Value)
+{
+    CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    if (!Internal->control)
+    {
+        if (!CreateTable(Map, Internal->capacity)) return 0;
+    }
+    
+    else if (!Internal->growthLeft)
+    {
+        //Only grow if the map is actually full, otherwise it's cheaper to discard the tombstones
+        CCHashMapRehash(Map, Internal->count >= (Internal->capacity / 2) ? Internal->capacity * 2 : Internal->capacity);
+    }
+    
+    size_t Slot;
+    if (!FindInsertSlot(Map, Hash, &Slot))
+    {
+        CC_LOG_ERROR("Failed to insert into hashmap (%p): No available slots", Map);
+        return 0;
+    }
+    
+    if (Internal->control[Slot] == CONTROL_EMPTY) Internal->growthLeft--;
+    
+    Internal->control[Slot] = HashTag(Hash);
+    memcpy(GetSlotKey(Map, Slot), Key, Map->keySize);
+    if (Value) memcpy(GetSlotValue(Map, Slot), Value, Map->valueSize);
+    SetSlotInitialized(Map, Slot, Value != NULL);
+    Internal->count++;
+    
+    return Slot + 1;
+}
+
+static void RemoveValue(CCHashMap Map, size_t Slot)
+{
+    CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    CCAssertLog(ControlIsFull(Internal->control[Slot]), "Entry has been removed");
+    
+    /*
+     Probing is group aligned, so if the group still has an empty slot then it has never been full and
+     no probe could have continued past it. In which case the slot can be freed instead of leaving a
+     tombstone.
+     */
+    if (GroupMatch(Internal->control + (Slot & ~(size_t)(GROUP_WIDTH - 1)), CONTROL_EMPTY))
+    {
+        Internal->control[Slot] = CONTROL_EMPTY;
+        Internal->growthLeft++;
+    }
+    
+    else Internal->control[Slot] = CONTROL_DELETED;
+    
+    SetSlotInitialized(Map, Slot, FALSE);
+    Internal->count--;
+}
+
+static void *CCHashMapSwissTableConstructor(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t BucketCount)
+{
+    CCHashMapSwissTableInternal *Map = CCMalloc(Allocator, sizeof(CCHashMapSwissTableInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Map)
+    {
+        *Map = (CCHashMapSwissTableInternal){
+            .count = 0,
+            .capacity = CapacityForBucketCount(BucketCount),
+            .growthLeft = 0,
+            .control = NULL,
+            .initialized = NULL,
+            .slots = NULL
+        };
+    }
+    
+    return Map;
+}
+
+static void CCHashMapSwissTableDestructor(CCHashMapSwissTableInternal *Internal)
+{
+    if (Internal->control) CC_SAFE_Free(Internal->control);
+    
+    CC_SAFE_Free(Internal);
+}
+
+static size_t CCHashMapSwissTableGetCount(CCHashMap Map)
+{
+    return ((CCHashMapSwissTableInternal*)Map->internal)->count;
+}
+
+static void CCHashMapSwissTableRehash(CCHashMap Map, size_t BucketCount)
+{
+    CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    size_t Capacity = CapacityForBucketCount(BucketCount);
+    while (MaxLoad(Capacity) <= Internal->count) Capacity *= 2;
+    
+    if (!Internal->control)
+    {
+        Internal->capacity = Capacity;
+        return;
+    }
+    
+    //Nothing to do if the size is unchanged and there are no tombstones
+    if ((Capacity == Internal->capacity) && (Internal->growthLeft == (MaxLoad(Capacity) - Internal->count))) return;
+    
+    const CCHashMapSwissTableInternal Old = *Internal;
+    if (!CreateTable(Map, Capacity)) return;
+    
+    const size_t SlotSize = Map->keySize + Map->valueSize;
+    for (size_t Loop = 0; Loop < Old.capacity; Loop++)
+    {
+        if (ControlIsFull(Old.control[Loop]))
+        {
+            const void *OldSlot = Old.slots + (Loop * SlotSize);
+            const uint64_t Hash = MixHash(CCHashMapGetKeyHash(Map, OldSlot));
+            
+            size_t Slot;
+            FindInsertSlot(Map, Hash, &Slot);
+            
+            Internal->control[Slot] = HashTag(Hash);
+            memcpy(GetSlotKey(Map, Slot), OldSlot, SlotSize);
+            SetSlotInitialized(Map, Slot, Old.initialized[Loop / 8] & (1 << (Loop % 8)));
+        }
+    }
+    
+    CCFree(Old.control);
+}
+
+static void CCHashMapSwissTableBuild(CCHashMap Map, const void *Keys, const void *Values, const uintmax_t *Hashes, size_t Count)
+{
+    CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    CCAssertLog(!Internal->control, "Map must be empty");
+    
+    //Size the table so it never needs to grow while adding the entries
+    size_t Capacity = CapacityForBucketCount(Count);
+    while (MaxLoad(Capacity) < Count) Capacity *= 2;
+    
+    Internal->capacity = Capacity;
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const void *Key = Keys + (Loop * Map->keySize), *Value = Values ? Values + (Loop * Map->valueSize) : NULL;
+        const uint64_t Hash = MixHash(Hashes[Loop]);
+        
+        size_t Slot;
+        if (FindSlot(Map, Key, Hash, &Slot))
+        {
+            if (Value)
+            {
+                memcpy(GetSlotValue(Map, Slot), Value, Map->valueSize);
+                SetSlotInitialized(Map, Slot, TRUE);
+            }
+        }
+        
+        else AddValue(Map, Hash, Key, Value);
+    }
+}
+
+static _Bool CCHashMapSwissTableEntryIsInitialized(CCHashMap Map, CCHashMapEntry Entry)
+{
+    if (Entry)
+    {
+#if !CC_NO_ASSERT
+        CCAssertLog(ControlIsFull(((CCHashMapSwissTableInternal*)Map->internal)->control[Entry - 1]), "Entry has been removed");
+#endif
+        
+        return SlotIsInitialized(Map, Entry - 1);
+    }
+    
+    return FALSE;
+}
+
+static CCHashMapEntry CCHashMapSwissTableFindKey(CCHashMap Map, const void *Key)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(CCHashMapGetKeyHash(Map, Key)), &Slot)) return Slot + 1;
+    
+    return 0;
+}
+
+static CCHashMapEntry CCHashMapSwissTableFindKeyWithHash(CCHashMap Map, const void *Key, uintmax_t Hash)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(Hash), &Slot)) return Slot + 1;
+    
+    return 0;
+}
+
+static void CCHashMapSwissTablePrefetch(CCHashMap Map, uintmax_t Hash)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    if (Internal->control)
+    {
+        const size_t Group = HashGroup(MixHash(Hash)) & ((Internal->capacity / GROUP_WIDTH) - 1);
+        
+        CC_PREFETCH(Internal->control + (Group * GROUP_WIDTH));
+        CC_PREFETCH(GetSlotKey(Map, Group * GROUP_WIDTH));
+    }
+}
+
+static CCHashMapEntry CCHashMapSwissTableEntryForKey(CCHashMap Map, const void *Key, _Bool *Created)
+{
+    const uint64_t Hash = MixHash(CCHashMapGetKeyHash(Map, Key));
+    
+    size_t Slot;
+    if (FindSlot(Map, Key, Hash, &Slot))
+    {
+        if (Created) *Created = FALSE;
+        return Slot + 1;
+    }
+    
+    else
+    {
+        if (Created) *Created = TRUE;
+        return AddValue(Map, Hash, Key, NULL);
+    }
+}
+
+static void *CCHashMapSwissTableGetKey(CCHashMap Map, CCHashMapEntry Entry)
+{
+    void *Key = NULL;
+    if (Entry)
+    {
+#if !CC_NO_ASSERT
+        CCAssertLog(ControlIsFull(((CCHashMapSwissTableInternal*)Map->internal)->control[Entry - 1]), "Entry has been removed");
+#endif
+        
+        Key = GetSlotKey(Map, Entry - 1);
+    }
+    
+    return Key;
+}
+
+static void *CCHashMapSwissTableGetEntry(CCHashMap Map, CCHashMapEntry Entry)
+{
+    void *Value = NULL;
+    if (Entry)
+    {
+#if !CC_NO_ASSERT
+        CCAssertLog(ControlIsFull(((CCHashMapSwissTableInternal*)Map->internal)->control[Entry - 1]), "Entry has been removed");
+#endif
+        
+        Value = GetSlotValue(Map, Entry - 1);
+    }
+    
+    return Value;
+}
+
+static void CCHashMapSwissTableSetEntry(CCHashMap Map, CCHashMapEntry Entry, const void *Value)
+{
+    if (Entry)
+    {
+#if !CC_NO_ASSERT
+        CCAssertLog(ControlIsFull(((CCHashMapSwissTableInternal*)Map->internal)->control[Entry - 1]), "Entry has been removed");
+#endif
+        
+        SetSlotInitialized(Map, Entry - 1, TRUE);
+        memcpy(GetSlotValue(Map, Entry - 1), Value, Map->valueSize);
+    }
+}
+
+static void CCHashMapSwissTableRemoveEntry(CCHashMap Map, CCHashMapEntry Entry)
+{
+    if (Entry) RemoveValue(Map, Entry - 1);
+}
+
+static void *CCHashMapSwissTableGetValue(CCHashMap Map, const void *Key)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(CCHashMapGetKeyHash(Map, Key)), &Slot)) return GetSlotValue(Map, Slot);
+    
+    return NULL;
+}
+
+static void CCHashMapSwissTableSetValue(CCHashMap Map, const void *Key, const void *Value)
+{
+    const uint64_t Hash = MixHash(CCHashMapGetKeyHash(Map, Key));
+    
+    size_t Slot;
+    if (FindSlot(Map, Key, Hash, &Slot))
+    {
+        SetSlotInitialized(Map, Slot, TRUE);
+        memcpy(GetSlotValue(Map, Slot), Value, Map->valueSize);
+    }
+    
+    else AddValue(Map, Hash, Key, Value);
+}
+
+static void CCHashMapSwissTableRemoveValue(CCHashMap Map, const void *Key)
+{
+    size_t Slot;
+    if (FindSlot(Map, Key, MixHash(CCHashMapGetKeyHash(Map, Key)), &Slot)) RemoveValue(Map, Slot);
+}
+
+static CCOrderedCollection CCHashMapSwissTableGetKeys(CCHashMap Map)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    CCOrderedCollection Keys = CCCollectionCreate(Map->allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Map->keySize, NULL);
+    
+    if (Internal->control)
+    {
+        for (size_t Loop = 0; Loop < Internal->capacity; Loop++)
+        {
+            if (ControlIsFull(Internal->control[Loop])) CCOrderedCollectionAppendElement(Keys, GetSlotKey(Map, Loop));
+        }
+    }
+    
+    return Keys;
+}
+
+static CCOrderedCollection CCHashMapSwissTableGetValues(CCHashMap Map)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    CCOrderedCollection Values = CCCollectionCreate(Map->allocator, CCCollectionHintOrdered | CCCollectionHintConstantLength | CCCollectionHintHeavyEnumerating, Map->valueSize, NULL);
+    
+    if (Internal->control)
+    {
+        for (size_t Loop = 0; Loop < Internal->capacity; Loop++)
+        {
+            if (ControlIsFull(Internal->control[Loop])) CCOrderedCollectionAppendElement(Values, GetSlotValue(Map, Loop));
+        }
+    }
+    
+    return Values;
+}
+
+static CCHashMapEntry GetNextEntry(CCHashMap Map, size_t Slot)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    if (Internal->control)
+    {
+        for ( ; Slot < Internal->capacity; Slot++)
+        {
+            if (ControlIsFull(Internal->control[Slot])) return Slot + 1;
+        }
+    }
+    
+    return 0;
+}
+
+static CCHashMapEntry GetPrevEntry(CCHashMap Map, size_t Slot)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    if (Internal->control)
+    {
+        for ( ; Slot > 0; Slot--)
+        {
+            if (ControlIsFull(Internal->control[Slot - 1])) return Slot;
+        }
+    }
+    
+    return 0;
+}
+
+static void *CCHashMapSwissTableEnumerator(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorAction Action, CCHashMapEnumeratorType Type)
+{
+    void *(*GetElement)(CCHashMap, CCHashMapEntry) = Type == CCHashMapEnumeratorTypeKey ? CCHashMapSwissTableGetKey : CCHashMapSwissTableGetEntry;
+    
+    switch (Action)
+    {
+        case CCCollectionEnumeratorActionHead:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetNextEntry(Map, 0);
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionTail:
+            Enumerator->type = CCEnumeratorFormatInternal;
+            Enumerator->internal.extra[0] = GetPrevEntry(Map, ((CCHashMapSwissTableInternal*)Map->internal)->capacity);
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionNext:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetNextEntry(Map, Enumerator->internal.extra[0]) : 0;
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionPrevious:
+            Enumerator->internal.extra[0] = Enumerator->internal.extra[0] ? GetPrevEntry(Map, Enumerator->internal.extra[0] - 1) : 0;
+            Enumerator->internal.ptr = GetElement(Map, Enumerator->internal.extra[0]);
+            break;
+            
+        case CCCollectionEnumeratorActionCurrent:
+            break;
+    }
+    
+    return Enumerator->internal.ptr;
+}
+
+static CCHashMapEntry CCHashMapSwissTableEnumeratorEntry(CCHashMap Map, CCEnumeratorState *Enumerator, CCHashMapEnumeratorType Type)
+{
+    return Enumerator->internal.extra[0];
+}
+
+static size_t CCHashMapSwissTableGetNextBatch(CCHashMap Map, CCEnumeratorState *Cursor, CCEnumeratorState *Keys, CCEnumeratorState *Values)
+{
+    const CCHashMapSwissTableInternal *Internal = Map->internal;
+    
+    if (!Internal->control) return 0;
+    
+    //The cursor holds the slot following the previous batch
+    size_t Slot = Cursor->internal.extra[0];
+    while ((Slot < Internal->capacity) && (!ControlIsFull(Internal->control[Slot]))) Slot++;
+    
+    size_t Count = 0;
+    while ((Slot + Count < Internal->capacity) && (ControlIsFull(Internal->control[Slot + Count]))) Count++;
+    
+    if (!Count) return 0;
+    
+    Cursor->internal.extra[0] = Slot + Count;
+    
+    if (Keys) *Keys = (CCEnumeratorState){ .batch = { .ptr = GetSlotKey(Map, Slot), .count = Count, .stride = Map->keySize + Map->valueSize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+    if (Values) *Values = (CCEnumeratorState){ .batch = { .ptr = GetSlotValue(Map, Slot), .count = Count, .stride = Map->keySize + Map->valueSize, .index = 0 }, .type = CCEnumeratorFormatBatch };
+    
+    return Count;
+}
@@ -0,0 +1,55 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCHashMapSwissTable
+ * CCHashMapSwissTable is an interface for an open addressing hashmap implementation. Every slot has a
+ * 1 byte control tag (containing 7 bits of the hash) stored separately from the keys and values, the tags
+ * of a group of slots are then matched in parallel (using SSE2 when available). Keys and values are stored
+ * inline in a single allocation.
+ *
+ * The bucket count is used as the minimum slot capacity (rounded up to a power of 2). The map will grow
+ * itself if it becomes too full, at which point any entry references will be invalidated.
+ *
+ * Removals only leave behind a tombstone if the group the slot belongs to was full, as a probe may have
+ * continued past it. Tombstones are reused by insertions and discarded by a rehash.
+ *
+ * Fast Operations:
+ * - Lookup.
+ * - Insertion.
+ * - Removal.
+ *
+ * Moderate Operations:
+ * - Enumerating of keys.
+ * - Enumerating of values.
+ */
+#ifndef CommonC_HashMapSwissTable_h
+#define CommonC_HashMapSwissTable_h
+
+#include <CommonC/HashMapInterface.h>
+
+extern const CCHashMapInterface * const CCHashMapSwissTable;
+
+#endif
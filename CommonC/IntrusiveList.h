@@ -0,0 +1,345 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCIntrusiveList
+ * CCIntrusiveList implements an allocation free doubly linked list, where the @b CCLinkedListNode
+ * link is embedded inside the user's own structure.
+ *
+ * The list only references the nodes, it never allocates, copies, or destroys them. This allows
+ * an object to be moved between lists in O(1) by simply relinking it. An object may belong to
+ * multiple lists at the same time by embedding a separate link for each list. The object can be
+ * retrieved from its link using @b CC_INTRUSIVE_LIST_ENTRY.
+ *
+ * Nodes can also be traversed with the @b CCLinkedList enumeration functions, however a node must
+ * only be inserted or removed through the functions below so the list's head, tail, and count are
+ * kept up to date.
+ */
+
+#ifndef CommonC_IntrusiveList_h
+#define CommonC_IntrusiveList_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Assertion.h>
+#include <CommonC/LinkedList.h>
+#include <stddef.h>
+
+typedef struct {
+    CCLinkedListNode *head;
+    CCLinkedListNode *tail;
+    size_t count;
+} CCIntrusiveList;
+
+/*!
+ * @define CC_INTRUSIVE_LIST_INIT
+ * @abstract Convenient macro to initialize an empty @b CCIntrusiveList.
+ */
+#define CC_INTRUSIVE_LIST_INIT { .head = NULL, .tail = NULL, .count = 0 }
+
+/*!
+ * @define CC_INTRUSIVE_LIST_ENTRY
+ * @abstract Convenient macro to get the structure containing a list node.
+ * @param node The pointer to the @b CCLinkedListNode.
+ * @param type The type of the structure containing the node.
+ * @param member The name of the node member in the structure.
+ * @return The pointer to the structure.
+ */
+#define CC_INTRUSIVE_LIST_ENTRY(node, type, member) ((type*)((void*)(node) - offsetof(type, member)))
+
+/*!
+ * @define CC_INTRUSIVE_LIST_FOREACH
+ * @abstract Convenient macro to iterate through each structure in an intrusive list.
+ * @discussion Behaves like a for loop expression, where it should either be followed by parantheses or a
+ *             single line statement. The current element must not be removed while iterating.
+ *
+ * @param type The type of the structure containing the node.
+ * @param member The name of the node member in the structure.
+ * @param element The name for the element variable. This will be a pointer to the type.
+ * @param list The pointer to the @b CCIntrusiveList to iterate through.
+ */
+#define CC_INTRUSIVE_LIST_FOREACH(type, member, element, list) \
+for (CCLinkedListNode *CC_PRIV_##element##__ = (list)->head; CC_PRIV_##element##__; CC_PRIV_##element##__ = NULL) \
+for (type *element = CC_INTRUSIVE_LIST_ENTRY(CC_PRIV_##element##__, type, member); CC_PRIV_##element##__; CC_PRIV_##element##__ = CC_PRIV_##element##__->next, element = CC_PRIV_##element##__ ? CC_INTRUSIVE_LIST_ENTRY(CC_PRIV_##element##__, type, member) : NULL)
+
+
+#pragma mark - Insertions
+/*!
+ * @brief Add the node to the end of the list.
+ * @performance O(1)
+ * @param List The list to append the node to.
+ * @param Node The node to be added. Must not currently be in a list.
+ */
+static inline void CCIntrusiveListAppend(CCIntrusiveList *List, CCLinkedListNode *Node);
+
+/*!
+ * @brief Add the node to the start of the list.
+ * @performance O(1)
+ * @param List The list to prepend the node to.
+ * @param Node The node to be added. Must not currently be in a list.
+ */
+static inline void CCIntrusiveListPrepend(CCIntrusiveList *List, CCLinkedListNode *Node);
+
+/*!
+ * @brief Insert the node after another node in the list.
+ * @performance O(1)
+ * @param List The list to insert the node into.
+ * @param Position The node in the list the new node should follow.
+ * @param Node The node to be added. Must not currently be in a list.
+ */
+static inline void CCIntrusiveListInsertAfter(CCIntrusiveList *List, CCLinkedListNode *Position, CCLinkedListNode *Node);
+
+/*!
+ * @brief Insert the node before another node in the list.
+ * @performance O(1)
+ * @param List The list to insert the node into.
+ * @param Position The node in the list the new node should precede.
+ * @param Node The node to be added. Must not currently be in a list.
+ */
+static inline void CCIntrusiveListInsertBefore(CCIntrusiveList *List, CCLinkedListNode *Position, CCLinkedListNode *Node);
+
+/*!
+ * @brief Move all the nodes of one list to the end of another list.
+ * @description The source list will be empty afterwards.
+ * @performance O(1)
+ * @param List The list to append the nodes to.
+ * @param Source The list to take the nodes from.
+ */
+static inline void CCIntrusiveListSplice(CCIntrusiveList *List, CCIntrusiveList *Source);
+
+
+#pragma mark - Removal
+/*!
+ * @brief Remove the node from the list.
+ * @performance O(1)
+ * @param List The list the node belongs to.
+ * @param Node The node to be removed. Ownership remains with the caller.
+ */
+static inline void CCIntrusiveListRemove(CCIntrusiveList *List, CCLinkedListNode *Node);
+
+/*!
+ * @brief Remove the node at the start of the list.
+ * @performance O(1)
+ * @param List The list to remove the node from.
+ * @return The removed node, or NULL if the list is empty.
+ */
+static inline CCLinkedListNode *CCIntrusiveListRemoveHead(CCIntrusiveList *List);
+
+/*!
+ * @brief Remove the node at the end of the list.
+ * @performance O(1)
+ * @param List The list to remove the node from.
+ * @return The removed node, or NULL if the list is empty.
+ */
+static inline CCLinkedListNode *CCIntrusiveListRemoveTail(CCIntrusiveList *List);
+
+/*!
+ * @brief Move a node from one list to the end of another list.
+ * @performance O(1)
+ * @param List The list to append the node to.
+ * @param Source The list the node currently belongs to.
+ * @param Node The node to be moved.
+ */
+static inline void CCIntrusiveListMove(CCIntrusiveList *List, CCIntrusiveList *Source, CCLinkedListNode *Node);
+
+
+#pragma mark - Query
+/*!
+ * @brief Get the first node in the list.
+ * @param List The list to get the head of.
+ * @return The head node, or NULL if the list is empty.
+ */
+static inline CCLinkedListNode *CCIntrusiveListGetHead(const CCIntrusiveList *List);
+
+/*!
+ * @brief Get the last node in the list.
+ * @param List The list to get the tail of.
+ * @return The tail node, or NULL if the list is empty.
+ */
+static inline CCLinkedListNode *CCIntrusiveListGetTail(const CCIntrusiveList *List);
+
+/*!
+ * @brief Get the number of nodes in the list.
+ * @param List The list to get the count of.
+ * @return The number of nodes.
+ */
+static inline size_t CCIntrusiveListGetCount(const CCIntrusiveList *List);
+
+/*!
+ * @brief Check whether the list contains any nodes.
+ * @param List The list to check.
+ * @return TRUE if the list is empty, otherwise FALSE.
+ */
+static inline _Bool CCIntrusiveListIsEmpty(const CCIntrusiveList *List);
+
+
+#pragma mark -
+static inline void CCIntrusiveListAppend(CCIntrusiveList *List, CCLinkedListNode *Node)
+{
+    CCAssertLog(List && Node, "List and node must not be null");
+    
+    Node->next = NULL;
+    Node->prev = List->tail;
+    
+    if (List->tail) List->tail->next = Node;
+    else List->head = Node;
+    
+    List->tail = Node;
+    List->count++;
+}
+
+static inline void CCIntrusiveListPrepend(CCIntrusiveList *List, CCLinkedListNode *Node)
+{
+    CCAssertLog(List && Node, "List and node must not be null");
+    
+    Node->prev = NULL;
+    Node->next = List->head;
+    
+    if (List->head) List->head->prev = Node;
+    else List->tail = Node;
+    
+    List->head = Node;
+    List->count++;
+}
+
+static inline void CCIntrusiveListInsertAfter(CCIntrusiveList *List, CCLinkedListNode *Position, CCLinkedListNode *Node)
+{
+    CCAssertLog(List && Position && Node, "List and nodes must not be null");
+    
+    Node->prev = Position;
+    Node->next = Position->next;
+    
+    if (Position->next) Position->next->prev = Node;
+    else List->tail = Node;
+    
+    Position->next = Node;
+    List->count++;
+}
+
+static inline void CCIntrusiveListInsertBefore(CCIntrusiveList *List, CCLinkedListNode *Position, CCLinkedListNode *Node)
+{
+    CCAssertLog(List && Position && Node, "List and nodes must not be null");
+    
+    Node->next = Position;
+    Node->prev = Position->prev;
+    
+    if (Position->prev) Position->prev->next = Node;
+    else List->head = Node;
+    
+    Position->prev = Node;
+    List->count++;
+}
+
+static inline void CCIntrusiveListSplice(CCIntrusiveList *List, CCIntrusiveList *Source)
+{
+    CCAssertLog(List && Source, "Lists must not be null");
+    
+    if (!Source->head) return;
+    
+    if (List->tail)
+    {
+        List->tail->next = Source->head;
+        Source->head->prev = List->tail;
+    }
+    
+    else List->head = Source->head;
+    
+    List->tail = Source->tail;
+    List->count += Source->count;
+    
+    *Source = (CCIntrusiveList)CC_INTRUSIVE_LIST_INIT;
+}
+
+static inline void CCIntrusiveListRemove(CCIntrusiveList *List, CCLinkedListNode *Node)
+{
+    CCAssertLog(List && Node, "List and node must not be null");
+    CCAssertLog(List->count, "List must not be empty");
+    
+    if (Node->prev) Node->prev->next = Node->next;
+    else List->head = Node->next;
+    
+    if (Node->next) Node->next->prev = Node->prev;
+    else List->tail = Node->prev;
+    
+    Node->prev = NULL;
+    Node->next = NULL;
+    
+    List->count--;
+}
+
+static inline CCLinkedListNode *CCIntrusiveListRemoveHead(CCIntrusiveList *List)
+{
+    CCAssertLog(List, "List must not be null");
+    
+    CCLinkedListNode *Node = List->head;
+    if (Node) CCIntrusiveListRemove(List, Node);
+    
+    return Node;
+}
+
+static inline CCLinkedListNode *CCIntrusiveListRemoveTail(CCIntrusiveList *List)
+{
+    CCAssertLog(List, "List must not be null");
+    
+    CCLinkedListNode *Node = List->tail;
+    if (Node) CCIntrusiveListRemove(List, Node);
+    
+    return Node;
+}
+
+static inline void CCIntrusiveListMove(CCIntrusiveList *List, CCIntrusiveList *Source, CCLinkedListNode *Node)
+{
+    CCIntrusiveListRemove(Source, Node);
+    CCIntrusiveListAppend(List, Node);
+}
+
+static inline CCLinkedListNode *CCIntrusiveListGetHead(const CCIntrusiveList *List)
+{
+    CCAssertLog(List, "List must not be null");
+    
+    return List->head;
+}
+
+static inline CCLinkedListNode *CCIntrusiveListGetTail(const CCIntrusiveList *List)
+{
+    CCAssertLog(List, "List must not be null");
+    
+    return List->tail;
+}
+
+static inline size_t CCIntrusiveListGetCount(const CCIntrusiveList *List)
+{
+    CCAssertLog(List, "List must not be null");
+    
+    return List->count;
+}
+
+static inline _Bool CCIntrusiveListIsEmpty(const CCIntrusiveList *List)
+{
+    CCAssertLog(List, "List must not be null");
+    
+    return !List->head;
+}
+
+#endif
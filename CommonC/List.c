@@ -26,15 +26,87 @@
 #define CC_QUICK_COMPILE
 #include "List.h"
 #include "MemoryAllocation.h"
+#include <string.h>
+
+#ifndef CC_LIST_PAGE_DIRECTORY_CAPACITY
+#define CC_LIST_PAGE_DIRECTORY_CAPACITY 4
+#endif
+
+static inline size_t CCListGetPageCount(CCList List)
+{
+    //Static lists only reference their pages, so the page count is determined on first use
+    return List->pageCount ? List->pageCount : (List->count ? ((List->count - 1) / List->pageSize) + 1 : 1);
+}
+
+static CCArray CCListCreatePage(CCAllocatorType Allocator, size_t ElementSize, size_t ChunkSize, size_t PageSize)
+{
+    //Pages never hold more than the page size, so their elements can always be stored inline
+    return CCArrayCreateSmall(Allocator, ElementSize, ChunkSize, PageSize);
+}
+
+static _Bool CCListAddPage(CCList List)
+{
+    if (List->pageCount >= List->pageCapacity)
+    {
+        const size_t Capacity = List->pageCount * 2;
+        
+        CCArray *Pages;
+        if (List->pageCapacity) Pages = CCRealloc(List->allocator, List->pages, sizeof(CCArray) * Capacity, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        else
+        {
+            Pages = CCMalloc(List->allocator, sizeof(CCArray) * Capacity, NULL, CC_DEFAULT_ERROR_CALLBACK);
+            if (Pages) memcpy(Pages, List->pages, sizeof(CCArray) * List->pageCount);
+        }
+        
+        if (!Pages)
+        {
+            CC_LOG_ERROR("Failed to grow page directory for list (%p) to capacity (%zu)", List, Capacity);
+            return FALSE;
+        }
+        
+        List->pages = Pages;
+        List->pageCapacity = Capacity;
+    }
+    
+    CCArray Page = CCListCreatePage(List->allocator, CCListGetElementSize(List), CCListGetChunkSize(List), List->pageSize);
+    if (!Page)
+    {
+        CC_LOG_ERROR("Failed to create page for list (%p)", List);
+        return FALSE;
+    }
+    
+    List->pages[List->pageCount++] = Page;
+    
+    return TRUE;
+}
+
+static void CCListTruncate(CCList List, size_t Count)
+{
+    const size_t PageCount = Count ? ((Count - 1) / List->pageSize) + 1 : 1;
+    
+    for (size_t Loop = PageCount; Loop < List->pageCount; Loop++)
+    {
+        CCArrayDestroy(List->pages[Loop]);
+    }
+    
+    List->pageCount = PageCount;
+    
+    CCArray Page = List->pages[PageCount - 1];
+    const size_t ElementCount = Count - ((PageCount - 1) * List->pageSize), PageElementCount = CCArrayGetCount(Page);
+    
+    if (PageElementCount > ElementCount) CCArrayRemoveElementsAtIndex(Page, ElementCount, PageElementCount - ElementCount);
+    
+    List->count = Count;
+}
 
 static void CCListDestructor(CCList Ptr)
 {
-    for (CCLinkedListNode *Node = Ptr->list; Node; Node = CCLinkedListEnumerateNext(Node))
+    for (size_t Loop = 0, Count = CCListGetPageCount(Ptr); Loop < Count; Loop++)
     {
-        CCArrayDestroy(*(CCArray*)CCLinkedListGetNodeData(Node));
+        CCArrayDestroy(Ptr->pages[Loop]);
     }
     
-    CCLinkedListDestroy(Ptr->list);
+    if (Ptr->pageCapacity) CCFree(Ptr->pages);
 }
 
 CCList CCListCreate(CCAllocatorType Allocator, size_t ElementSize, size_t ChunkSize, size_t PageSize)
@@ -45,18 +117,31 @@ CCList CCListCreate(CCAllocatorType Allocator, size_t ElementSize, size_t ChunkS
     CCList List = CCMalloc(Allocator, sizeof(CCListInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
     if (List)
     {
+        const size_t Diff = PageSize % ChunkSize;
+        if (Diff) PageSize += ChunkSize - Diff;
+        
+        CCArray *Pages = CCMalloc(Allocator, sizeof(CCArray) * CC_LIST_PAGE_DIRECTORY_CAPACITY, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        CCArray Page = Pages ? CCListCreatePage(Allocator, ElementSize, ChunkSize, PageSize) : NULL;
+        
+        if (!Page)
+        {
+            if (Pages) CCFree(Pages);
+            CCFree(List);
+            
+            return NULL;
+        }
+        
+        Pages[0] = Page;
+        
         *List = (CCListInfo){
             .count = 0,
             .pageSize = PageSize,
-            .list = CCLinkedListCreateNode(Allocator, sizeof(CCArray), &(CCArray){ CCArrayCreate(Allocator, ElementSize, ChunkSize) }),
+            .pageCount = 1,
+            .pageCapacity = CC_LIST_PAGE_DIRECTORY_CAPACITY,
+            .pages = Pages,
             .allocator = Allocator
         };
         
-        List->last = List->list;
-        
-        const size_t Diff = PageSize % ChunkSize;
-        if (Diff) List->pageSize += ChunkSize - Diff;
-        
         CCMemorySetDestructor(List, (CCMemoryDestructorCallback)CCListDestructor);
     }
     
@@ -75,19 +160,16 @@ size_t CCListAppendElement(CCList List, const void *Element)
 {
     CCAssertLog(List, "List must not be null");
     
-    if (!List->last) List->last = CCLinkedListGetTail(List->list);
+    if (!List->pageCount) List->pageCount = CCListGetPageCount(List);
     
-    CCLinkedListNode *Node = List->last;
-    CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Node);
-    
-    if (CCArrayGetCount(Array) == List->pageSize)
+    if (CCArrayGetCount(List->pages[List->pageCount - 1]) == List->pageSize)
     {
-        Array = CCArrayCreate(List->allocator, CCArrayGetElementSize(Array), CCArrayGetChunkSize(Array));
-        List->last = CCLinkedListAppend(Node, CCLinkedListCreateNode(List->allocator, sizeof(CCArray), &Array));
+        if (!CCListAddPage(List)) return SIZE_MAX;
     }
     
-    size_t Index = CCArrayAppendElement(Array, Element);
+    size_t Index = CCArrayAppendElement(List->pages[List->pageCount - 1], Element);
     if (Index != SIZE_MAX) Index = List->count++;
+    else CCListTruncate(List, List->count);
     
     return Index;
 }
@@ -96,50 +178,32 @@ size_t CCListAppendElements(CCList List, const void *Elements, size_t Count)
 {
     CCAssertLog(List, "List must not be null");
     
-    if (!List->last) List->last = CCLinkedListGetTail(List->list);
+    if (!List->pageCount) List->pageCount = CCListGetPageCount(List);
     
-    CCLinkedListNode *Node = List->last;
+    const size_t ElementSize = CCListGetElementSize(List);
     
     for (size_t Loop = 0; Loop < Count; )
     {
-        CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Node);
-        size_t Available = List->pageSize - CCArrayGetCount(Array), CopyCount = Count - Loop;
+        CCArray Page = List->pages[List->pageCount - 1];
+        size_t Available = List->pageSize - CCArrayGetCount(Page);
         
-        if (CopyCount > Available)
+        if (!Available)
         {
-            Node = CCLinkedListAppend(Node, CCLinkedListCreateNode(List->allocator, sizeof(CCArray), &(CCArray){ CCArrayCreate(List->allocator, CCArrayGetElementSize(Array), CCArrayGetChunkSize(Array)) }));
-            List->last = Node;
-            
-            if (!Available)
+            if (!CCListAddPage(List))
             {
-                Available = List->pageSize;
-                Array = *(CCArray*)CCLinkedListGetNodeData(Node);
+                CCListTruncate(List, List->count);
+                return SIZE_MAX;
             }
             
-            CopyCount = Available;
+            Page = List->pages[List->pageCount - 1];
+            Available = List->pageSize;
         }
         
-        if (CCArrayAppendElements(Array, Elements + (Loop * CCArrayGetElementSize(Array)), CopyCount) == SIZE_MAX)
+        const size_t CopyCount = (Count - Loop) < Available ? (Count - Loop) : Available;
+        
+        if (CCArrayAppendElements(Page, Elements ? Elements + (Loop * ElementSize) : NULL, CopyCount) == SIZE_MAX)
         {
-            if (Loop)
-            {
-                const size_t PageIndex = List->count / List->pageSize;
-                
-                CCLinkedListNode *Page = List->list;
-                for (size_t Loop = 0; Loop < PageIndex; Loop++)
-                {
-                    Page = CCLinkedListEnumerateNext(Page);
-                }
-                
-                CCLinkedListNode *Node = CCLinkedListEnumerateNext(Page);
-                if (Node) CCLinkedListDestroy(Node);
-                
-                const size_t ElementIndex = List->count - (PageIndex * List->pageSize);
-                CCArrayRemoveElementsAtIndex(*(CCArray*)CCLinkedListGetNodeData(Page), ElementIndex, List->pageSize - ElementIndex);
-                
-                List->last = Page;
-            }
-            
+            CCListTruncate(List, List->count);
             return SIZE_MAX;
         }
         
@@ -160,9 +224,7 @@ void CCListReplaceElementAtIndex(CCList List, size_t Index, const void *Element)
     const size_t PageIndex = Index / List->pageSize;
     const size_t ElementIndex = Index - (PageIndex * List->pageSize);
     
-    CCLinkedListNode *Page = CCListGetPage(List, PageIndex);
-    
-    CCArrayReplaceElementAtIndex(*(CCArray*)CCLinkedListGetNodeData(Page), ElementIndex, Element);
+    CCArrayReplaceElementAtIndex(CCListGetPage(List, PageIndex), ElementIndex, Element);
 }
 
 size_t CCListInsertElementAtIndex(CCList List, size_t Index, const void *Element)
@@ -170,32 +232,19 @@ size_t CCListInsertElementAtIndex(CCList List, size_t Index, const void *Element
     CCAssertLog(List, "List must not be null");
     CCAssertLog(List->count > Index, "Index must not be out of bounds");
     
-    if (!List->last) List->last = CCLinkedListGetTail(List->list);
+    if (!List->pageCount) List->pageCount = CCListGetPageCount(List);
     
     const size_t PageIndex = Index / List->pageSize;
     const size_t ElementIndex = Index - (PageIndex * List->pageSize);
     
-    CCLinkedListNode *Page = CCListGetPage(List, PageIndex);
-    
-    CCLinkedListNode *Node = List->last, *Tail;
-    CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Node);
-    if (CCArrayGetCount(Array) == List->pageSize)
-    {
-        CCArray NextArray = CCArrayCreate(List->allocator, CCArrayGetElementSize(Array), CCArrayGetChunkSize(Array));
-        CCLinkedListAppend(Node, Tail = CCLinkedListCreateNode(List->allocator, sizeof(CCArray), &NextArray));
-        
-        List->last = Tail;
-    }
-    
-    else
+    if (CCArrayGetCount(List->pages[List->pageCount - 1]) == List->pageSize)
     {
-        Tail = Node;
-        Node = CCLinkedListEnumeratePrevious(Tail);
+        if (!CCListAddPage(List)) return SIZE_MAX;
     }
     
-    for ( ; (Tail != Page); Tail = Node, Node = CCLinkedListEnumeratePrevious(Node))
+    for (size_t Loop = List->pageCount - 1; Loop > PageIndex; Loop--)
     {
-        CCArray Src = *(CCArray*)CCLinkedListGetNodeData(Node), Dst = *(CCArray*)CCLinkedListGetNodeData(Tail);
+        CCArray Src = List->pages[Loop - 1], Dst = List->pages[Loop];
         const void *LastElement = CCArrayGetElementAtIndex(Src, List->pageSize - 1);
         
         if (CCArrayGetCount(Dst)) CCArrayInsertElementAtIndex(Dst, 0, LastElement);
@@ -204,11 +253,11 @@ size_t CCListInsertElementAtIndex(CCList List, size_t Index, const void *Element
         CCArrayRemoveElementAtIndex(Src, List->pageSize - 1);
     }
     
-    Array = *(CCArray*)CCLinkedListGetNodeData(Page);
+    CCArray Page = List->pages[PageIndex];
     
     size_t Result;
-    if (ElementIndex == CCArrayGetCount(Array)) Result = CCArrayAppendElement(Array, Element);
-    else Result = CCArrayInsertElementAtIndex(Array, ElementIndex, Element);
+    if (ElementIndex == CCArrayGetCount(Page)) Result = CCArrayAppendElement(Page, Element);
+    else Result = CCArrayInsertElementAtIndex(Page, ElementIndex, Element);
     
     if (Result == SIZE_MAX)
     {
@@ -226,27 +275,26 @@ void CCListRemoveElementAtIndex(CCList List, size_t Index)
     CCAssertLog(List, "List must not be null");
     CCAssertLog(List->count > Index, "Index must not be out of bounds");
     
+    if (!List->pageCount) List->pageCount = CCListGetPageCount(List);
+    
     const size_t PageIndex = Index / List->pageSize;
     const size_t ElementIndex = Index - (PageIndex * List->pageSize);
     
-    CCLinkedListNode *Page = CCListGetPage(List, PageIndex);
-    
-    CCArrayRemoveElementAtIndex(*(CCArray*)CCLinkedListGetNodeData(Page), ElementIndex);
+    CCArrayRemoveElementAtIndex(List->pages[PageIndex], ElementIndex);
     
-    for (CCLinkedListNode *Node = CCLinkedListEnumerateNext(Page); Node; Node = CCLinkedListEnumerateNext(Node))
+    for (size_t Loop = PageIndex + 1; Loop < List->pageCount; Loop++)
     {
-        CCArrayAppendElement(*(CCArray*)CCLinkedListGetNodeData(Page), CCArrayGetElementAtIndex(*(CCArray*)CCLinkedListGetNodeData(Node), 0));
-        CCArrayRemoveElementAtIndex(*(CCArray*)CCLinkedListGetNodeData(Node), 0);
+        CCArray Src = List->pages[Loop], Dst = List->pages[Loop - 1];
         
-        Page = Node;
+        CCArrayAppendElement(Dst, CCArrayGetElementAtIndex(Src, 0));
+        CCArrayRemoveElementAtIndex(Src, 0);
     }
     
     List->count--;
     
-    if ((List->count) && (!CCArrayGetCount(*(CCArray*)CCLinkedListGetNodeData(Page))))
+    if ((List->count) && (!CCArrayGetCount(List->pages[List->pageCount - 1])))
     {
-        List->last = CCLinkedListEnumeratePrevious(Page);
-        CCLinkedListDestroyNode(Page);
+        CCArrayDestroy(List->pages[--List->pageCount]);
     }
 }
 
@@ -254,29 +302,23 @@ void CCListRemoveAllElements(CCList List)
 {
     CCAssertLog(List, "List must not be null");
     
-    CCLinkedList Pages = CCLinkedListEnumerateNext(List->list);
-    for (CCLinkedListNode *Node = Pages; Node; Node = CCLinkedListEnumerateNext(Node))
-    {
-        CCArrayDestroy(*(CCArray*)CCLinkedListGetNodeData(Node));
-    }
-    
-    if (Pages) CCLinkedListDestroy(Pages);
-    
-    CCArrayRemoveAllElements(*(CCArray*)CCLinkedListGetNodeData(List->list));
+    if (!List->pageCount) List->pageCount = CCListGetPageCount(List);
     
-    List->count = 0;
-    List->last = List->list;
+    CCListTruncate(List, 0);
 }
+
 static void *CCListEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableAction Action)
 {
+    CCList List = Enumerator->ref;
+    const size_t PageCount = CCListGetPageCount(List);
+    
     switch (Action)
     {
         case CCEnumerableActionHead:
         {
-            CCLinkedList Head = ((CCList)(Enumerator->ref))->list;
-            Enumerator->state.batch.extra[0] = (uintptr_t)Head;
+            Enumerator->state.batch.extra[0] = 0;
             
-            CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Head);
+            CCArray Array = CCListGetPage(List, 0);
             
             Enumerator->state.batch.ptr = CCArrayGetData(Array);
             Enumerator->state.batch.count = CCArrayGetCount(Array);
@@ -286,14 +328,9 @@ static void *CCListEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableActio
             
         case CCEnumerableActionTail:
         {
-            CCLinkedList Tail = (CCLinkedList)Enumerator->state.batch.extra[1];
-            if (!Tail) Tail = CCLinkedListGetTail((CCLinkedList)Enumerator->state.batch.extra[0]);
-            
-            Enumerator->state.batch.extra[0] = (uintptr_t)Tail;
-            
-            if (!Enumerator->state.batch.extra[1]) Enumerator->state.batch.extra[1] = (uintptr_t)Tail;
+            Enumerator->state.batch.extra[0] = PageCount - 1;
             
-            CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Tail);
+            CCArray Array = CCListGetPage(List, PageCount - 1);
             
             Enumerator->state.batch.ptr = CCArrayGetData(Array);
             Enumerator->state.batch.count = CCArrayGetCount(Array);
@@ -304,10 +341,10 @@ static void *CCListEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableActio
             
         case CCEnumerableActionNext:
         {
-            CCLinkedList Next = CCLinkedListEnumerateNext((CCLinkedList)Enumerator->state.batch.extra[0]);
-            if (Next)
+            const size_t Next = Enumerator->state.batch.extra[0] + 1;
+            if (Next < PageCount)
             {
-                CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Next);
+                CCArray Array = CCListGetPage(List, Next);
                 Enumerator->state.batch.ptr = CCArrayGetData(Array);
                 Enumerator->state.batch.count = CCArrayGetCount(Array);
                 Enumerator->state.batch.index = 0;
@@ -315,23 +352,21 @@ static void *CCListEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableActio
             
             else
             {
-                if (!Enumerator->state.batch.extra[1]) Enumerator->state.batch.extra[1] = Enumerator->state.batch.extra[0];
-                
                 Enumerator->state.batch.ptr = NULL;
                 Enumerator->state.batch.count = 0;
                 Enumerator->state.batch.index = 0;
             }
             
-            Enumerator->state.batch.extra[0] = (uintptr_t)Next;
+            Enumerator->state.batch.extra[0] = Next;
             break;
         }
             
         case CCEnumerableActionPrevious:
         {
-            CCLinkedList Previous = CCLinkedListEnumeratePrevious((CCLinkedList)Enumerator->state.batch.extra[0]);
-            if (Previous)
+            const size_t Previous = Enumerator->state.batch.extra[0] - 1;
+            if (Previous < PageCount)
             {
-                CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Previous);
+                CCArray Array = CCListGetPage(List, Previous);
                 Enumerator->state.batch.ptr = CCArrayGetData(Array);
                 Enumerator->state.batch.count = CCArrayGetCount(Array);
                 Enumerator->state.batch.index = Enumerator->state.batch.count - 1;
@@ -344,7 +379,7 @@ static void *CCListEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableActio
                 Enumerator->state.batch.index = 0;
             }
             
-            Enumerator->state.batch.extra[0] = (uintptr_t)Previous;
+            Enumerator->state.batch.extra[0] = Previous;
             
             return Enumerator->state.batch.count ? (Enumerator->state.batch.ptr + (Enumerator->state.batch.index * Enumerator->state.batch.stride)) : NULL;
         }
@@ -360,7 +395,7 @@ void CCListGetEnumerable(CCList List, CCEnumerable *Enumerable)
 {
     CCAssertLog(List, "List must not be null");
     
-    CCArray Array = *(CCArray*)CCLinkedListGetNodeData(List->list);
+    CCArray Array = CCListGetPage(List, 0);
     
     *Enumerable = (CCEnumerable){
         .handler = CCListEnumerableHandler,
@@ -372,7 +407,7 @@ void CCListGetEnumerable(CCList List, CCEnumerable *Enumerable)
                     .count = CCArrayGetCount(Array),
                     .stride = CCArrayGetElementSize(Array),
                     .index = 0,
-                    .extra = { (uintptr_t)List->list, (uintptr_t)List->last }
+                    .extra = { 0 }
                 },
                 .type = CCEnumeratorFormatBatch
             }
@@ -25,11 +25,15 @@
 
 /*!
  * @header CCList
- * CCList implements a linked list of arrays.
+ * CCList implements a paged array, where the pages are referenced from a contiguous
+ * page directory.
  *
  * The intended use case is when you desire to have spatial locality of elements,
  * but may need the list to grow indefinitely (and wish to avoid more expensive
  * copies as the list gets bigger). It provides an interface comparable to @b CCArray.
+ *
+ * Every page is allocated with enough capacity for a full page, so appending to the
+ * list will never move the existing elements. Indexed access is O(1).
  */
 
 #ifndef CommonC_List_h
@@ -39,13 +43,13 @@
 #include <CommonC/Allocator.h>
 #include <CommonC/Assertion.h>
 #include <CommonC/Array.h>
-#include <CommonC/LinkedList.h>
 
 typedef struct CCListInfo {
     size_t count;
     size_t pageSize;
-    CCLinkedList(CCArray) list;
-    CCLinkedList(CCArray) last;
+    size_t pageCount;
+    size_t pageCapacity;
+    CCArray *pages;
     CCAllocatorType allocator;
 } CCListInfo;
 
@@ -112,13 +116,14 @@ void CCListDestroy(CCList CC_DESTROY(List));
  *        so it is divisible by the @b chunkSize.
  *
  * @param count The number of elements in the data ptr.
- * @param ptr The pointer to the data allocation. Must not be NULL. The allocation is a list of arrays of
- *        pageSize elements, or fewer for the tail array.
+ * @param ptr The pointer to the page directory. Must not be NULL. The directory is a C array of
+ *        @b CCArray pages of pageSize elements, or fewer for the tail page. The directory will be
+ *        copied to a new allocation if more pages are needed.
  */
 #define CC_STATIC_LIST(allocator, pageSize, count, ptr) CC_LIST_CREATE(allocator, pageSize, count, ptr)
 
 /*!
- * @define CC_CONST_ARRAY
+ * @define CC_CONST_LIST
  * @abstract Convenient macro to create a temporary constant (allocation free) @b CCList.
  * @discussion If used globally the list will last for the life of the program, however if used within
  *             a function it will last for the entirety of the local scope.
@@ -128,8 +133,9 @@ void CCListDestroy(CCList CC_DESTROY(List));
  *        so it is divisible by the @b chunkSize.
  *
  * @param count The number of elements in the data ptr.
- * @param ptr The pointer to the data allocation. Must not be NULL. The allocation is a list of arrays of
- *        pageSize elements, or fewer for the tail array.
+ * @param ptr The pointer to the page directory. Must not be NULL. The directory is a C array of
+ *        @b CCArray pages of pageSize elements, or fewer for the tail page. The directory will be
+ *        copied to a new allocation if more pages are needed.
  */
 #define CC_CONST_LIST(allocator, pageSize, count, ptr) CC_LIST_CREATE(allocator, pageSize, count, ptr, const)
 
@@ -141,9 +147,10 @@ void CCListDestroy(CCList CC_DESTROY(List));
     .header = CC_ALLOCATOR_HEADER_INIT(CC_NULL_ALLOCATOR.allocator), \
     .info = { \
         .count = elementCount, \
-        .pageSize = ((pageSize_ % (*(CCArray*)((CCLinkedListNodeData*)ptr)->data)->chunkSize) ? pageSize_ + ((*(CCArray*)((CCLinkedListNodeData*)ptr)->data)->chunkSize - (pageSize_ % (*(CCArray*)((CCLinkedListNodeData*)ptr)->data)->chunkSize)) : pageSize_), \
-        .list = ptr, \
-        .last = NULL, \
+        .pageSize = ((pageSize_ % ((CCArray*)ptr)[0]->chunkSize) ? pageSize_ + (((CCArray*)ptr)[0]->chunkSize - (pageSize_ % ((CCArray*)ptr)[0]->chunkSize)) : pageSize_), \
+        .pageCount = 0, \
+        .pageCapacity = 0, \
+        .pages = (CCArray*)ptr, \
         .allocator = allocator_ \
     } \
 }.info)
@@ -189,8 +196,9 @@ void CCListReplaceElementAtIndex(CCList List, size_t Index, const void *Element)
 /*!
  * @brief Insert an element at a given index into the list.
  * @description Increases the list's count by 1.
- * @performance The further away from the end of the list the index is, the slower it is. It has
- *              a worst case of O(n+p) (where p is the number of pages).
+ * @performance The further away from the end of the list the index is, the slower it is. The page
+ *              containing the index is found in O(1), every following page then has to shift one
+ *              element across.
  *
  * @warning The size of element must be the same size as specified in the list creation. And the
  *          Index must not be out of bounds
@@ -207,8 +215,9 @@ size_t CCListInsertElementAtIndex(CCList List, size_t Index, const void *Element
 /*!
  * @brief Removes an element at a given index from the list.
  * @description Decreases the list's count by 1.
- * @performance The further away from the end of the list the index is, the slower it is. It has
- *              a worst case of O(n+p) (where p is the number of pages).
+ * @performance The further away from the end of the list the index is, the slower it is. The page
+ *              containing the index is found in O(1), every following page then has to shift one
+ *              element across.
  *
  * @warning Index must not be out of bounds
  * @param List The list to remove an element from.
@@ -282,34 +291,12 @@ static inline size_t CCListGetElementSize(CCList List)
 {
     CCAssertLog(List, "List must not be null");
     
-    return CCArrayGetElementSize(*(CCArray*)CCLinkedListGetNodeData(List->list));
+    return CCArrayGetElementSize(List->pages[0]);
 }
 
-static inline CCLinkedListNode *CCListGetPage(CCList List, size_t PageIndex)
+static inline CCArray CCListGetPage(CCList List, size_t PageIndex)
 {
-    const size_t MaxPageIndex = (List->count - 1) / List->pageSize;
-    
-    CCLinkedListNode *Page = List->list;
-    
-    if ((List->last) && (PageIndex > (MaxPageIndex - PageIndex)))
-    {
-        Page = List->last;
-        
-        for (size_t Loop = MaxPageIndex; Loop > PageIndex; Loop--)
-        {
-            Page = CCLinkedListEnumeratePrevious(Page);
-        }
-    }
-    
-    else
-    {
-        for (size_t Loop = 0; Loop < PageIndex; Loop++)
-        {
-            Page = CCLinkedListEnumerateNext(Page);
-        }
-    }
-    
-    return Page;
+    return List->pages[PageIndex];
 }
 
 static inline void *CCListGetElementAtIndex(CCList List, size_t Index)
@@ -320,16 +307,14 @@ static inline void *CCListGetElementAtIndex(CCList List, size_t Index)
     const size_t PageIndex = Index / List->pageSize;
     const size_t ElementIndex = Index - (PageIndex * List->pageSize);
     
-    CCLinkedListNode *Page = CCListGetPage(List, PageIndex);
-    
-    return CCArrayGetElementAtIndex(*(CCArray*)CCLinkedListGetNodeData(Page), ElementIndex);
+    return CCArrayGetElementAtIndex(CCListGetPage(List, PageIndex), ElementIndex);
 }
 
 static inline size_t CCListGetChunkSize(CCList List)
 {
     CCAssertLog(List, "List must not be null");
     
-    return CCArrayGetChunkSize(*(CCArray*)CCLinkedListGetNodeData(List->list));
+    return CCArrayGetChunkSize(List->pages[0]);
 }
 
 static inline size_t CCListGetPageSize(CCList List)
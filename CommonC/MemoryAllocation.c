@@ -74,6 +74,11 @@ void CCFree(void *Ptr)
     if (Ptr) CCMemoryDeallocate(Ptr);
 }
 
+void CCFreeDeferred(void *Ptr)
+{
+    if (Ptr) CCMemoryDeallocateDeferred(Ptr);
+}
+
 void *CCRetain(void *Ptr)
 {
     return Ptr ? CCMemoryRetain(Ptr) : NULL;
@@ -57,6 +57,7 @@ typedef struct {
 CC_NEW void *CCMalloc(CCAllocatorType Type, size_t Size, const char * const Filename, const char * const FunctionName, int Line, void *CallbackData, CCErrorCallback ErrorCallback) CC_WARN_UNUSED_RESULT;
 CC_NEW void *CCRealloc(CCAllocatorType Type, void *CC_DESTROY(Ptr), size_t Size, const char * const Filename, const char * const FunctionName, int Line, void *CallbackData, CCErrorCallback ErrorCallback) CC_WARN_UNUSED_RESULT;
 void CCFree(void *CC_DESTROY(Ptr));
+void CCFreeDeferred(void *CC_DESTROY(Ptr));
 CC_NEW void *CCRetain(void *Ptr);
 int32_t CCRefCount(void *Ptr);
 
@@ -82,6 +83,9 @@ void *: CCRealloc)(type, ptr, size, __FILE__, __func__, __LINE__, data, callback
  
  CCFree:
  Frees the allocated memory if not NULL, otherwise does nothing.
+ 
+ CCFreeDeferred:
+ Same as CCFree but the release is batched with other releases made by the thread (see CCMemoryDeallocateDeferred).
  */
 
 
@@ -26,6 +26,7 @@
 #define CC_QUICK_COMPILE
 #include "Path.h"
 #include "MemoryAllocation.h"
+#include "Scratch.h"
 #include "Logging.h"
 #include "Assertion.h"
 #include "CollectionEnumerator.h"
@@ -90,11 +91,12 @@ static _Bool FSPathFoundComponentTypeFromInputs(char CurrentCharacter, char Firs
 
 static char *FSPathCopyString(const char *String, size_t Length)
 {
-    char *NewString;
-    CC_SAFE_Malloc(NewString, sizeof(char) * (Length + 1),
-                   CC_LOG_ERROR("Failed to copy path string. Allocation size: %zu", sizeof(char) * (Length + 1));
-                   return NULL;
-                   );
+    char *NewString = CCScratchAllocate(sizeof(char) * (Length + 1));
+    if (!NewString)
+    {
+        CC_LOG_ERROR("Failed to copy path string. Allocation size: %zu", sizeof(char) * (Length + 1));
+        return NULL;
+    }
     
     strncpy(NewString, String, Length);
     NewString[Length] = 0;
@@ -104,6 +106,7 @@ static char *FSPathCopyString(const char *String, size_t Length)
 
 static FSPathComponent FSPathCreateComponent(FSPathComponentType Type, const char *String, size_t Length)
 {
+    const CCScratchMark Mark = CCScratchGetMark();
     char *Component = NULL;
     switch (Type)
     {
@@ -128,7 +131,7 @@ static FSPathComponent FSPathCreateComponent(FSPathComponentType Type, const cha
     }
     
     FSPathComponent PathComponent = FSPathComponentCreate(Type, Component);
-    if (Component) CC_SAFE_Free(Component);
+    CCScratchRelease(Mark);
     
     return PathComponent;
 }
@@ -236,6 +236,9 @@
 #define CC_HARDWARE_VECTOR_SUPPORT_SSE4_2 1
 #if __AVX__
 #define CC_HARDWARE_VECTOR_SUPPORT_AVX 1
+#if __AVX2__
+#define CC_HARDWARE_VECTOR_SUPPORT_AVX2 1
+#endif
 #endif
 #endif
 #endif
@@ -0,0 +1,292 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "PriorityQueue.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "Logging.h"
+#include "Array.h"
+#include <string.h>
+
+typedef struct CCPriorityQueueInfo {
+    CCComparator comparator;
+    size_t size, arity;
+    CCArray elements; //heap ordered elements
+    CCArray slots; //handle of each element
+    CCArray handles; //element index of each handle, or the next free handle
+    CCPriorityQueueHandle freeHandle;
+    uint8_t temp[];
+} CCPriorityQueueInfo;
+
+typedef struct {
+    uint8_t *data;
+    CCPriorityQueueHandle *slots;
+    size_t *handles;
+    size_t count;
+} CCPriorityQueueHeap;
+
+
+static void CCPriorityQueueDestructor(CCPriorityQueue Queue)
+{
+    if (Queue->elements) CCArrayDestroy(Queue->elements);
+    if (Queue->slots) CCArrayDestroy(Queue->slots);
+    if (Queue->handles) CCArrayDestroy(Queue->handles);
+}
+
+CCPriorityQueue CCPriorityQueueCreate(CCAllocatorType Allocator, size_t Size, size_t Arity, CCComparator Comparator)
+{
+    CCAssertLog(Size, "Size must not be 0");
+    CCAssertLog(Arity >= 2, "Arity must be at least 2");
+    
+    CCPriorityQueue Queue = CCMalloc(Allocator, sizeof(CCPriorityQueueInfo) + Size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Queue)
+    {
+        *Queue = (CCPriorityQueueInfo){
+            .comparator = Comparator,
+            .size = Size,
+            .arity = Arity,
+            .elements = CCArrayCreate(Allocator, Size, 16),
+            .slots = CCArrayCreate(Allocator, sizeof(CCPriorityQueueHandle), 16),
+            .handles = CCArrayCreate(Allocator, sizeof(size_t), 16),
+            .freeHandle = CC_PRIORITY_QUEUE_HANDLE_INVALID
+        };
+        
+        CCMemorySetDestructor(Queue, (CCMemoryDestructorCallback)CCPriorityQueueDestructor);
+        
+        if ((!Queue->elements) || (!Queue->slots) || (!Queue->handles))
+        {
+            CC_LOG_ERROR("Failed to create priority queue: Failed to create arrays");
+            CCFree(Queue);
+            
+            return NULL;
+        }
+    }
+    
+    else
+    {
+        CC_LOG_ERROR("Failed to create priority queue: Failed to allocate memory of size (%zu)", sizeof(CCPriorityQueueInfo) + Size);
+    }
+    
+    return Queue;
+}
+
+void CCPriorityQueueDestroy(CCPriorityQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    CCFree(Queue);
+}
+
+static inline CCPriorityQueueHeap CCPriorityQueueGetHeap(CCPriorityQueue Queue)
+{
+    return (CCPriorityQueueHeap){
+        .data = CCArrayGetData(Queue->elements),
+        .slots = CCArrayGetData(Queue->slots),
+        .handles = CCArrayGetData(Queue->handles),
+        .count = CCArrayGetCount(Queue->elements)
+    };
+}
+
+static inline _Bool CCPriorityQueueLess(CCPriorityQueue Queue, const void *Left, const void *Right)
+{
+    if (Queue->comparator) return Queue->comparator(Left, Right) == CCComparisonResultAscending;
+    
+    return memcmp(Left, Right, Queue->size) < 0;
+}
+
+static inline void CCPriorityQueueMove(CCPriorityQueue Queue, CCPriorityQueueHeap *Heap, size_t Destination, size_t Source)
+{
+    memcpy(Heap->data + (Destination * Queue->size), Heap->data + (Source * Queue->size), Queue->size);
+    Heap->handles[(Heap->slots[Destination] = Heap->slots[Source])] = Destination;
+}
+
+static void CCPriorityQueueSiftUp(CCPriorityQueue Queue, CCPriorityQueueHeap *Heap, size_t Index)
+{
+    const size_t Size = Queue->size;
+    const CCPriorityQueueHandle Handle = Heap->slots[Index];
+    memcpy(Queue->temp, Heap->data + (Index * Size), Size);
+    
+    while (Index)
+    {
+        const size_t Parent = (Index - 1) / Queue->arity;
+        if (!CCPriorityQueueLess(Queue, Queue->temp, Heap->data + (Parent * Size))) break;
+        
+        CCPriorityQueueMove(Queue, Heap, Index, Parent);
+        Index = Parent;
+    }
+    
+    memcpy(Heap->data + (Index * Size), Queue->temp, Size);
+    Heap->handles[(Heap->slots[Index] = Handle)] = Index;
+}
+
+static void CCPriorityQueueSiftDown(CCPriorityQueue Queue, CCPriorityQueueHeap *Heap, size_t Index)
+{
+    const size_t Size = Queue->size;
+    const CCPriorityQueueHandle Handle = Heap->slots[Index];
+    memcpy(Queue->temp, Heap->data + (Index * Size), Size);
+    
+    for (size_t First; (First = (Index * Queue->arity) + 1) < Heap->count; )
+    {
+        //The children are adjacent, so finding the best child only walks forward through memory
+        const size_t Last = (Heap->count - First) > Queue->arity ? First + Queue->arity : Heap->count;
+        size_t Best = First;
+        for (size_t Child = First + 1; Child < Last; Child++)
+        {
+            if (CCPriorityQueueLess(Queue, Heap->data + (Child * Size), Heap->data + (Best * Size))) Best = Child;
+        }
+        
+        if (!CCPriorityQueueLess(Queue, Heap->data + (Best * Size), Queue->temp)) break;
+        
+        CCPriorityQueueMove(Queue, Heap, Index, Best);
+        Index = Best;
+    }
+    
+    memcpy(Heap->data + (Index * Size), Queue->temp, Size);
+    Heap->handles[(Heap->slots[Index] = Handle)] = Index;
+}
+
+static void CCPriorityQueueRestore(CCPriorityQueue Queue, CCPriorityQueueHeap *Heap, size_t Index)
+{
+    if ((Index) && (CCPriorityQueueLess(Queue, Heap->data + (Index * Queue->size), Heap->data + (((Index - 1) / Queue->arity) * Queue->size)))) CCPriorityQueueSiftUp(Queue, Heap, Index);
+    else CCPriorityQueueSiftDown(Queue, Heap, Index);
+}
+
+CCPriorityQueueHandle CCPriorityQueuePush(CCPriorityQueue Queue, const void *Element)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    CCAssertLog(Element, "Element must not be null");
+    
+    CCPriorityQueueHandle Handle = Queue->freeHandle;
+    if (Handle != CC_PRIORITY_QUEUE_HANDLE_INVALID) Queue->freeHandle = *(size_t*)CCArrayGetElementAtIndex(Queue->handles, Handle);
+    else if ((Handle = CCArrayAppendElement(Queue->handles, &(size_t){ 0 })) == SIZE_MAX) return CC_PRIORITY_QUEUE_HANDLE_INVALID;
+    
+    const size_t Index = CCArrayAppendElement(Queue->elements, Element);
+    if ((Index == SIZE_MAX) || (CCArrayAppendElement(Queue->slots, &Handle) == SIZE_MAX))
+    {
+        if (Index != SIZE_MAX) CCArrayRemoveElementAtIndex(Queue->elements, Index);
+        
+        *(size_t*)CCArrayGetElementAtIndex(Queue->handles, Handle) = Queue->freeHandle;
+        Queue->freeHandle = Handle;
+        
+        return CC_PRIORITY_QUEUE_HANDLE_INVALID;
+    }
+    
+    CCPriorityQueueHeap Heap = CCPriorityQueueGetHeap(Queue);
+    CCPriorityQueueSiftUp(Queue, &Heap, Index);
+    
+    return Handle;
+}
+
+_Bool CCPriorityQueuePop(CCPriorityQueue Queue, void *Element)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    if (!CCArrayGetCount(Queue->elements)) return FALSE;
+    
+    if (Element) memcpy(Element, CCArrayGetData(Queue->elements), Queue->size);
+    
+    CCPriorityQueueRemove(Queue, *(CCPriorityQueueHandle*)CCArrayGetData(Queue->slots));
+    
+    return TRUE;
+}
+
+void CCPriorityQueueUpdate(CCPriorityQueue Queue, CCPriorityQueueHandle Handle, const void *Element)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    CCAssertLog(Element, "Element must not be null");
+    CCAssertLog(CCPriorityQueueContainsHandle(Queue, Handle), "Handle must be in the queue");
+    
+    CCPriorityQueueHeap Heap = CCPriorityQueueGetHeap(Queue);
+    const size_t Index = Heap.handles[Handle];
+    
+    memcpy(Heap.data + (Index * Queue->size), Element, Queue->size);
+    CCPriorityQueueRestore(Queue, &Heap, Index);
+}
+
+void CCPriorityQueueRemove(CCPriorityQueue Queue, CCPriorityQueueHandle Handle)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    CCAssertLog(CCPriorityQueueContainsHandle(Queue, Handle), "Handle must be in the queue");
+    
+    CCPriorityQueueHeap Heap = CCPriorityQueueGetHeap(Queue);
+    const size_t Index = Heap.handles[Handle], Last = --Heap.count;
+    
+    Heap.handles[Handle] = Queue->freeHandle;
+    Queue->freeHandle = Handle;
+    
+    if (Index != Last)
+    {
+        CCPriorityQueueMove(Queue, &Heap, Index, Last);
+        CCPriorityQueueRestore(Queue, &Heap, Index);
+    }
+    
+    CCArrayRemoveElementAtIndex(Queue->elements, Last);
+    CCArrayRemoveElementAtIndex(Queue->slots, Last);
+}
+
+void CCPriorityQueueRemoveAll(CCPriorityQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    CCArrayRemoveAllElements(Queue->elements);
+    CCArrayRemoveAllElements(Queue->slots);
+    CCArrayRemoveAllElements(Queue->handles);
+    Queue->freeHandle = CC_PRIORITY_QUEUE_HANDLE_INVALID;
+}
+
+void *CCPriorityQueuePeek(CCPriorityQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    return CCArrayGetCount(Queue->elements) ? CCArrayGetData(Queue->elements) : NULL;
+}
+
+const void *CCPriorityQueueGetElement(CCPriorityQueue Queue, CCPriorityQueueHandle Handle)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    CCAssertLog(CCPriorityQueueContainsHandle(Queue, Handle), "Handle must be in the queue");
+    
+    return CCArrayGetElementAtIndex(Queue->elements, *(size_t*)CCArrayGetElementAtIndex(Queue->handles, Handle));
+}
+
+_Bool CCPriorityQueueContainsHandle(CCPriorityQueue Queue, CCPriorityQueueHandle Handle)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    if (Handle >= CCArrayGetCount(Queue->handles)) return FALSE;
+    
+    //Free handles store a link to the next free handle, which will never map back to a free handle
+    const size_t Index = *(size_t*)CCArrayGetElementAtIndex(Queue->handles, Handle);
+    
+    return (Index < CCArrayGetCount(Queue->slots)) && (*(CCPriorityQueueHandle*)CCArrayGetElementAtIndex(Queue->slots, Index) == Handle);
+}
+
+size_t CCPriorityQueueGetCount(CCPriorityQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    return CCArrayGetCount(Queue->elements);
+}
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCPriorityQueue
+ * CCPriorityQueue implements a priority queue as an implicit d-ary heap.
+ *
+ * Elements are stored by value in contiguous memory. A larger arity makes the heap shallower
+ * and keeps the children of a node adjacent, so fewer cache lines are touched per level at the
+ * cost of more comparisons per level.
+ *
+ * Every element that is pushed is given a handle, which can be used to update the priority of
+ * the element (e.g. decrease-key) or remove it before it reaches the front of the queue.
+ */
+
+#ifndef CommonC_PriorityQueue_h
+#define CommonC_PriorityQueue_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Container.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Comparator.h>
+
+/*!
+ * @brief A handle referencing an element in the priority queue.
+ * @description Handles are only valid while the element is in the queue, once an element has been
+ *              popped or removed its handle may be reused by a later push.
+ */
+typedef size_t CCPriorityQueueHandle;
+
+/*!
+ * @brief The handle returned when an element could not be pushed.
+ */
+#define CC_PRIORITY_QUEUE_HANDLE_INVALID SIZE_MAX
+
+/*!
+ * @brief The priority queue.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCPriorityQueueInfo *CCPriorityQueue;
+
+CC_CONTAINER_DECLARE_PRESET_1(CCPriorityQueue);
+
+/*!
+ * @define CC_PRIORITY_QUEUE_DECLARE
+ * @abstract Convenient macro to define a @b CCPriorityQueue type that can be referenced by @b CCPriorityQueue.
+ * @param element The element type.
+ */
+#define CC_PRIORITY_QUEUE_DECLARE(element) CC_CONTAINER_DECLARE(CCPriorityQueue, element)
+
+/*!
+ * @define CC_PRIORITY_QUEUE
+ * @abstract Convenient macro to define an explicitly typed @b CCPriorityQueue.
+ * @param element The element type.
+ */
+#define CC_PRIORITY_QUEUE(element) CC_CONTAINER(CCPriorityQueue, element)
+
+/*!
+ * @define CCPriorityQueue
+ * @abstract Convenient macro to define an explicitly typed @b CCPriorityQueue.
+ * @description In the case that this macro is conflicting with the standalone @b CCPriorityQueue type, simply
+ *              undefine it and redefine it back to @b CC_PRIORITY_QUEUE.
+ *
+ * @param element The element type.
+ */
+#define CCPriorityQueue(element) CC_PRIORITY_QUEUE(element)
+
+#pragma mark - Creation / Destruction
+/*!
+ * @brief Create a priority queue.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Size The size of the elements.
+ * @param Arity The number of children each node of the heap has. Must be at least 2, where 4 is
+ *        a good default.
+ *
+ * @param Comparator The comparison used to order the elements, where ascending elements will be
+ *        popped before descending elements. If NULL the elements will be ordered using a memcmp.
+ *
+ * @return A priority queue, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCPriorityQueue CCPriorityQueueCreate(CCAllocatorType Allocator, size_t Size, size_t Arity, CCComparator Comparator);
+
+/*!
+ * @brief Destroy a priority queue.
+ * @param Queue The priority queue to be destroyed.
+ */
+void CCPriorityQueueDestroy(CCPriorityQueue CC_DESTROY(Queue));
+
+#pragma mark - Insertions/Deletions
+/*!
+ * @brief Push an element onto the priority queue.
+ * @performance O(log n)
+ * @param Queue The priority queue to add the element to.
+ * @param Element The pointer to the element to be copied into the queue.
+ * @return The handle of the element, or @b CC_PRIORITY_QUEUE_HANDLE_INVALID on failure.
+ */
+CCPriorityQueueHandle CCPriorityQueuePush(CCPriorityQueue Queue, const void *Element);
+
+/*!
+ * @brief Pop the element at the front of the priority queue.
+ * @performance O(log n)
+ * @param Queue The priority queue to remove the element from.
+ * @param Element The pointer to where the element should be copied to. May be NULL.
+ * @return TRUE if an element was popped, otherwise FALSE if the queue is empty.
+ */
+_Bool CCPriorityQueuePop(CCPriorityQueue Queue, void *Element);
+
+/*!
+ * @brief Replace an element in the priority queue and restore its position.
+ * @description Can be used to either increase or decrease the priority of an element.
+ * @performance O(log n)
+ * @param Queue The priority queue containing the element.
+ * @param Handle The handle of the element. Must be in the queue.
+ * @param Element The pointer to the element to be copied into the queue.
+ */
+void CCPriorityQueueUpdate(CCPriorityQueue Queue, CCPriorityQueueHandle Handle, const void *Element);
+
+/*!
+ * @brief Remove an element from the priority queue.
+ * @performance O(log n)
+ * @param Queue The priority queue containing the element.
+ * @param Handle The handle of the element. Must be in the queue.
+ */
+void CCPriorityQueueRemove(CCPriorityQueue Queue, CCPriorityQueueHandle Handle);
+
+/*!
+ * @brief Remove all elements from the priority queue.
+ * @description Invalidates all handles.
+ * @param Queue The priority queue to remove the elements from.
+ */
+void CCPriorityQueueRemoveAll(CCPriorityQueue Queue);
+
+#pragma mark - Query
+/*!
+ * @brief Get the element at the front of the priority queue without removing it.
+ * @param Queue The priority queue to get the element from.
+ * @return A pointer to the element, or NULL if empty. The pointer is only valid until the queue
+ *         is next modified.
+ */
+void *CCPriorityQueuePeek(CCPriorityQueue Queue);
+
+/*!
+ * @brief Get the element referenced by a handle.
+ * @param Queue The priority queue containing the element.
+ * @param Handle The handle of the element. Must be in the queue.
+ * @return A pointer to the element. This must not be modified (use @b CCPriorityQueueUpdate), and
+ *         is only valid until the queue is next modified.
+ */
+const void *CCPriorityQueueGetElement(CCPriorityQueue Queue, CCPriorityQueueHandle Handle);
+
+/*!
+ * @brief Check whether a handle references an element in the priority queue.
+ * @description As handles are reused, this cannot distinguish an element from a later element that
+ *              was given the same handle.
+ *
+ * @param Queue The priority queue to check.
+ * @param Handle The handle to check.
+ * @return TRUE if an element in the queue has the handle, otherwise FALSE.
+ */
+_Bool CCPriorityQueueContainsHandle(CCPriorityQueue Queue, CCPriorityQueueHandle Handle);
+
+/*!
+ * @brief Get the current number of elements in the priority queue.
+ * @param Queue The priority queue to get the count of.
+ * @return The number of elements.
+ */
+size_t CCPriorityQueueGetCount(CCPriorityQueue Queue);
+
+#endif
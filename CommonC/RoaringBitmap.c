@@ -0,0 +1,589 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "RoaringBitmap.h"
+#include "BitArray.h"
+#include "MemoryAllocation.h"
+
+
+#ifndef CC_ROARING_BITMAP_ARRAY_MAX
+#define CC_ROARING_BITMAP_ARRAY_MAX 4096
+#endif
+
+typedef struct {
+    uint16_t key;
+    size_t count;
+    CCArray values;
+    CCBitArray bits;
+} CCRoaringBitmapContainer;
+
+
+static CCComparisonResult CCRoaringBitmapContainerComparator(const CCRoaringBitmapContainer *Left, const CCRoaringBitmapContainer *Right)
+{
+    return Left->key < Right->key ? CCComparisonResultAscending : (Left->key > Right->key ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+static CCComparisonResult CCRoaringBitmapValueComparator(const uint16_t *Left, const uint16_t *Right)
+{
+    return *Left < *Right ? CCComparisonResultAscending : (*Left > *Right ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+static size_t CCRoaringBitmapFindContainer(CCRoaringBitmap Bitmap, uint16_t Key, size_t *InsertionIndex)
+{
+    return CCArrayBinarySearch(Bitmap->containers, &(CCRoaringBitmapContainer){ .key = Key }, (CCComparator)CCRoaringBitmapContainerComparator, InsertionIndex);
+}
+
+static void CCRoaringBitmapContainerDestroy(CCRoaringBitmapContainer *Container)
+{
+    if (Container->values) CCArrayDestroy(Container->values);
+    if (Container->bits) CCBitArrayDestroy(Container->bits);
+}
+
+static _Bool CCRoaringBitmapContainerConvertToBits(CCAllocatorType Allocator, CCRoaringBitmapContainer *Container)
+{
+    CCBitArray Bits = CCBitArrayCreate(Allocator, 65536);
+    if (!Bits) return FALSE;
+    
+    const uint16_t *Values = CCArrayGetData(Container->values);
+    for (size_t Loop = 0, Count = CCArrayGetCount(Container->values); Loop < Count; Loop++) CCBitArraySetBit(Bits, Values[Loop]);
+    
+    CCArrayDestroy(Container->values);
+    Container->values = NULL;
+    Container->bits = Bits;
+    
+    return TRUE;
+}
+
+static _Bool CCRoaringBitmapContainerConvertToValues(CCAllocatorType Allocator, CCRoaringBitmapContainer *Container)
+{
+    CCArray Values = CCArrayCreate(Allocator, sizeof(uint16_t), 16);
+    if ((!Values) || (!CCArrayReserve(Values, Container->count)))
+    {
+        if (Values) CCArrayDestroy(Values);
+        
+        return FALSE;
+    }
+    
+    for (size_t Index = CCBitArrayFindNextSet(Container->bits, 0); Index != SIZE_MAX; Index = CCBitArrayFindNextSet(Container->bits, Index + 1))
+    {
+        CCArrayAppendElement(Values, &(uint16_t){ (uint16_t)Index });
+    }
+    
+    CCBitArrayDestroy(Container->bits);
+    Container->bits = NULL;
+    Container->values = Values;
+    
+    return TRUE;
+}
+
+static void CCRoaringBitmapContainerOptimize(CCAllocatorType Allocator, CCRoaringBitmapContainer *Container)
+{
+    //If the conversion fails the current representation is still valid, so it is kept
+    if (Container->bits)
+    {
+        Container->count = CCBitArrayCountSet(Container->bits);
+        if ((Container->count) && (Container->count <= CC_ROARING_BITMAP_ARRAY_MAX)) CCRoaringBitmapContainerConvertToValues(Allocator, Container);
+    }
+    
+    else
+    {
+        Container->count = CCArrayGetCount(Container->values);
+        if (Container->count > CC_ROARING_BITMAP_ARRAY_MAX) CCRoaringBitmapContainerConvertToBits(Allocator, Container);
+    }
+}
+
+static _Bool CCRoaringBitmapContainerCopy(CCAllocatorType Allocator, const CCRoaringBitmapContainer *Container, CCRoaringBitmapContainer *Copy)
+{
+    *Copy = (CCRoaringBitmapContainer){ .key = Container->key, .count = Container->count };
+    
+    if (Container->bits) return (Copy->bits = CCBitArrayCopy(Allocator, Container->bits));
+    
+    if (!(Copy->values = CCArrayCreate(Allocator, sizeof(uint16_t), 16))) return FALSE;
+    
+    if (!CCArrayGetCount(Container->values)) return TRUE;
+    
+    if (CCArrayAppendElements(Copy->values, CCArrayGetData(Container->values), CCArrayGetCount(Container->values)) == SIZE_MAX)
+    {
+        CCArrayDestroy(Copy->values);
+        return FALSE;
+    }
+    
+    return TRUE;
+}
+
+static void CCRoaringBitmapTruncateValues(CCArray Values, size_t Count)
+{
+    if (CCArrayGetCount(Values) > Count) CCArrayRemoveElementsAtIndex(Values, Count, CCArrayGetCount(Values) - Count);
+}
+
+static void CCRoaringBitmapDestructor(CCRoaringBitmap Ptr)
+{
+    CCRoaringBitmapRemoveAll(Ptr);
+    CCArrayDestroy(Ptr->containers);
+}
+
+CCRoaringBitmap CCRoaringBitmapCreate(CCAllocatorType Allocator)
+{
+    CCRoaringBitmap Bitmap = CCMalloc(Allocator, sizeof(CCRoaringBitmapInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Bitmap)
+    {
+        *Bitmap = (CCRoaringBitmapInfo){
+            .allocator = Allocator,
+            .containers = CCArrayCreate(Allocator, sizeof(CCRoaringBitmapContainer), 4)
+        };
+        
+        if (!Bitmap->containers)
+        {
+            CC_LOG_ERROR("Failed to create roaring bitmap: Failed to create containers");
+            CCFree(Bitmap);
+            
+            return NULL;
+        }
+        
+        CCMemorySetDestructor(Bitmap, (CCMemoryDestructorCallback)CCRoaringBitmapDestructor);
+    }
+    
+    else
+    {
+        CC_LOG_ERROR("Failed to create roaring bitmap: Failed to allocate memory of size (%zu)", sizeof(CCRoaringBitmapInfo));
+    }
+    
+    return Bitmap;
+}
+
+void CCRoaringBitmapDestroy(CCRoaringBitmap Bitmap)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    CCFree(Bitmap);
+}
+
+_Bool CCRoaringBitmapAdd(CCRoaringBitmap Bitmap, uint32_t Value)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    const uint16_t Key = Value >> 16, Low = Value & 0xffff;
+    
+    size_t InsertionIndex;
+    const size_t Index = CCRoaringBitmapFindContainer(Bitmap, Key, &InsertionIndex);
+    if (Index == SIZE_MAX)
+    {
+        CCRoaringBitmapContainer Container = { .key = Key, .count = 1, .values = CCArrayCreate(Bitmap->allocator, sizeof(uint16_t), 16) };
+        if ((!Container.values) || (CCArrayAppendElement(Container.values, &Low) == SIZE_MAX))
+        {
+            if (Container.values) CCArrayDestroy(Container.values);
+            
+            CC_LOG_ERROR("Failed to add value (%u) to roaring bitmap (%p), could not create container", Value, Bitmap);
+            return FALSE;
+        }
+        
+        if ((InsertionIndex == CCArrayGetCount(Bitmap->containers) ? CCArrayAppendElement(Bitmap->containers, &Container) : CCArrayInsertElementAtIndex(Bitmap->containers, InsertionIndex, &Container)) == SIZE_MAX)
+        {
+            CCArrayDestroy(Container.values);
+            return FALSE;
+        }
+        
+        return TRUE;
+    }
+    
+    CCRoaringBitmapContainer *Container = CCArrayGetElementAtIndex(Bitmap->containers, Index);
+    if (Container->bits)
+    {
+        if (!CCBitArrayGetBit(Container->bits, Low))
+        {
+            CCBitArraySetBit(Container->bits, Low);
+            Container->count++;
+        }
+        
+        return TRUE;
+    }
+    
+    size_t ValueIndex;
+    if (CCArrayBinarySearch(Container->values, &Low, (CCComparator)CCRoaringBitmapValueComparator, &ValueIndex) != SIZE_MAX) return TRUE;
+    
+    if ((ValueIndex == Container->count ? CCArrayAppendElement(Container->values, &Low) : CCArrayInsertElementAtIndex(Container->values, ValueIndex, &Low)) == SIZE_MAX) return FALSE;
+    
+    if (++Container->count > CC_ROARING_BITMAP_ARRAY_MAX) CCRoaringBitmapContainerConvertToBits(Bitmap->allocator, Container);
+    
+    return TRUE;
+}
+
+void CCRoaringBitmapRemove(CCRoaringBitmap Bitmap, uint32_t Value)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    const uint16_t Key = Value >> 16, Low = Value & 0xffff;
+    
+    const size_t Index = CCRoaringBitmapFindContainer(Bitmap, Key, NULL);
+    if (Index == SIZE_MAX) return;
+    
+    CCRoaringBitmapContainer *Container = CCArrayGetElementAtIndex(Bitmap->containers, Index);
+    if (Container->bits)
+    {
+        if (!CCBitArrayGetBit(Container->bits, Low)) return;
+        
+        CCBitArrayClearBit(Container->bits, Low);
+        if (--Container->count == CC_ROARING_BITMAP_ARRAY_MAX) CCRoaringBitmapContainerConvertToValues(Bitmap->allocator, Container);
+    }
+    
+    else
+    {
+        const size_t ValueIndex = CCArrayBinarySearch(Container->values, &Low, (CCComparator)CCRoaringBitmapValueComparator, NULL);
+        if (ValueIndex == SIZE_MAX) return;
+        
+        CCArrayRemoveElementAtIndex(Container->values, ValueIndex);
+        Container->count--;
+    }
+    
+    if (!Container->count)
+    {
+        CCRoaringBitmapContainerDestroy(Container);
+        CCArrayRemoveElementAtIndex(Bitmap->containers, Index);
+    }
+}
+
+void CCRoaringBitmapRemoveAll(CCRoaringBitmap Bitmap)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    for (size_t Loop = 0, Count = CCArrayGetCount(Bitmap->containers); Loop < Count; Loop++) CCRoaringBitmapContainerDestroy(CCArrayGetElementAtIndex(Bitmap->containers, Loop));
+    
+    CCArrayRemoveAllElements(Bitmap->containers);
+}
+
+static void CCRoaringBitmapContainerIntersect(CCRoaringBitmapContainer *Container, const CCRoaringBitmapContainer *Source)
+{
+    if (Container->bits)
+    {
+        if (Source->bits) CCBitArrayAnd(Container->bits, Source->bits);
+        else
+        {
+            //Clear the bits not in the source, walking both in order
+            const uint16_t *SourceValues = CCArrayGetData(Source->values);
+            size_t SourceIndex = 0;
+            const size_t SourceCount = CCArrayGetCount(Source->values);
+            
+            for (size_t Index = CCBitArrayFindNextSet(Container->bits, 0); Index != SIZE_MAX; Index = CCBitArrayFindNextSet(Container->bits, Index + 1))
+            {
+                while ((SourceIndex < SourceCount) && (SourceValues[SourceIndex] < Index)) SourceIndex++;
+                
+                if ((SourceIndex == SourceCount) || (SourceValues[SourceIndex] != Index)) CCBitArrayClearBit(Container->bits, Index);
+            }
+        }
+    }
+    
+    else
+    {
+        uint16_t *Values = CCArrayGetData(Container->values);
+        const size_t Count = CCArrayGetCount(Container->values);
+        size_t Kept = 0;
+        
+        if (Source->bits)
+        {
+            for (size_t Loop = 0; Loop < Count; Loop++)
+            {
+                if (CCBitArrayGetBit(Source->bits, Values[Loop])) Values[Kept++] = Values[Loop];
+            }
+        }
+        
+        else
+        {
+            const uint16_t *SourceValues = CCArrayGetData(Source->values);
+            const size_t SourceCount = CCArrayGetCount(Source->values);
+            
+            for (size_t Loop = 0, SourceIndex = 0; (Loop < Count) && (SourceIndex < SourceCount); )
+            {
+                if (Values[Loop] < SourceValues[SourceIndex]) Loop++;
+                else if (Values[Loop] > SourceValues[SourceIndex]) SourceIndex++;
+                else
+                {
+                    Values[Kept++] = Values[Loop++];
+                    SourceIndex++;
+                }
+            }
+        }
+        
+        CCRoaringBitmapTruncateValues(Container->values, Kept);
+    }
+}
+
+static void CCRoaringBitmapContainerDifference(CCRoaringBitmapContainer *Container, const CCRoaringBitmapContainer *Source)
+{
+    if (Container->bits)
+    {
+        if (Source->bits) CCBitArrayAndNot(Container->bits, Source->bits);
+        else
+        {
+            const uint16_t *SourceValues = CCArrayGetData(Source->values);
+            for (size_t Loop = 0, Count = CCArrayGetCount(Source->values); Loop < Count; Loop++) CCBitArrayClearBit(Container->bits, SourceValues[Loop]);
+        }
+    }
+    
+    else
+    {
+        uint16_t *Values = CCArrayGetData(Container->values);
+        const size_t Count = CCArrayGetCount(Container->values);
+        size_t Kept = 0;
+        
+        if (Source->bits)
+        {
+            for (size_t Loop = 0; Loop < Count; Loop++)
+            {
+                if (!CCBitArrayGetBit(Source->bits, Values[Loop])) Values[Kept++] = Values[Loop];
+            }
+        }
+        
+        else
+        {
+            const uint16_t *SourceValues = CCArrayGetData(Source->values);
+            const size_t SourceCount = CCArrayGetCount(Source->values);
+            
+            for (size_t Loop = 0, SourceIndex = 0; Loop < Count; )
+            {
+                if ((SourceIndex == SourceCount) || (Values[Loop] < SourceValues[SourceIndex])) Values[Kept++] = Values[Loop++];
+                else if (Values[Loop] > SourceValues[SourceIndex]) SourceIndex++;
+                else Loop++;
+            }
+        }
+        
+        CCRoaringBitmapTruncateValues(Container->values, Kept);
+    }
+}
+
+static void CCRoaringBitmapRemoveEmptyContainers(CCRoaringBitmap Bitmap)
+{
+    CCRoaringBitmapContainer *Containers = CCArrayGetData(Bitmap->containers);
+    size_t Kept = 0;
+    
+    for (size_t Loop = 0, Count = CCArrayGetCount(Bitmap->containers); Loop < Count; Loop++)
+    {
+        if (Containers[Loop].count) Containers[Kept++] = Containers[Loop];
+        else CCRoaringBitmapContainerDestroy(&Containers[Loop]);
+    }
+    
+    if (CCArrayGetCount(Bitmap->containers) > Kept) CCArrayRemoveElementsAtIndex(Bitmap->containers, Kept, CCArrayGetCount(Bitmap->containers) - Kept);
+}
+
+void CCRoaringBitmapIntersect(CCRoaringBitmap Bitmap, CCRoaringBitmap Source)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(Source, "Source must not be null");
+    
+    CCRoaringBitmapContainer *Containers = CCArrayGetData(Bitmap->containers);
+    const CCRoaringBitmapContainer *SourceContainers = CCArrayGetData(Source->containers);
+    const size_t SourceCount = CCArrayGetCount(Source->containers);
+    
+    for (size_t Loop = 0, SourceIndex = 0, Count = CCArrayGetCount(Bitmap->containers); Loop < Count; Loop++)
+    {
+        while ((SourceIndex < SourceCount) && (SourceContainers[SourceIndex].key < Containers[Loop].key)) SourceIndex++;
+        
+        if ((SourceIndex < SourceCount) && (SourceContainers[SourceIndex].key == Containers[Loop].key))
+        {
+            CCRoaringBitmapContainerIntersect(&Containers[Loop], &SourceContainers[SourceIndex]);
+            CCRoaringBitmapContainerOptimize(Bitmap->allocator, &Containers[Loop]);
+        }
+        
+        else Containers[Loop].count = 0;
+    }
+    
+    CCRoaringBitmapRemoveEmptyContainers(Bitmap);
+}
+
+_Bool CCRoaringBitmapUnion(CCRoaringBitmap Bitmap, CCRoaringBitmap Source)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(Source, "Source must not be null");
+    
+    for (size_t Loop = 0, Count = CCArrayGetCount(Source->containers); Loop < Count; Loop++)
+    {
+        const CCRoaringBitmapContainer *SourceContainer = CCArrayGetElementAtIndex(Source->containers, Loop);
+        
+        size_t InsertionIndex;
+        const size_t Index = CCRoaringBitmapFindContainer(Bitmap, SourceContainer->key, &InsertionIndex);
+        if (Index == SIZE_MAX)
+        {
+            CCRoaringBitmapContainer Container;
+            if (!CCRoaringBitmapContainerCopy(Bitmap->allocator, SourceContainer, &Container))
+            {
+                CC_LOG_ERROR("Failed to union roaring bitmap (%p), could not copy container", Bitmap);
+                return FALSE;
+            }
+            
+            if ((InsertionIndex == CCArrayGetCount(Bitmap->containers) ? CCArrayAppendElement(Bitmap->containers, &Container) : CCArrayInsertElementAtIndex(Bitmap->containers, InsertionIndex, &Container)) == SIZE_MAX)
+            {
+                CCRoaringBitmapContainerDestroy(&Container);
+                return FALSE;
+            }
+            
+            continue;
+        }
+        
+        CCRoaringBitmapContainer *Container = CCArrayGetElementAtIndex(Bitmap->containers, Index);
+        if ((!Container->bits) && ((SourceContainer->bits) || ((Container->count + SourceContainer->count) > CC_ROARING_BITMAP_ARRAY_MAX)))
+        {
+            //The union may no longer fit in an array, so merge into the bits instead
+            if (!CCRoaringBitmapContainerConvertToBits(Bitmap->allocator, Container))
+            {
+                CC_LOG_ERROR("Failed to union roaring bitmap (%p), could not convert container", Bitmap);
+                return FALSE;
+            }
+        }
+        
+        if (Container->bits)
+        {
+            if (SourceContainer->bits) CCBitArrayOr(Container->bits, SourceContainer->bits);
+            else
+            {
+                const uint16_t *SourceValues = CCArrayGetData(SourceContainer->values);
+                for (size_t Loop = 0, Count = CCArrayGetCount(SourceContainer->values); Loop < Count; Loop++) CCBitArraySetBit(Container->bits, SourceValues[Loop]);
+            }
+        }
+        
+        else
+        {
+            CCArray Values = CCArrayCreate(Bitmap->allocator, sizeof(uint16_t), 16);
+            if ((!Values) || (!CCArrayReserve(Values, Container->count + SourceContainer->count)))
+            {
+                if (Values) CCArrayDestroy(Values);
+                
+                CC_LOG_ERROR("Failed to union roaring bitmap (%p), could not merge container", Bitmap);
+                return FALSE;
+            }
+            
+            const uint16_t *Left = CCArrayGetData(Container->values), *Right = CCArrayGetData(SourceContainer->values);
+            const size_t LeftCount = CCArrayGetCount(Container->values), RightCount = CCArrayGetCount(SourceContainer->values);
+            for (size_t LeftIndex = 0, RightIndex = 0; (LeftIndex < LeftCount) || (RightIndex < RightCount); )
+            {
+                uint16_t Value;
+                if ((RightIndex == RightCount) || ((LeftIndex < LeftCount) && (Left[LeftIndex] < Right[RightIndex]))) Value = Left[LeftIndex++];
+                else if ((LeftIndex == LeftCount) || (Right[RightIndex] < Left[LeftIndex])) Value = Right[RightIndex++];
+                else
+                {
+                    Value = Left[LeftIndex++];
+                    RightIndex++;
+                }
+                
+                CCArrayAppendElement(Values, &Value);
+            }
+            
+            CCArrayDestroy(Container->values);
+            Container->values = Values;
+        }
+        
+        CCRoaringBitmapContainerOptimize(Bitmap->allocator, Container);
+    }
+    
+    return TRUE;
+}
+
+void CCRoaringBitmapDifference(CCRoaringBitmap Bitmap, CCRoaringBitmap Source)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(Source, "Source must not be null");
+    
+    CCRoaringBitmapContainer *Containers = CCArrayGetData(Bitmap->containers);
+    const CCRoaringBitmapContainer *SourceContainers = CCArrayGetData(Source->containers);
+    const size_t SourceCount = CCArrayGetCount(Source->containers);
+    
+    for (size_t Loop = 0, SourceIndex = 0, Count = CCArrayGetCount(Bitmap->containers); Loop < Count; Loop++)
+    {
+        while ((SourceIndex < SourceCount) && (SourceContainers[SourceIndex].key < Containers[Loop].key)) SourceIndex++;
+        
+        if ((SourceIndex < SourceCount) && (SourceContainers[SourceIndex].key == Containers[Loop].key))
+        {
+            CCRoaringBitmapContainerDifference(&Containers[Loop], &SourceContainers[SourceIndex]);
+            CCRoaringBitmapContainerOptimize(Bitmap->allocator, &Containers[Loop]);
+        }
+    }
+    
+    CCRoaringBitmapRemoveEmptyContainers(Bitmap);
+}
+
+_Bool CCRoaringBitmapContains(CCRoaringBitmap Bitmap, uint32_t Value)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    const uint16_t Key = Value >> 16, Low = Value & 0xffff;
+    
+    const size_t Index = CCRoaringBitmapFindContainer(Bitmap, Key, NULL);
+    if (Index == SIZE_MAX) return FALSE;
+    
+    const CCRoaringBitmapContainer *Container = CCArrayGetElementAtIndex(Bitmap->containers, Index);
+    if (Container->bits) return CCBitArrayGetBit(Container->bits, Low);
+    
+    return CCArrayBinarySearch(Container->values, &Low, (CCComparator)CCRoaringBitmapValueComparator, NULL) != SIZE_MAX;
+}
+
+size_t CCRoaringBitmapGetCount(CCRoaringBitmap Bitmap)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    size_t Count = 0;
+    for (size_t Loop = 0, ContainerCount = CCArrayGetCount(Bitmap->containers); Loop < ContainerCount; Loop++) Count += ((CCRoaringBitmapContainer*)CCArrayGetElementAtIndex(Bitmap->containers, Loop))->count;
+    
+    return Count;
+}
+
+_Bool CCRoaringBitmapFindNext(CCRoaringBitmap Bitmap, uint32_t Value, uint32_t *Next)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(Next, "Next must not be null");
+    
+    const uint16_t Key = Value >> 16;
+    uint16_t Low = Value & 0xffff;
+    
+    size_t Index;
+    CCRoaringBitmapFindContainer(Bitmap, Key, &Index);
+    
+    for (size_t Count = CCArrayGetCount(Bitmap->containers); Index < Count; Index++)
+    {
+        const CCRoaringBitmapContainer *Container = CCArrayGetElementAtIndex(Bitmap->containers, Index);
+        if (Container->key != Key) Low = 0;
+        
+        if (Container->bits)
+        {
+            const size_t Found = CCBitArrayFindNextSet(Container->bits, Low);
+            if (Found != SIZE_MAX)
+            {
+                *Next = ((uint32_t)Container->key << 16) | (uint32_t)Found;
+                return TRUE;
+            }
+        }
+        
+        else
+        {
+            size_t Found;
+            CCArrayBinarySearch(Container->values, &Low, (CCComparator)CCRoaringBitmapValueComparator, &Found);
+            if (Found < Container->count)
+            {
+                *Next = ((uint32_t)Container->key << 16) | *(uint16_t*)CCArrayGetElementAtIndex(Container->values, Found);
+                return TRUE;
+            }
+        }
+    }
+    
+    return FALSE;
+}
@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCRoaringBitmap
+ * CCRoaringBitmap is a compressed set of 32-bit values, suited to sparse or clustered sets such as the
+ * IDs assigned by a @b CCConcurrentIDGenerator.
+ *
+ * Values are partitioned by their upper 16 bits into containers. A container with few values stores them
+ * as a sorted array of their lower 16 bits, while a container with many values stores them in a
+ * @b CCBitArray. Containers are converted between the two representations as their count crosses
+ * @b CC_ROARING_BITMAP_ARRAY_MAX.
+ */
+
+#ifndef CommonC_RoaringBitmap_h
+#define CommonC_RoaringBitmap_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Array.h>
+
+typedef struct CCRoaringBitmapInfo {
+    CCAllocatorType allocator;
+    CCArray containers;
+} CCRoaringBitmapInfo;
+
+/*!
+ * @brief The roaring bitmap.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCRoaringBitmapInfo *CCRoaringBitmap;
+
+
+#pragma mark - Creation/Destruction
+/*!
+ * @brief Create an empty roaring bitmap.
+ * @param Allocator The allocator to be used for the allocation.
+ * @return A roaring bitmap, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCRoaringBitmap CCRoaringBitmapCreate(CCAllocatorType Allocator);
+
+/*!
+ * @brief Destroy a roaring bitmap.
+ * @param Bitmap The roaring bitmap to be destroyed.
+ */
+void CCRoaringBitmapDestroy(CCRoaringBitmap CC_DESTROY(Bitmap));
+
+
+#pragma mark - Insertions/Deletions
+/*!
+ * @brief Add a value to the bitmap.
+ * @param Bitmap The roaring bitmap to add the value to.
+ * @param Value The value to be added.
+ * @return TRUE if the value is in the bitmap, otherwise FALSE if it could not be allocated.
+ */
+_Bool CCRoaringBitmapAdd(CCRoaringBitmap Bitmap, uint32_t Value);
+
+/*!
+ * @brief Remove a value from the bitmap.
+ * @param Bitmap The roaring bitmap to remove the value from.
+ * @param Value The value to be removed.
+ */
+void CCRoaringBitmapRemove(CCRoaringBitmap Bitmap, uint32_t Value);
+
+/*!
+ * @brief Remove all values from the bitmap.
+ * @param Bitmap The roaring bitmap to remove the values from.
+ */
+void CCRoaringBitmapRemoveAll(CCRoaringBitmap Bitmap);
+
+
+#pragma mark - Set Operations
+/*!
+ * @brief Intersect the values of one bitmap with another.
+ * @param Bitmap The roaring bitmap to store the result in.
+ * @param Source The roaring bitmap to intersect with.
+ */
+void CCRoaringBitmapIntersect(CCRoaringBitmap Bitmap, CCRoaringBitmap Source);
+
+/*!
+ * @brief Union the values of one bitmap with another.
+ * @param Bitmap The roaring bitmap to store the result in.
+ * @param Source The roaring bitmap to union with.
+ * @return TRUE if the union was completed, otherwise FALSE if it could not be allocated.
+ */
+_Bool CCRoaringBitmapUnion(CCRoaringBitmap Bitmap, CCRoaringBitmap Source);
+
+/*!
+ * @brief Remove the values of one bitmap that are in another.
+ * @param Bitmap The roaring bitmap to store the result in.
+ * @param Source The roaring bitmap of values to be removed.
+ */
+void CCRoaringBitmapDifference(CCRoaringBitmap Bitmap, CCRoaringBitmap Source);
+
+
+#pragma mark - Query Info
+/*!
+ * @brief Check whether a value is in the bitmap.
+ * @param Bitmap The roaring bitmap to check.
+ * @param Value The value to check for.
+ * @return TRUE if the value is in the bitmap, otherwise FALSE.
+ */
+_Bool CCRoaringBitmapContains(CCRoaringBitmap Bitmap, uint32_t Value);
+
+/*!
+ * @brief Get the number of values in the bitmap.
+ * @param Bitmap The roaring bitmap to get the count of.
+ * @return The number of values.
+ */
+size_t CCRoaringBitmapGetCount(CCRoaringBitmap Bitmap);
+
+/*!
+ * @brief Find the next value in the bitmap.
+ * @description Can be used to iterate over the values in ascending order.
+ * @param Bitmap The roaring bitmap to search.
+ * @param Value The value to start searching from (including).
+ * @param Next The pointer to where the found value should be stored.
+ * @return TRUE if a value was found, otherwise FALSE if there are no more values.
+ */
+_Bool CCRoaringBitmapFindNext(CCRoaringBitmap Bitmap, uint32_t Value, uint32_t *Next);
+
+#endif
@@ -0,0 +1,343 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "SamplingAllocator.h"
+#include "Assertion.h"
+#include "Platform.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#if defined(__has_include)
+
+#if __has_include(<execinfo.h>)
+#define CC_SAMPLING_ALLOCATOR_USING_EXECINFO 1
+#include <execinfo.h>
+#endif
+
+#elif CC_PLATFORM_OS_X || CC_PLATFORM_IOS
+#define CC_SAMPLING_ALLOCATOR_USING_EXECINFO 1
+#include <execinfo.h>
+#endif
+
+#ifndef CC_SAMPLING_ALLOCATOR_MAX_DEPTH
+#define CC_SAMPLING_ALLOCATOR_MAX_DEPTH 32 //The number of frames that will be recorded for a call site.
+#endif
+
+#ifndef CC_SAMPLING_ALLOCATOR_MAX_SITES
+#define CC_SAMPLING_ALLOCATOR_MAX_SITES 4096 //If more is needed just recompile. Once exceeded new call sites are merged into a single unknown site.
+#endif
+_Static_assert((CC_SAMPLING_ALLOCATOR_MAX_SITES & (CC_SAMPLING_ALLOCATOR_MAX_SITES - 1)) == 0, "Max sites must be a power of 2.");
+
+#define CC_SAMPLING_ALLOCATOR_SKIP_FRAMES 3 //CCSamplingAllocatorSample, the allocator, CCMemoryAllocate
+
+typedef struct {
+    _Atomic(uintmax_t) hash;
+    size_t depth;
+    void *frames[CC_SAMPLING_ALLOCATOR_MAX_DEPTH];
+    _Atomic(size_t) allocatedCount, allocatedSize;
+    _Atomic(size_t) inUseCount, inUseSize;
+} CCSamplingAllocatorSite;
+
+static CCSamplingAllocatorSite Sites[CC_SAMPLING_ALLOCATOR_MAX_SITES], UnknownSite = { .hash = ATOMIC_VAR_INIT(1), .depth = 0 };
+static atomic_flag SitesLock = ATOMIC_FLAG_INIT;
+
+static _Atomic(size_t) SamplingRate = ATOMIC_VAR_INIT(512 * 1024);
+static _Atomic(uint32_t) SamplingGeneration = ATOMIC_VAR_INIT(0);
+
+static _Thread_local struct {
+    uint64_t seed;
+    size_t remaining;
+    uint32_t generation;
+    _Bool init;
+} ThreadState;
+
+void CCSamplingAllocatorSetRate(size_t Rate)
+{
+    atomic_store_explicit(&SamplingRate, Rate, memory_order_relaxed);
+    atomic_fetch_add_explicit(&SamplingGeneration, 1, memory_order_release);
+}
+
+size_t CCSamplingAllocatorGetRate(void)
+{
+    return atomic_load_explicit(&SamplingRate, memory_order_relaxed);
+}
+
+static size_t CCSamplingAllocatorNextInterval(size_t Rate)
+{
+    //xorshift64*
+    ThreadState.seed ^= ThreadState.seed >> 12;
+    ThreadState.seed ^= ThreadState.seed << 25;
+    ThreadState.seed ^= ThreadState.seed >> 27;
+    
+    //Exponentially distributed interval so sampling is a poisson process: -ln(U) * Rate
+    const double U = ((double)((ThreadState.seed * 0x2545f4914f6cdd1dULL) >> 11) + 1.0) / 9007199254740993.0;
+    
+    return (size_t)(-log(U) * (double)Rate) + 1;
+}
+
+static CCSamplingAllocatorSite *CCSamplingAllocatorGetSite(void **Frames, size_t Depth)
+{
+    uintmax_t Hash = 14695981039346656037ULL;
+    for (size_t Loop = 0; Loop < Depth; Loop++)
+    {
+        Hash ^= (uintptr_t)Frames[Loop];
+        Hash *= 1099511628211ULL;
+    }
+    
+    if (Hash <= 1) Hash += 2; //0 is reserved for empty sites, 1 is reserved for the unknown site
+    
+    CCSamplingAllocatorSite *Site = &UnknownSite;
+    
+    while (atomic_flag_test_and_set_explicit(&SitesLock, memory_order_acquire));
+    
+    for (size_t Loop = 0, Index = Hash & (CC_SAMPLING_ALLOCATOR_MAX_SITES - 1); Loop < CC_SAMPLING_ALLOCATOR_MAX_SITES; Loop++, Index = (Index + 1) & (CC_SAMPLING_ALLOCATOR_MAX_SITES - 1))
+    {
+        const uintmax_t SiteHash = atomic_load_explicit(&Sites[Index].hash, memory_order_relaxed);
+        if (!SiteHash)
+        {
+            Sites[Index].depth = Depth;
+            memcpy(Sites[Index].frames, Frames, sizeof(void*) * Depth);
+            atomic_store_explicit(&Sites[Index].hash, Hash, memory_order_release);
+            
+            Site = &Sites[Index];
+            break;
+        }
+        
+        else if ((SiteHash == Hash) && (Sites[Index].depth == Depth) && (!memcmp(Sites[Index].frames, Frames, sizeof(void*) * Depth)))
+        {
+            Site = &Sites[Index];
+            break;
+        }
+    }
+    
+    atomic_flag_clear_explicit(&SitesLock, memory_order_release);
+    
+    return Site;
+}
+
+void *CCSamplingAllocatorSample(size_t Size)
+{
+    const size_t Rate = atomic_load_explicit(&SamplingRate, memory_order_relaxed);
+    if (!Rate) return NULL;
+    
+    const uint32_t Generation = atomic_load_explicit(&SamplingGeneration, memory_order_relaxed);
+    if ((!ThreadState.init) || (ThreadState.generation != Generation))
+    {
+        if (!ThreadState.init) ThreadState.seed = ((uint64_t)(uintptr_t)&ThreadState ^ (uint64_t)time(NULL)) | 1;
+        
+        ThreadState.init = TRUE;
+        ThreadState.generation = Generation;
+        ThreadState.remaining = CCSamplingAllocatorNextInterval(Rate);
+    }
+    
+    if (Size < ThreadState.remaining)
+    {
+        ThreadState.remaining -= Size;
+        return NULL;
+    }
+    
+    ThreadState.remaining = CCSamplingAllocatorNextInterval(Rate);
+    
+    size_t Depth = 0;
+    void *Frames[CC_SAMPLING_ALLOCATOR_MAX_DEPTH + CC_SAMPLING_ALLOCATOR_SKIP_FRAMES];
+#if CC_SAMPLING_ALLOCATOR_USING_EXECINFO
+    const int Count = backtrace(Frames, sizeof(Frames) / sizeof(*Frames));
+    if (Count > CC_SAMPLING_ALLOCATOR_SKIP_FRAMES) Depth = Count - CC_SAMPLING_ALLOCATOR_SKIP_FRAMES;
+#endif
+    
+    CCSamplingAllocatorSite *Site = CCSamplingAllocatorGetSite(Frames + CC_SAMPLING_ALLOCATOR_SKIP_FRAMES, Depth);
+    
+    atomic_fetch_add_explicit(&Site->allocatedCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&Site->allocatedSize, Size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&Site->inUseCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&Site->inUseSize, Size, memory_order_relaxed);
+    
+    return Site;
+}
+
+void CCSamplingAllocatorRelease(void *Sample, size_t Size)
+{
+    CCAssertLog(Sample, "Sample must not be null");
+    
+    CCSamplingAllocatorSite *Site = Sample;
+    
+    atomic_fetch_sub_explicit(&Site->inUseCount, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&Site->inUseSize, Size, memory_order_relaxed);
+}
+
+static size_t CCSamplingAllocatorGetActiveSites(CCSamplingAllocatorSite **ActiveSites)
+{
+    size_t Count = 0;
+    for (size_t Loop = 0; Loop < CC_SAMPLING_ALLOCATOR_MAX_SITES; Loop++)
+    {
+        if (atomic_load_explicit(&Sites[Loop].hash, memory_order_acquire)) ActiveSites[Count++] = &Sites[Loop];
+    }
+    
+    if (atomic_load_explicit(&UnknownSite.allocatedCount, memory_order_relaxed)) ActiveSites[Count++] = &UnknownSite;
+    
+    return Count;
+}
+
+CCSamplingAllocatorStatistics CCSamplingAllocatorGetStatistics(void)
+{
+    CCSamplingAllocatorStatistics Statistics = { .allocated = { 0, 0 }, .inUse = { 0, 0 } };
+    
+    for (size_t Loop = 0; Loop <= CC_SAMPLING_ALLOCATOR_MAX_SITES; Loop++)
+    {
+        const CCSamplingAllocatorSite *Site = Loop < CC_SAMPLING_ALLOCATOR_MAX_SITES ? &Sites[Loop] : &UnknownSite;
+        if (atomic_load_explicit(&Site->hash, memory_order_acquire))
+        {
+            Statistics.allocated.count += atomic_load_explicit(&Site->allocatedCount, memory_order_relaxed);
+            Statistics.allocated.size += atomic_load_explicit(&Site->allocatedSize, memory_order_relaxed);
+            Statistics.inUse.count += atomic_load_explicit(&Site->inUseCount, memory_order_relaxed);
+            Statistics.inUse.size += atomic_load_explicit(&Site->inUseSize, memory_order_relaxed);
+        }
+    }
+    
+    return Statistics;
+}
+
+static double CCSamplingAllocatorScale(size_t Count, size_t Size, size_t Rate)
+{
+    //Unbiased estimate for a poisson sampled allocation of the average size
+    if ((!Count) || (!Rate)) return 1.0;
+    
+    return 1.0 / (1.0 - exp(-((double)Size / (double)Count) / (double)Rate));
+}
+
+static size_t CCSamplingAllocatorEstimatedInUseSize(const CCSamplingAllocatorSite *Site, size_t Rate)
+{
+    const size_t Count = atomic_load_explicit(&Site->inUseCount, memory_order_relaxed), Size = atomic_load_explicit(&Site->inUseSize, memory_order_relaxed);
+    
+    return (size_t)((double)Size * CCSamplingAllocatorScale(Count, Size, Rate));
+}
+
+static int CCSamplingAllocatorSiteCompare(const void *a, const void *b)
+{
+    const size_t Rate = CCSamplingAllocatorGetRate();
+    const size_t SizeA = CCSamplingAllocatorEstimatedInUseSize(*(CCSamplingAllocatorSite* const*)a, Rate), SizeB = CCSamplingAllocatorEstimatedInUseSize(*(CCSamplingAllocatorSite* const*)b, Rate);
+    
+    return SizeA < SizeB ? 1 : (SizeA > SizeB ? -1 : 0);
+}
+
+static void CCSamplingAllocatorWriteFlat(FILE *File, CCSamplingAllocatorSite **ActiveSites, size_t Count, size_t Rate)
+{
+    qsort(ActiveSites, Count, sizeof(CCSamplingAllocatorSite*), CCSamplingAllocatorSiteCompare);
+    
+    fprintf(File, "Sampling rate: %zu bytes\n", Rate);
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const CCSamplingAllocatorSite *Site = ActiveSites[Loop];
+        const size_t InUseCount = atomic_load_explicit(&Site->inUseCount, memory_order_relaxed), InUseSize = atomic_load_explicit(&Site->inUseSize, memory_order_relaxed);
+        const size_t AllocatedCount = atomic_load_explicit(&Site->allocatedCount, memory_order_relaxed), AllocatedSize = atomic_load_explicit(&Site->allocatedSize, memory_order_relaxed);
+        const double InUseScale = CCSamplingAllocatorScale(InUseCount, InUseSize, Rate), AllocatedScale = CCSamplingAllocatorScale(AllocatedCount, AllocatedSize, Rate);
+        
+        fprintf(File, "\n%zu bytes (%zu objects) in use, %zu bytes (%zu objects) allocated:\n", (size_t)((double)InUseSize * InUseScale), (size_t)((double)InUseCount * InUseScale), (size_t)((double)AllocatedSize * AllocatedScale), (size_t)((double)AllocatedCount * AllocatedScale));
+        
+        if (!Site->depth) fprintf(File, "\t<unknown>\n");
+        
+#if CC_SAMPLING_ALLOCATOR_USING_EXECINFO
+        else
+        {
+            char **Symbols = backtrace_symbols(Site->frames, (int)Site->depth);
+            for (size_t Loop2 = 0; Loop2 < Site->depth; Loop2++)
+            {
+                if (Symbols) fprintf(File, "\t%s\n", Symbols[Loop2]);
+                else fprintf(File, "\t%p\n", Site->frames[Loop2]);
+            }
+            
+            free(Symbols);
+        }
+#endif
+    }
+}
+
+static void CCSamplingAllocatorWritePprof(FILE *File, CCSamplingAllocatorSite **ActiveSites, size_t Count, size_t Rate)
+{
+    const CCSamplingAllocatorStatistics Statistics = CCSamplingAllocatorGetStatistics();
+    
+    fprintf(File, "heap profile: %zu: %zu [%zu: %zu] @ heap_v2/%zu\n", Statistics.inUse.count, Statistics.inUse.size, Statistics.allocated.count, Statistics.allocated.size, Rate);
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const CCSamplingAllocatorSite *Site = ActiveSites[Loop];
+        
+        fprintf(File, "%zu: %zu [%zu: %zu] @", atomic_load_explicit(&Site->inUseCount, memory_order_relaxed), atomic_load_explicit(&Site->inUseSize, memory_order_relaxed), atomic_load_explicit(&Site->allocatedCount, memory_order_relaxed), atomic_load_explicit(&Site->allocatedSize, memory_order_relaxed));
+        
+        for (size_t Loop2 = 0; Loop2 < Site->depth; Loop2++) fprintf(File, " %p", Site->frames[Loop2]);
+        
+        fprintf(File, "\n");
+    }
+    
+#if CC_PLATFORM_UNIX
+    FILE *Maps = fopen("/proc/self/maps", "r");
+    if (Maps)
+    {
+        fprintf(File, "\nMAPPED_LIBRARIES:\n");
+        
+        char Buffer[4096];
+        for (size_t Size; (Size = fread(Buffer, 1, sizeof(Buffer), Maps)); ) fwrite(Buffer, 1, Size, File);
+        
+        fclose(Maps);
+    }
+#endif
+}
+
+void CCSamplingAllocatorWrite(FILE *File, CCSamplingAllocatorFormat Format)
+{
+    CCAssertLog(File, "File must not be null");
+    
+    CCSamplingAllocatorSite **ActiveSites = malloc(sizeof(CCSamplingAllocatorSite*) * (CC_SAMPLING_ALLOCATOR_MAX_SITES + 1));
+    if (!ActiveSites)
+    {
+        CC_LOG_ERROR("Failed to write sampling profile: Failed to allocate memory of size (%zu)", sizeof(CCSamplingAllocatorSite*) * (CC_SAMPLING_ALLOCATOR_MAX_SITES + 1));
+        return;
+    }
+    
+    const size_t Count = CCSamplingAllocatorGetActiveSites(ActiveSites), Rate = CCSamplingAllocatorGetRate();
+    
+    switch (Format)
+    {
+        case CCSamplingAllocatorFormatFlat:
+            CCSamplingAllocatorWriteFlat(File, ActiveSites, Count, Rate);
+            break;
+            
+        case CCSamplingAllocatorFormatPprof:
+            CCSamplingAllocatorWritePprof(File, ActiveSites, Count, Rate);
+            break;
+    }
+    
+    free(ActiveSites);
+}
+
+void CCSamplingAllocatorPrint(CCSamplingAllocatorFormat Format)
+{
+    CCSamplingAllocatorWrite(stdout, Format);
+}
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_SamplingAllocator_h
+#define CommonC_SamplingAllocator_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Extensions.h>
+#include <stdio.h>
+
+/*!
+ * @brief The format of the profile output.
+ */
+typedef CC_ENUM(CCSamplingAllocatorFormat, uint8_t) {
+    ///A human readable listing of the call sites, ordered by the estimated memory in use.
+    CCSamplingAllocatorFormatFlat,
+    ///A legacy pprof heap profile (heap_v2) that can be passed to the pprof tool.
+    CCSamplingAllocatorFormatPprof
+};
+
+/*!
+ * @brief The raw (unscaled) statistics of the sampled allocations.
+ */
+typedef struct {
+    struct {
+        size_t count;
+        size_t size;
+    } allocated, inUse;
+} CCSamplingAllocatorStatistics;
+
+/*!
+ * @brief Set the sampling rate.
+ * @description Allocations made by the @b CC_SAMPLING_ALLOCATOR are sampled on average once every
+ *              @b Rate bytes (poisson sampling). A sampled allocation records the stack trace of
+ *              the call site. The default rate is 512KiB.
+ *
+ * @param Rate The average number of bytes between samples. A rate of 0 will disable sampling.
+ */
+void CCSamplingAllocatorSetRate(size_t Rate);
+
+/*!
+ * @brief Get the sampling rate.
+ * @return The average number of bytes between samples.
+ */
+size_t CCSamplingAllocatorGetRate(void);
+
+/*!
+ * @brief Account for an allocation of size.
+ * @description This is used by the allocator, and only needs to be called for custom allocators
+ *              that want to take part in sampling.
+ *
+ * @param Size The size of the allocation.
+ * @return The sample reference if the allocation was sampled, or NULL if it was not. A sample
+ *         reference must be released with @b CCSamplingAllocatorRelease.
+ */
+void *CCSamplingAllocatorSample(size_t Size);
+
+/*!
+ * @brief Release a sampled allocation.
+ * @param Sample The sample reference returned by @b CCSamplingAllocatorSample.
+ * @param Size The size of the allocation that was sampled.
+ */
+void CCSamplingAllocatorRelease(void *Sample, size_t Size);
+
+/*!
+ * @brief Get the statistics of all sampled allocations.
+ * @return The statistics.
+ */
+CCSamplingAllocatorStatistics CCSamplingAllocatorGetStatistics(void);
+
+/*!
+ * @brief Write the profile of the sampled allocations.
+ * @param File The file to write the profile to.
+ * @param Format The format of the profile.
+ */
+void CCSamplingAllocatorWrite(FILE *File, CCSamplingAllocatorFormat Format);
+
+/*!
+ * @brief Print the profile of the sampled allocations.
+ * @param Format The format of the profile.
+ */
+void CCSamplingAllocatorPrint(CCSamplingAllocatorFormat Format);
+
+#endif
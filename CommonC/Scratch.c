@@ -0,0 +1,208 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "Scratch.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "Logging.h"
+#include "Platform.h"
+
+#if defined(__has_include)
+
+#if __has_include(<threads.h>)
+#define CC_SCRATCH_USING_STDTHREADS 1
+#include <threads.h>
+#elif CC_PLATFORM_POSIX_COMPLIANT
+#define CC_SCRATCH_USING_PTHREADS 1
+#include <pthread.h>
+#else
+#error No thread support
+#endif
+
+#elif CC_PLATFORM_POSIX_COMPLIANT
+#define CC_SCRATCH_USING_PTHREADS 1
+#include <pthread.h>
+#else
+#define CC_SCRATCH_USING_STDTHREADS 1
+#include <threads.h>
+#endif
+
+#ifndef CC_SCRATCH_BLOCK_SIZE
+#define CC_SCRATCH_BLOCK_SIZE 65536
+#endif
+
+#define CC_SCRATCH_ALIGNMENT (sizeof(void*) * 2)
+
+typedef struct CCScratchBlock {
+    struct CCScratchBlock *prev;
+    size_t size;
+    _Alignas(CC_SCRATCH_ALIGNMENT) uint8_t data[];
+} CCScratchBlock;
+
+typedef struct {
+    CCScratchBlock *block;
+    size_t offset;
+    CCScratchBlock *spare;
+} CCScratchState;
+
+static _Thread_local CCScratchState *ThreadState = NULL;
+
+#if CC_SCRATCH_USING_PTHREADS
+static pthread_key_t StateKey;
+static pthread_once_t StateKeyOnce = PTHREAD_ONCE_INIT;
+#elif CC_SCRATCH_USING_STDTHREADS
+static tss_t StateKey;
+static once_flag StateKeyOnce = ONCE_FLAG_INIT;
+#endif
+
+static void CCScratchStateDestructor(CCScratchState *State)
+{
+    for (CCScratchBlock *Block = State->block; Block; )
+    {
+        CCScratchBlock *Prev = Block->prev;
+        CCFree(Block);
+        Block = Prev;
+    }
+    
+    if (State->spare) CCFree(State->spare);
+    
+    CCFree(State);
+}
+
+static void CCScratchCreateStateKey(void)
+{
+#if CC_SCRATCH_USING_PTHREADS
+    pthread_key_create(&StateKey, (void(*)(void*))CCScratchStateDestructor);
+#elif CC_SCRATCH_USING_STDTHREADS
+    tss_create(&StateKey, (tss_dtor_t)CCScratchStateDestructor);
+#endif
+}
+
+static CCScratchState *CCScratchGetState(void)
+{
+    if (CC_UNLIKELY(!ThreadState))
+    {
+        CCScratchState *State;
+        CC_SAFE_Malloc(State, sizeof(CCScratchState),
+                       CC_LOG_ERROR("Failed to create thread local scratch state.");
+                       return NULL;
+                       );
+        
+        *State = (CCScratchState){ .block = NULL, .offset = 0, .spare = NULL };
+        
+#if CC_SCRATCH_USING_PTHREADS
+        pthread_once(&StateKeyOnce, CCScratchCreateStateKey);
+        pthread_setspecific(StateKey, State);
+#elif CC_SCRATCH_USING_STDTHREADS
+        call_once(&StateKeyOnce, CCScratchCreateStateKey);
+        tss_set(StateKey, State);
+#endif
+        
+        ThreadState = State;
+    }
+    
+    return ThreadState;
+}
+
+CCScratchMark CCScratchGetMark(void)
+{
+    const CCScratchState *State = ThreadState;
+    
+    return State ? (CCScratchMark){ .block = State->block, .offset = State->offset } : (CCScratchMark){ .block = NULL, .offset = 0 };
+}
+
+void *CCScratchAllocate(size_t Size)
+{
+    CCScratchState *State = CCScratchGetState();
+    if (!State) return NULL;
+    
+    Size = (Size + (CC_SCRATCH_ALIGNMENT - 1)) & ~(CC_SCRATCH_ALIGNMENT - 1);
+    
+    if ((!State->block) || ((State->block->size - State->offset) < Size))
+    {
+        CCScratchBlock *Block = State->spare;
+        if ((Block) && (Block->size >= Size)) State->spare = NULL;
+        else
+        {
+            size_t BlockSize = State->block ? State->block->size * 2 : CC_SCRATCH_BLOCK_SIZE;
+            if (BlockSize < Size) BlockSize = Size;
+            
+            CC_SAFE_Malloc(Block, sizeof(CCScratchBlock) + BlockSize,
+                           CC_LOG_ERROR("Failed to allocate scratch memory. Allocation size (%zu)", sizeof(CCScratchBlock) + BlockSize);
+                           return NULL;
+                           );
+            
+            Block->size = BlockSize;
+        }
+        
+        Block->prev = State->block;
+        State->block = Block;
+        State->offset = 0;
+    }
+    
+    void *Ptr = State->block->data + State->offset;
+    State->offset += Size;
+    
+    return Ptr;
+}
+
+void CCScratchRelease(CCScratchMark Mark)
+{
+    CCScratchState *State = ThreadState;
+    if (!State) return;
+    
+    //The popped blocks' offsets are not retained, but popping any block already proves the marks were released in order
+    const _Bool Popped = State->block != Mark.block;
+    while (State->block != Mark.block)
+    {
+        CCAssertLog(State->block, "Mark must belong to the current thread's scratch stack");
+        
+        CCScratchBlock *Block = State->block;
+        State->block = Block->prev;
+        
+        if ((!State->spare) || (State->spare->size < Block->size))
+        {
+            if (State->spare) CCFree(State->spare);
+            State->spare = Block;
+        }
+        
+        else CCFree(Block);
+    }
+    
+    CCAssertLog(Popped || (Mark.offset <= State->offset), "Marks must be released in reverse order");
+    
+    State->offset = Mark.offset;
+}
+
+void CCScratchPurge(void)
+{
+    CCScratchState *State = ThreadState;
+    if ((State) && (State->spare))
+    {
+        CCFree(State->spare);
+        State->spare = NULL;
+    }
+}
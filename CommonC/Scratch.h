@@ -0,0 +1,71 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_Scratch_h
+#define CommonC_Scratch_h
+
+#include <CommonC/Base.h>
+
+/*!
+ * @brief A position in the current thread's scratch stack.
+ * @description Used to release all scratch allocations made after the mark was taken.
+ */
+typedef struct {
+    void *block;
+    size_t offset;
+} CCScratchMark;
+
+/*!
+ * @brief Get the current position of the thread's scratch stack.
+ * @return The mark to be passed to @b CCScratchRelease.
+ */
+CCScratchMark CCScratchGetMark(void);
+
+/*!
+ * @brief Allocate temporary memory from the thread's scratch stack.
+ * @description Scratch allocations are intended for short-lived temporary buffers. The memory
+ *              is owned by the current thread and remains valid until a mark taken prior to
+ *              the allocation is released. Scratch memory must not be freed with @b CCFree.
+ *
+ * @param Size The size of the allocation.
+ * @return The pointer to the allocation, or NULL on failure.
+ */
+void *CCScratchAllocate(size_t Size);
+
+/*!
+ * @brief Release the scratch allocations made after the mark.
+ * @description Marks must be released in the reverse order they were taken.
+ * @param Mark The mark to return the thread's scratch stack to.
+ */
+void CCScratchRelease(CCScratchMark Mark);
+
+/*!
+ * @brief Free any scratch memory the current thread is no longer using.
+ * @description The scratch stack keeps its largest unused block around for reuse. Any remaining
+ *              memory will automatically be freed when the thread exits.
+ */
+void CCScratchPurge(void);
+
+#endif
@@ -0,0 +1,231 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "SoAArray.h"
+#include "MemoryAllocation.h"
+#include <string.h>
+
+
+#ifndef CC_SOA_ARRAY_GROWTH_FACTOR
+#define CC_SOA_ARRAY_GROWTH_FACTOR 2
+#endif
+
+_Static_assert((CC_SOA_ARRAY_ALIGNMENT & (CC_SOA_ARRAY_ALIGNMENT - 1)) == 0, "CC_SOA_ARRAY_ALIGNMENT must be a power of 2");
+
+static inline size_t CCSoAArrayAlign(size_t Value, size_t Alignment)
+{
+    return (Value + (Alignment - 1)) & ~(Alignment - 1);
+}
+
+static void CCSoAArrayDestructor(CCSoAArray Ptr)
+{
+    CCFree(Ptr->storage);
+}
+
+static _Bool CCSoAArrayResize(CCSoAArray Array, size_t Capacity, CCErrorCallback ErrorCallback)
+{
+    //All columns share the one allocation, each starting on its own alignment boundary
+    size_t Size = 0, Alignment = 1;
+    for (size_t Loop = 0; Loop < Array->fieldCount; Loop++)
+    {
+        Size = CCSoAArrayAlign(Size, Array->columns[Loop].alignment) + CCSoAArrayAlign(Capacity * Array->columns[Loop].size, CC_SOA_ARRAY_ALIGNMENT);
+        if (Array->columns[Loop].alignment > Alignment) Alignment = Array->columns[Loop].alignment;
+    }
+    
+    void *Storage = CCMalloc(Array->allocator, Size + (Alignment - 1), NULL, ErrorCallback);
+    if (!Storage) return FALSE;
+    
+    uintptr_t Offset = (uintptr_t)Storage;
+    for (size_t Loop = 0; Loop < Array->fieldCount; Loop++)
+    {
+        Offset = CCSoAArrayAlign(Offset, Array->columns[Loop].alignment);
+        
+        void *Data = (void*)Offset;
+        if (Array->count) memcpy(Data, Array->columns[Loop].data, Array->count * Array->columns[Loop].size);
+        
+        Array->columns[Loop].data = Data;
+        Offset += CCSoAArrayAlign(Capacity * Array->columns[Loop].size, CC_SOA_ARRAY_ALIGNMENT);
+    }
+    
+    CCFree(Array->storage);
+    Array->storage = Storage;
+    Array->capacity = Capacity;
+    
+    return TRUE;
+}
+
+CCSoAArray CCSoAArrayCreate(CCAllocatorType Allocator, const CCSoAArrayField *Fields, size_t FieldCount, size_t ChunkSize)
+{
+    CCAssertLog(Fields, "Fields must not be null");
+    CCAssertLog(FieldCount >= 1, "FieldCount must be at least 1");
+    CCAssertLog(ChunkSize >= 1, "ChunkSize must be at least 1");
+    
+    CCSoAArray Array = CCMalloc(Allocator, sizeof(CCSoAArrayInfo) + (sizeof(*Array->columns) * FieldCount), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Array)
+    {
+        *Array = (CCSoAArrayInfo){
+            .allocator = Allocator,
+            .chunkSize = ChunkSize,
+            .count = 0,
+            .capacity = 0,
+            .storage = NULL,
+            .fieldCount = FieldCount
+        };
+        
+        for (size_t Loop = 0; Loop < FieldCount; Loop++)
+        {
+            CCAssertLog(Fields[Loop].alignment && !(Fields[Loop].alignment & (Fields[Loop].alignment - 1)), "Field alignment must be a power of 2");
+            CCAssertLog(!(Fields[Loop].size % Fields[Loop].alignment), "Field size must be a multiple of its alignment");
+            
+            Array->columns[Loop].size = Fields[Loop].size;
+            Array->columns[Loop].alignment = Fields[Loop].alignment > CC_SOA_ARRAY_ALIGNMENT ? Fields[Loop].alignment : CC_SOA_ARRAY_ALIGNMENT;
+            Array->columns[Loop].data = NULL;
+        }
+        
+        CCSoAArrayResize(Array, ChunkSize, CC_DEFAULT_ERROR_CALLBACK);
+        
+        CCMemorySetDestructor(Array, (CCMemoryDestructorCallback)CCSoAArrayDestructor);
+    }
+    
+    return Array;
+}
+
+void CCSoAArrayDestroy(CCSoAArray Array)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCFree(Array);
+}
+
+static inline size_t CCSoAArrayRoundToChunk(CCSoAArray Array, size_t Count)
+{
+    return ((Count + (Array->chunkSize - 1)) / Array->chunkSize) * Array->chunkSize;
+}
+
+static _Bool CCSoAArrayGrow(CCSoAArray Array, size_t Count)
+{
+    if ((Array->count + Count) <= Array->capacity) return TRUE;
+    
+    const size_t Minimum = CCSoAArrayRoundToChunk(Array, Array->count + Count);
+    
+    const size_t Capacity = CCSoAArrayRoundToChunk(Array, (size_t)(Array->capacity * CC_SOA_ARRAY_GROWTH_FACTOR));
+    if ((Capacity > Minimum) && (CCSoAArrayResize(Array, Capacity, NULL))) return TRUE;
+    
+    //Allocations may have an upper bound (such as static allocations), so fallback to only what is needed
+    return CCSoAArrayResize(Array, Minimum, CC_DEFAULT_ERROR_CALLBACK);
+}
+
+size_t CCSoAArrayAppendElement(CCSoAArray Array, const void * const *Fields)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    if (!CCSoAArrayGrow(Array, 1)) return SIZE_MAX;
+    
+    const size_t Index = Array->count++;
+    if (Fields) CCSoAArrayReplaceElementAtIndex(Array, Index, Fields);
+    
+    return Index;
+}
+
+size_t CCSoAArrayAppendElements(CCSoAArray Array, const void * const *Columns, size_t Count)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Count, "Count must not be 0");
+    
+    if (!CCSoAArrayGrow(Array, Count)) return SIZE_MAX;
+    
+    const size_t Index = Array->count;
+    if (Columns)
+    {
+        for (size_t Loop = 0; Loop < Array->fieldCount; Loop++)
+        {
+            if (Columns[Loop]) memcpy(Array->columns[Loop].data + (Index * Array->columns[Loop].size), Columns[Loop], Count * Array->columns[Loop].size);
+        }
+    }
+    
+    Array->count += Count;
+    
+    return Index;
+}
+
+void CCSoAArrayReplaceElementAtIndex(CCSoAArray Array, size_t Index, const void * const *Fields)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Fields, "Fields must not be null");
+    CCAssertLog(Index < Array->count, "Index must not be out of bounds");
+    
+    for (size_t Loop = 0; Loop < Array->fieldCount; Loop++)
+    {
+        if (Fields[Loop]) memcpy(Array->columns[Loop].data + (Index * Array->columns[Loop].size), Fields[Loop], Array->columns[Loop].size);
+    }
+}
+
+void CCSoAArrayRemoveElementAtIndex(CCSoAArray Array, size_t Index)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Index < Array->count, "Index must not be out of bounds");
+    
+    const size_t Moved = --Array->count - Index;
+    if (Moved)
+    {
+        for (size_t Loop = 0; Loop < Array->fieldCount; Loop++)
+        {
+            void *Data = Array->columns[Loop].data + (Index * Array->columns[Loop].size);
+            memmove(Data, Data + Array->columns[Loop].size, Moved * Array->columns[Loop].size);
+        }
+    }
+}
+
+void CCSoAArraySwapRemoveElementAtIndex(CCSoAArray Array, size_t Index)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Index < Array->count, "Index must not be out of bounds");
+    
+    const size_t Last = --Array->count;
+    if (Index != Last)
+    {
+        for (size_t Loop = 0; Loop < Array->fieldCount; Loop++)
+        {
+            const size_t Size = Array->columns[Loop].size;
+            memcpy(Array->columns[Loop].data + (Index * Size), Array->columns[Loop].data + (Last * Size), Size);
+        }
+    }
+}
+
+void CCSoAArrayRemoveAllElements(CCSoAArray Array)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    Array->count = 0;
+}
+
+_Bool CCSoAArrayReserve(CCSoAArray Array, size_t Count)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    if (Count <= Array->capacity) return TRUE;
+    
+    return CCSoAArrayResize(Array, CCSoAArrayRoundToChunk(Array, Count), CC_DEFAULT_ERROR_CALLBACK);
+}
@@ -0,0 +1,278 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCSoAArray
+ * CCSoAArray implements a dynamic array of records stored as a structure of arrays.
+ *
+ * Each field of the records is stored in its own contiguous column, so loops that only access some
+ * of the fields do not need to load the others. The columns are aligned and padded to
+ * @b CC_SOA_ARRAY_ALIGNMENT, so they can be processed directly with vector types (such as
+ * @b CCVector4D or @b CCVector).
+ */
+
+#ifndef CommonC_SoAArray_h
+#define CommonC_SoAArray_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Assertion.h>
+
+
+#ifndef CC_SOA_ARRAY_ALIGNMENT
+/*!
+ * @define CC_SOA_ARRAY_ALIGNMENT
+ * @abstract The minimum alignment of every column, and the multiple of bytes every column's storage
+ *           is padded to. Must be a power of 2.
+ */
+#define CC_SOA_ARRAY_ALIGNMENT 64
+#endif
+
+/*!
+ * @brief The description of a field of the records.
+ */
+typedef struct {
+    ///The size of the field. Must be a multiple of the alignment.
+    size_t size;
+    ///The alignment of the field. Must be a power of 2.
+    size_t alignment;
+} CCSoAArrayField;
+
+/*!
+ * @define CC_SOA_ARRAY_FIELD
+ * @abstract Convenient macro to describe a field of a given type.
+ * @param type The type of the field.
+ */
+#define CC_SOA_ARRAY_FIELD(type) ((CCSoAArrayField){ .size = sizeof(type), .alignment = _Alignof(type) })
+
+typedef struct CCSoAArrayInfo {
+    CCAllocatorType allocator;
+    size_t chunkSize;
+    size_t count, capacity;
+    void *storage;
+    size_t fieldCount;
+    struct {
+        size_t size, alignment;
+        void *data;
+    } columns[];
+} CCSoAArrayInfo;
+
+/*!
+ * @brief The structure of arrays.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCSoAArrayInfo *CCSoAArray;
+
+
+#pragma mark - Creation/Destruction
+/*!
+ * @brief Create a structure of arrays.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Fields The fields of the records.
+ * @param FieldCount The number of fields. Must be at least 1.
+ * @param ChunkSize The number of records to fit with each allocation. The capacity of the array will
+ *        always be a multiple of this. Must be at least 1.
+ *
+ * @return An empty structure of arrays, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCSoAArray CCSoAArrayCreate(CCAllocatorType Allocator, const CCSoAArrayField *Fields, size_t FieldCount, size_t ChunkSize);
+
+/*!
+ * @brief Destroy a structure of arrays.
+ * @param Array The structure of arrays to be destroyed.
+ */
+void CCSoAArrayDestroy(CCSoAArray CC_DESTROY(Array));
+
+
+#pragma mark - Insertions/Deletions
+/*!
+ * @brief Appends a record to the end of the array.
+ * @param Array The structure of arrays to append the record to.
+ * @param Fields The pointers to each field of the record to be copied. If NULL, or an individual
+ *        field is NULL, it will be left uninitialized.
+ *
+ * @return The index the record was added or SIZE_MAX on failure.
+ */
+size_t CCSoAArrayAppendElement(CCSoAArray Array, const void * const *Fields);
+
+/*!
+ * @brief Appends records to the end of the array.
+ * @param Array The structure of arrays to append the records to.
+ * @param Columns The pointers to each field's contiguous values for the records to be copied. If
+ *        NULL, or an individual column is NULL, it will be left uninitialized.
+ *
+ * @param Count The number of records to append. Must not be 0.
+ * @return The index the first record was added or SIZE_MAX on failure.
+ */
+size_t CCSoAArrayAppendElements(CCSoAArray Array, const void * const *Columns, size_t Count);
+
+/*!
+ * @brief Replace a record in the array.
+ * @warning Index must not be out of bounds.
+ * @param Array The structure of arrays to replace the record of.
+ * @param Index The index of the record.
+ * @param Fields The pointers to each field of the record to be copied. Individual fields that are
+ *        NULL will be left unchanged.
+ */
+void CCSoAArrayReplaceElementAtIndex(CCSoAArray Array, size_t Index, const void * const *Fields);
+
+/*!
+ * @brief Remove a record from the array, preserving the order of the remaining records.
+ * @warning Index must not be out of bounds.
+ * @performance O(n)
+ * @param Array The structure of arrays to remove the record from.
+ * @param Index The index of the record.
+ */
+void CCSoAArrayRemoveElementAtIndex(CCSoAArray Array, size_t Index);
+
+/*!
+ * @brief Remove a record from the array, by moving the last record into its place.
+ * @warning Index must not be out of bounds.
+ * @performance O(1)
+ * @param Array The structure of arrays to remove the record from.
+ * @param Index The index of the record.
+ */
+void CCSoAArraySwapRemoveElementAtIndex(CCSoAArray Array, size_t Index);
+
+/*!
+ * @brief Remove all records from the array.
+ * @param Array The structure of arrays to remove the records from.
+ */
+void CCSoAArrayRemoveAllElements(CCSoAArray Array);
+
+
+#pragma mark - Capacity
+/*!
+ * @brief Ensure the array can hold a number of records without needing to reallocate.
+ * @description The capacity will be rounded up to a multiple of the chunk size.
+ * @param Array The structure of arrays to reserve the capacity of.
+ * @param Count The total number of records the array should be able to hold.
+ * @return TRUE if the array has the capacity, otherwise FALSE if it could not be allocated.
+ */
+_Bool CCSoAArrayReserve(CCSoAArray Array, size_t Count);
+
+
+#pragma mark - Query Info
+/*!
+ * @brief Get the number of records in the array.
+ * @param Array The structure of arrays to get the count of.
+ * @return The number of records.
+ */
+static inline size_t CCSoAArrayGetCount(CCSoAArray Array);
+
+/*!
+ * @brief Get the number of records the array can hold before it needs to reallocate.
+ * @param Array The structure of arrays to get the capacity of.
+ * @return The capacity of the array.
+ */
+static inline size_t CCSoAArrayGetCapacity(CCSoAArray Array);
+
+/*!
+ * @brief Get the number of fields of the records.
+ * @param Array The structure of arrays to get the field count of.
+ * @return The number of fields.
+ */
+static inline size_t CCSoAArrayGetFieldCount(CCSoAArray Array);
+
+/*!
+ * @brief Get the size of a field.
+ * @param Array The structure of arrays to get the field size of.
+ * @param Field The index of the field.
+ * @return The size of the field.
+ */
+static inline size_t CCSoAArrayGetFieldSize(CCSoAArray Array, size_t Field);
+
+/*!
+ * @brief Get the contiguous values of a field.
+ * @description The column is aligned to at least @b CC_SOA_ARRAY_ALIGNMENT, and its storage is
+ *              padded to a multiple of @b CC_SOA_ARRAY_ALIGNMENT bytes. So it may be processed in
+ *              whole vectors, where the values past the count are uninitialized.
+ *
+ * @param Array The structure of arrays to get the column of.
+ * @param Field The index of the field.
+ * @return A pointer to the first value of the field, or NULL if the array has no capacity. This
+ *         pointer is only valid until the array is next resized.
+ */
+static inline void *CCSoAArrayGetColumn(CCSoAArray Array, size_t Field);
+
+/*!
+ * @brief Get a field of a record.
+ * @warning Index must not be out of bounds.
+ * @param Array The structure of arrays to get the field from.
+ * @param Field The index of the field.
+ * @param Index The index of the record.
+ * @return A pointer to the field of the record.
+ */
+static inline void *CCSoAArrayGetFieldAtIndex(CCSoAArray Array, size_t Field, size_t Index);
+
+
+#pragma mark -
+static inline size_t CCSoAArrayGetCount(CCSoAArray Array)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    return Array->count;
+}
+
+static inline size_t CCSoAArrayGetCapacity(CCSoAArray Array)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    return Array->capacity;
+}
+
+static inline size_t CCSoAArrayGetFieldCount(CCSoAArray Array)
+{
+    CCAssertLog(Array, "Array must not be null");
+    
+    return Array->fieldCount;
+}
+
+static inline size_t CCSoAArrayGetFieldSize(CCSoAArray Array, size_t Field)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Field < Array->fieldCount, "Field must not be out of bounds");
+    
+    return Array->columns[Field].size;
+}
+
+static inline void *CCSoAArrayGetColumn(CCSoAArray Array, size_t Field)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Field < Array->fieldCount, "Field must not be out of bounds");
+    
+    return Array->columns[Field].data;
+}
+
+static inline void *CCSoAArrayGetFieldAtIndex(CCSoAArray Array, size_t Field, size_t Index)
+{
+    CCAssertLog(Array, "Array must not be null");
+    CCAssertLog(Field < Array->fieldCount, "Field must not be out of bounds");
+    CCAssertLog(Index < Array->count, "Index must not be out of bounds");
+    
+    return Array->columns[Field].data + (Index * Array->columns[Field].size);
+}
+
+#endif
@@ -26,6 +26,8 @@
 #import "AllocatorTests.h"
 #import "Allocator.h"
 #import "MemoryAllocation.h"
+#import <stdatomic.h>
+#import <pthread.h>
 
 static _Bool CalledA = NO, CalledD = NO, PassedData = NO, HeaderIntact = NO, CorrectPtr = NO, CalledDtor = NO;
 static uint8_t Memory[128];
@@ -113,4 +115,122 @@ static const uint32_t TestAllocator = 19;
     XCTAssertTrue(CalledDtor, @"Should call custom destructor");
 }
 
+-(void) testLargePageAllocator
+{
+    uint8_t *Ptr = CCMalloc(CC_LARGE_PAGE_ALLOCATOR, 16, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    for (size_t Loop = 0; Loop < 16; Loop++) Ptr[Loop] = Loop;
+    
+    const size_t Sizes[] = { 1024 * 1024, 5 * 1024 * 1024, 3 * 1024 * 1024, 100, 8 * 1024 * 1024, 50 };
+    size_t PrevSize = 16;
+    for (size_t Loop = 0; Loop < sizeof(Sizes) / sizeof(*Sizes); Loop++)
+    {
+        Ptr = CCRealloc(CC_LARGE_PAGE_ALLOCATOR, Ptr, Sizes[Loop], NULL, CC_DEFAULT_ERROR_CALLBACK);
+        XCTAssertTrue(Ptr, @"Should reallocate the memory");
+        
+        _Bool Retained = YES;
+        for (size_t Loop2 = 0, Count = PrevSize < Sizes[Loop] ? PrevSize : Sizes[Loop]; Loop2 < Count; Loop2++) Retained &= Ptr[Loop2] == (uint8_t)Loop2;
+        XCTAssertTrue(Retained, @"Should retain the contents when resizing from %zu to %zu", PrevSize, Sizes[Loop]);
+        
+        for (size_t Loop2 = 0; Loop2 < Sizes[Loop]; Loop2++) Ptr[Loop2] = Loop2;
+        PrevSize = Sizes[Loop];
+    }
+    
+    XCTAssertEqual(CCMemoryRetain(Ptr), Ptr);
+    CCFree(Ptr);
+    CCFree(Ptr);
+    
+    Ptr = CCMalloc(CC_LARGE_PAGE_NUMA_ALLOCATOR(0), 4 * 1024 * 1024, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    XCTAssertTrue(Ptr, @"Should allocate the memory");
+    memset(Ptr, 1, 4 * 1024 * 1024);
+    CCFree(Ptr);
+}
+
+-(void) testHeaderlessAllocation
+{
+    CalledA = NO; CalledD = NO; PassedData = NO; HeaderIntact = NO; CorrectPtr = NO;
+    int *Ptr = CCMemoryAllocateHeaderless((CCAllocatorType){ .allocator = TestAllocator, .data = &(int){ 0xdeadbeef } }, sizeof(int));
+    XCTAssertTrue(CalledA, @"Should call the custom allocator.");
+    if (CalledA) XCTAssertTrue(PassedData, @"Should pass in the data in CCAllocatorType.");
+    XCTAssertEqual((void*)Ptr, (void*)Memory + sizeof(int), @"Should not add an allocation header");
+    
+    CCMemoryDeallocateHeaderless((CCAllocatorType){ .allocator = TestAllocator }, Ptr);
+    XCTAssertTrue(CalledD, @"Should call the custom deallocator.");
+    if (CalledD)
+    {
+        XCTAssertTrue(HeaderIntact, @"No function besides this and the allocator should access this section of memory.");
+        XCTAssertTrue(CorrectPtr, @"Original pointer should remain the same.");
+    }
+    
+    Ptr = CCMemoryReallocateHeaderless(CC_STD_ALLOCATOR, CCMemoryAllocateHeaderless(CC_STD_ALLOCATOR, sizeof(int)), sizeof(int) * 1000);
+    Ptr[999] = 1;
+    CCMemoryDeallocateHeaderless(CC_STD_ALLOCATOR, Ptr);
+}
+
+-(void) testAllocationAlignment
+{
+    XCTAssertEqual(sizeof(CCAllocatorHeader) % _Alignof(max_align_t), 0, @"Header should preserve the alignment of the allocation");
+    
+    for (size_t Loop = 1; Loop <= 64; Loop++)
+    {
+        void *Ptr = CCMalloc(CC_STD_ALLOCATOR, Loop, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        XCTAssertEqual((uintptr_t)Ptr % _Alignof(max_align_t), 0, @"Should be aligned for any type");
+        
+        Ptr = CCRealloc(CC_STD_ALLOCATOR, Ptr, Loop * 1000, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        XCTAssertEqual((uintptr_t)Ptr % _Alignof(max_align_t), 0, @"Should be aligned for any type");
+        
+        CCFree(Ptr);
+    }
+}
+
+-(void) testDeferredDeallocation
+{
+    CalledDtor = NO;
+    void *Ptr = CCMalloc(CC_STD_ALLOCATOR, 1, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    CCMemorySetDestructor(Ptr, DestructorFunction);
+    
+    for (int Loop = 0; Loop < 10; Loop++) CCRetain(Ptr);
+    for (int Loop = 0; Loop < 10; Loop++) CCFreeDeferred(Ptr);
+    
+    XCTAssertEqual(CCRefCount(Ptr), 11, @"Should not apply the releases yet");
+    
+    CCMemoryDeallocateFlush();
+    XCTAssertEqual(CCRefCount(Ptr), 1, @"Should apply the releases");
+    
+    CCFreeDeferred(Ptr);
+    XCTAssertFalse(CalledDtor, @"Should not deallocate yet");
+    
+    CCMemoryDeallocateFlush();
+    XCTAssertTrue(CalledDtor, @"Should deallocate once the release is applied");
+}
+
+static _Atomic(int) DestructorCalls[4];
+static void RacingDestructor0(void *Ptr) { atomic_fetch_add(&DestructorCalls[0], 1); }
+static void RacingDestructor1(void *Ptr) { atomic_fetch_add(&DestructorCalls[1], 1); }
+static void RacingDestructor2(void *Ptr) { atomic_fetch_add(&DestructorCalls[2], 1); }
+static void RacingDestructor3(void *Ptr) { atomic_fetch_add(&DestructorCalls[3], 1); }
+static const CCMemoryDestructorCallback RacingDestructors[4] = { RacingDestructor0, RacingDestructor1, RacingDestructor2, RacingDestructor3 };
+
+static void *RacingDestructorThread(void *Arg)
+{
+    const CCMemoryDestructorCallback Destructor = RacingDestructors[(uintptr_t)Arg % 4];
+    
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        void *Ptr = CCMalloc(CC_STD_ALLOCATOR, 1, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        CCMemorySetDestructor(Ptr, Destructor);
+        CCFree(Ptr);
+    }
+    
+    return NULL;
+}
+
+-(void) testConcurrentDestructors
+{
+    pthread_t Threads[16];
+    for (uintptr_t Loop = 0; Loop < 16; Loop++) pthread_create(&Threads[Loop], NULL, RacingDestructorThread, (void*)Loop);
+    for (size_t Loop = 0; Loop < 16; Loop++) pthread_join(Threads[Loop], NULL);
+    
+    for (size_t Loop = 0; Loop < 4; Loop++) XCTAssertEqual(atomic_load(&DestructorCalls[Loop]), 400, @"Should call the destructor that was set");
+}
+
 @end
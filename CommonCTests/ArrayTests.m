@@ -367,4 +367,378 @@
     CCArrayDestroy(Array);
 }
 
+-(void) testCapacity
+{
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(int), 3);
+    
+    XCTAssertEqual(CCArrayGetCapacity(Array), 3, @"Should allocate a chunk");
+    
+    size_t Reallocations = 0;
+    for (int Loop = 0; Loop < 10000; Loop++)
+    {
+        const size_t Capacity = CCArrayGetCapacity(Array);
+        CCArrayAppendElement(Array, &Loop);
+        
+        if (Capacity != CCArrayGetCapacity(Array)) Reallocations++;
+        XCTAssertEqual(CCArrayGetCapacity(Array) % 3, 0, @"Should be a multiple of the chunk size");
+    }
+    
+    XCTAssertLessThan(Reallocations, 20, @"Should grow geometrically");
+    
+    CCArrayShrinkToFit(Array);
+    XCTAssertEqual(CCArrayGetCapacity(Array), 10002, @"Should shrink to the count rounded to the chunk size");
+    
+    for (int Loop = 0; Loop < 10000; Loop++) XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop), Loop, @"Should retain the elements");
+    
+    CCArrayRemoveAllElements(Array);
+    CCArrayShrinkToFit(Array);
+    XCTAssertEqual(CCArrayGetCapacity(Array), 0, @"Should release the data");
+    
+    XCTAssertTrue(CCArrayReserve(Array, 100), @"Should reserve the capacity");
+    XCTAssertEqual(CCArrayGetCapacity(Array), 102, @"Should reserve the count rounded to the chunk size");
+    
+    void *Data = CCArrayGetData(Array);
+    for (int Loop = 0; Loop < 100; Loop++) CCArrayAppendElement(Array, &Loop);
+    XCTAssertEqual(CCArrayGetData(Array), Data, @"Should not reallocate within the reserved capacity");
+    
+    XCTAssertTrue(CCArrayReserve(Array, 10), @"Should already have the capacity");
+    XCTAssertEqual(CCArrayGetCapacity(Array), 102, @"Should not shrink the capacity");
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreate(CC_ALIGNED_ALLOCATOR(64), sizeof(int), 1);
+    
+    for (int Loop = 0; Loop < 1000; Loop++)
+    {
+        CCArrayAppendElement(Array, &Loop);
+        XCTAssertEqual((uintptr_t)CCArrayGetData(Array) % 64, 0, @"Should use the allocator of the array");
+    }
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CC_STATIC_ARRAY(sizeof(int), 1, 0, CC_STATIC_ALLOC(int[3]));
+    
+    CCArrayAppendElement(Array, &(int){ 1 });
+    CCArrayAppendElement(Array, &(int){ 2 });
+    CCArrayAppendElement(Array, &(int){ 3 });
+    
+    XCTAssertEqual(CCArrayGetCount(Array), 3, @"Should fit within the static allocation");
+    XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Array, 2), 3, @"Should be the third element");
+    
+    CCArrayDestroy(Array);
+}
+
+-(void) testSmallArray
+{
+    CCArray Array = CCArrayCreateSmall(CC_STD_ALLOCATOR, sizeof(int), 4, 6);
+    
+    XCTAssertEqual(CCArrayGetCount(Array), 0, @"Should be empty");
+    XCTAssertEqual(CCArrayGetCapacity(Array), 6, @"Should have the inline capacity");
+    
+    void *Inline = CCArrayGetData(Array);
+    XCTAssertLessThan((uintptr_t)Inline - (uintptr_t)Array, 128, @"Should store the data inline");
+    
+    for (int Loop = 0; Loop < 6; Loop++) CCArrayAppendElement(Array, &Loop);
+    
+    XCTAssertEqual(CCArrayGetData(Array), Inline, @"Should not reallocate within the inline capacity");
+    
+    CCArrayShrinkToFit(Array);
+    XCTAssertEqual(CCArrayGetData(Array), Inline, @"Should not release the inline storage");
+    
+    CCArrayInsertElementAtIndex(Array, 0, &(int){ -1 });
+    XCTAssertNotEqual(CCArrayGetData(Array), Inline, @"Should move the elements to a separate allocation");
+    XCTAssertEqual(CCArrayGetCapacity(Array) % 4, 0, @"Should be a multiple of the chunk size");
+    XCTAssertEqual(CCArrayGetCount(Array), 7, @"Should contain all the elements");
+    
+    for (int Loop = 0; Loop < 7; Loop++) XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop), Loop - 1, @"Should retain the elements");
+    
+    for (int Loop = 6; Loop < 1000; Loop++) CCArrayAppendElement(Array, &Loop);
+    
+    CCArrayRemoveElementsAtIndex(Array, 10, 990);
+    CCArrayShrinkToFit(Array);
+    XCTAssertEqual(CCArrayGetCapacity(Array), 12, @"Should shrink to the count rounded to the chunk size");
+    
+    for (int Loop = 0; Loop < 10; Loop++) XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop), Loop - 1, @"Should retain the elements");
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreateSmall(CC_STD_ALLOCATOR, sizeof(int), 1, 2);
+    
+    XCTAssertTrue(CCArrayReserve(Array, 100), @"Should reserve the capacity");
+    XCTAssertEqual(CCArrayGetCapacity(Array), 100, @"Should reserve the capacity");
+    
+    for (int Loop = 0; Loop < 100; Loop++) CCArrayAppendElement(Array, &Loop);
+    for (int Loop = 0; Loop < 100; Loop++) XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop), Loop, @"Should retain the elements");
+    
+    CCArrayDestroy(Array);
+}
+
+static _Alignas(max_align_t) uint8_t MisalignedMemory[256];
+static void *MisalignedAllocator(void *Data, size_t Size)
+{
+    //Place the allocation so the memory after the header is only 8 byte aligned (as with CC_CUSTOM_ALLOCATOR)
+    const size_t Offset = (8 + _Alignof(max_align_t) - (sizeof(CCAllocatorHeader) % _Alignof(max_align_t))) % _Alignof(max_align_t);
+    
+    assert(Offset + Size <= sizeof(MisalignedMemory)); //update memory to be able to handle that size
+    return MisalignedMemory + Offset;
+}
+
+static void MisalignedDeallocator(void *Ptr)
+{
+}
+
+-(void) testSmallArrayAlignment
+{
+    const int MisalignedAllocatorIndex = 18;
+    CCAllocatorAdd(MisalignedAllocatorIndex, MisalignedAllocator, NULL, MisalignedDeallocator);
+    
+    CCArray Array = CCArrayCreateSmall((CCAllocatorType){ .allocator = MisalignedAllocatorIndex }, sizeof(long double), 4, 4);
+    
+    XCTAssertEqual((uintptr_t)Array % _Alignof(max_align_t), 8 % _Alignof(max_align_t), @"Should be an under-aligned allocation");
+    XCTAssertEqual((uintptr_t)CCArrayGetData(Array) % _Alignof(max_align_t), 0, @"Should align the inline storage");
+    
+    for (int Loop = 0; Loop < 4; Loop++) CCArrayAppendElement(Array, &(long double){ Loop });
+    for (int Loop = 0; Loop < 4; Loop++) XCTAssertEqual(*(long double*)CCArrayGetElementAtIndex(Array, Loop), Loop, @"Should retain the elements");
+    
+    CCArrayDestroy(Array);
+}
+
+static CCComparisonResult IntComparator(const int *Left, const int *Right)
+{
+    return *Left < *Right ? CCComparisonResultAscending : (*Left > *Right ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+typedef struct {
+    uint8_t key;
+    uint8_t padding[2];
+} SmallElement;
+
+static CCComparisonResult SmallElementComparator(const SmallElement *Left, const SmallElement *Right)
+{
+    return Left->key < Right->key ? CCComparisonResultAscending : (Left->key > Right->key ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+typedef struct {
+    int64_t key;
+    uint32_t order;
+    uint8_t data[13];
+} LargeElement;
+
+static CCComparisonResult LargeElementComparator(const LargeElement *Left, const LargeElement *Right)
+{
+    return Left->key < Right->key ? CCComparisonResultAscending : (Left->key > Right->key ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+-(void) testSorting
+{
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(int), 16);
+    
+    CCArraySort(Array, (CCComparator)IntComparator);
+    XCTAssertEqual(CCArrayGetCount(Array), 0, @"Should sort an empty array");
+    
+    for (size_t Count = 1; Count < 2000; Count = (Count * 3) + 1)
+    {
+        CCArrayRemoveAllElements(Array);
+        for (size_t Loop = 0; Loop < Count; Loop++) CCArrayAppendElement(Array, &(int){ (int)arc4random_uniform(100) - 50 });
+        
+        CCArraySort(Array, (CCComparator)IntComparator);
+        
+        XCTAssertEqual(CCArrayGetCount(Array), Count, @"Should not change the count");
+        for (size_t Loop = 1; Loop < Count; Loop++) XCTAssertLessThanOrEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop - 1), *(int*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in ascending order");
+        
+        //Already sorted, reversed, and uniform inputs
+        CCArraySort(Array, (CCComparator)IntComparator);
+        for (size_t Loop = 1; Loop < Count; Loop++) XCTAssertLessThanOrEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop - 1), *(int*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in ascending order");
+        
+        for (size_t Loop = 0; Loop < Count; Loop++) CCArrayReplaceElementAtIndex(Array, Loop, &(int){ (int)(Count - Loop) });
+        CCArraySort(Array, (CCComparator)IntComparator);
+        for (size_t Loop = 0; Loop < Count; Loop++) XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop), Loop + 1, @"Should be in ascending order");
+        
+        for (size_t Loop = 0; Loop < Count; Loop++) CCArrayReplaceElementAtIndex(Array, Loop, &(int){ 7 });
+        CCArraySort(Array, (CCComparator)IntComparator);
+        for (size_t Loop = 0; Loop < Count; Loop++) XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop), 7, @"Should retain the elements");
+    }
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(SmallElement), 16);
+    
+    for (size_t Loop = 0; Loop < 1000; Loop++) CCArrayAppendElement(Array, &(SmallElement){ .key = arc4random_uniform(256), .padding = { 1, 2 } });
+    
+    CCArraySort(Array, (CCComparator)SmallElementComparator);
+    for (size_t Loop = 1; Loop < 1000; Loop++)
+    {
+        const SmallElement *Element = CCArrayGetElementAtIndex(Array, Loop);
+        XCTAssertLessThanOrEqual(((SmallElement*)CCArrayGetElementAtIndex(Array, Loop - 1))->key, Element->key, @"Should be in ascending order");
+        XCTAssertTrue((Element->padding[0] == 1) && (Element->padding[1] == 2), @"Should move the entire element");
+    }
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(LargeElement), 16);
+    
+    for (size_t Loop = 0; Loop < 1000; Loop++)
+    {
+        LargeElement Element = { .key = (int64_t)arc4random() - INT32_MAX, .order = (uint32_t)Loop };
+        memset(Element.data, (int)Loop, sizeof(Element.data));
+        CCArrayAppendElement(Array, &Element);
+    }
+    
+    CCArraySort(Array, (CCComparator)LargeElementComparator);
+    for (size_t Loop = 1; Loop < 1000; Loop++)
+    {
+        const LargeElement *Element = CCArrayGetElementAtIndex(Array, Loop);
+        XCTAssertLessThanOrEqual(((LargeElement*)CCArrayGetElementAtIndex(Array, Loop - 1))->key, Element->key, @"Should be in ascending order");
+        XCTAssertEqual(Element->data[12], (uint8_t)Element->order, @"Should move the entire element");
+    }
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(uint8_t), 16);
+    
+    for (size_t Loop = 0; Loop < 1000; Loop++) CCArrayAppendElement(Array, &(uint8_t){ arc4random_uniform(256) });
+    
+    CCArraySort(Array, NULL);
+    for (size_t Loop = 1; Loop < 1000; Loop++) XCTAssertLessThanOrEqual(*(uint8_t*)CCArrayGetElementAtIndex(Array, Loop - 1), *(uint8_t*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in memcmp order");
+    
+    CCArrayDestroy(Array);
+}
+
+-(void) testRadixSort
+{
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(int), 16);
+    
+    for (size_t Loop = 0; Loop < 5000; Loop++) CCArrayAppendElement(Array, &(int){ (int)arc4random() });
+    
+    XCTAssertTrue(CCArrayRadixSort(Array, 0, sizeof(int), TRUE), @"Should sort the array");
+    for (size_t Loop = 1; Loop < 5000; Loop++) XCTAssertLessThanOrEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop - 1), *(int*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in signed ascending order");
+    
+    XCTAssertTrue(CCArrayRadixSort(Array, 0, sizeof(int), FALSE), @"Should sort the array");
+    for (size_t Loop = 1; Loop < 5000; Loop++) XCTAssertLessThanOrEqual(*(unsigned int*)CCArrayGetElementAtIndex(Array, Loop - 1), *(unsigned int*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in unsigned ascending order");
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(LargeElement), 16);
+    
+    for (size_t Loop = 0; Loop < 5000; Loop++)
+    {
+        LargeElement Element = { .key = (int64_t)arc4random_uniform(50) - 25, .order = (uint32_t)Loop };
+        memset(Element.data, (int)Loop, sizeof(Element.data));
+        CCArrayAppendElement(Array, &Element);
+    }
+    
+    XCTAssertTrue(CCArrayRadixSort(Array, offsetof(LargeElement, key), sizeof(int64_t), TRUE), @"Should sort the array");
+    for (size_t Loop = 1; Loop < 5000; Loop++)
+    {
+        const LargeElement *Previous = CCArrayGetElementAtIndex(Array, Loop - 1), *Element = CCArrayGetElementAtIndex(Array, Loop);
+        XCTAssertLessThanOrEqual(Previous->key, Element->key, @"Should be in ascending order");
+        if (Previous->key == Element->key) XCTAssertLessThan(Previous->order, Element->order, @"Should preserve the order of equal keys");
+        XCTAssertEqual(Element->data[12], (uint8_t)Element->order, @"Should move the entire element");
+    }
+    
+    CCArrayDestroy(Array);
+}
+
+-(void) testSearching
+{
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(int), 16);
+    
+    size_t InsertionIndex = 0;
+    XCTAssertEqual(CCArrayBinarySearch(Array, &(int){ 1 }, (CCComparator)IntComparator, &InsertionIndex), SIZE_MAX, @"Should not find the element");
+    XCTAssertEqual(InsertionIndex, 0, @"Should be inserted at the start");
+    
+    for (int Loop = 0; Loop < 1000; Loop++) CCArrayInsertSorted(Array, &(int){ (int)arc4random_uniform(500) * 2 }, (CCComparator)IntComparator);
+    
+    XCTAssertEqual(CCArrayGetCount(Array), 1000, @"Should insert every element");
+    for (size_t Loop = 1; Loop < 1000; Loop++) XCTAssertLessThanOrEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop - 1), *(int*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in ascending order");
+    
+    for (int Loop = -1; Loop <= 1000; Loop++)
+    {
+        const size_t Index = CCArrayBinarySearch(Array, &Loop, (CCComparator)IntComparator, &InsertionIndex);
+        
+        size_t Expected = 0;
+        while ((Expected < 1000) && (*(int*)CCArrayGetElementAtIndex(Array, Expected) < Loop)) Expected++;
+        
+        XCTAssertEqual(InsertionIndex, Expected, @"Should be the first position not less than the element");
+        
+        if ((Expected < 1000) && (*(int*)CCArrayGetElementAtIndex(Array, Expected) == Loop)) XCTAssertEqual(Index, Expected, @"Should find the first matching element");
+        else XCTAssertEqual(Index, SIZE_MAX, @"Should not find the element");
+    }
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(LargeElement), 16);
+    
+    for (uint32_t Loop = 0; Loop < 100; Loop++) CCArrayInsertSorted(Array, &(LargeElement){ .key = Loop % 10, .order = Loop }, (CCComparator)LargeElementComparator);
+    
+    for (size_t Loop = 1; Loop < 100; Loop++)
+    {
+        const LargeElement *Previous = CCArrayGetElementAtIndex(Array, Loop - 1), *Element = CCArrayGetElementAtIndex(Array, Loop);
+        XCTAssertLessThanOrEqual(Previous->key, Element->key, @"Should be in ascending order");
+        if (Previous->key == Element->key) XCTAssertLessThan(Previous->order, Element->order, @"Should insert after equal elements");
+    }
+    
+    CCArrayDestroy(Array);
+}
+
+-(void) testParallelSort
+{
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(int), 16);
+    
+    for (size_t Loop = 0; Loop < 300001; Loop++) CCArrayAppendElement(Array, &(int){ (int)arc4random() });
+    
+    XCTAssertTrue(CCArrayParallelSort(Array, (CCComparator)IntComparator, CCTaskQueueDefault()), @"Should sort the array");
+    XCTAssertEqual(CCArrayGetCount(Array), 300001, @"Should not change the count");
+    for (size_t Loop = 1; Loop < 300001; Loop++) XCTAssertLessThanOrEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop - 1), *(int*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in ascending order");
+    XCTAssertTrue(CCTaskQueueIsEmpty(CCTaskQueueDefault()), @"Should complete all the sorting tasks");
+    
+    for (size_t Loop = 0; Loop < 300001; Loop++) CCArrayReplaceElementAtIndex(Array, Loop, &(int){ (int)arc4random() });
+    
+    XCTAssertTrue(CCArrayParallelSort(Array, (CCComparator)IntComparator, NULL), @"Should sort the array");
+    for (size_t Loop = 1; Loop < 300001; Loop++) XCTAssertLessThanOrEqual(*(int*)CCArrayGetElementAtIndex(Array, Loop - 1), *(int*)CCArrayGetElementAtIndex(Array, Loop), @"Should be in ascending order");
+    
+    CCArrayDestroy(Array);
+    
+    
+    Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(LargeElement), 16);
+    
+    for (size_t Loop = 0; Loop < 200000; Loop++)
+    {
+        LargeElement Element = { .key = (int64_t)arc4random_uniform(1000) - 500, .order = (uint32_t)Loop };
+        memset(Element.data, (int)Loop, sizeof(Element.data));
+        CCArrayAppendElement(Array, &Element);
+    }
+    
+    XCTAssertTrue(CCArrayParallelStableSort(Array, (CCComparator)LargeElementComparator, CCTaskQueueDefault()), @"Should sort the array");
+    for (size_t Loop = 1; Loop < 200000; Loop++)
+    {
+        const LargeElement *Previous = CCArrayGetElementAtIndex(Array, Loop - 1), *Element = CCArrayGetElementAtIndex(Array, Loop);
+        XCTAssertLessThanOrEqual(Previous->key, Element->key, @"Should be in ascending order");
+        if (Previous->key == Element->key) XCTAssertLessThan(Previous->order, Element->order, @"Should preserve the order of equal elements");
+        XCTAssertEqual(Element->data[12], (uint8_t)Element->order, @"Should move the entire element");
+    }
+    
+    CCArrayRemoveAllElements(Array);
+    
+    for (size_t Loop = 0; Loop < 1000; Loop++) CCArrayAppendElement(Array, &(LargeElement){ .key = (int64_t)arc4random_uniform(10), .order = (uint32_t)Loop });
+    
+    XCTAssertTrue(CCArrayParallelStableSort(Array, (CCComparator)LargeElementComparator, NULL), @"Should sort the array");
+    for (size_t Loop = 1; Loop < 1000; Loop++)
+    {
+        const LargeElement *Previous = CCArrayGetElementAtIndex(Array, Loop - 1), *Element = CCArrayGetElementAtIndex(Array, Loop);
+        XCTAssertLessThanOrEqual(Previous->key, Element->key, @"Should be in ascending order");
+        if (Previous->key == Element->key) XCTAssertLessThan(Previous->order, Element->order, @"Should preserve the order of equal elements");
+    }
+    
+    CCArrayDestroy(Array);
+}
+
 @end
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "BitArray.h"
+
+@interface BitArrayTests : XCTestCase
+
+@end
+
+@implementation BitArrayTests
+
+-(void) assertBitArray: (CCBitArray)bits MatchesBools: (const _Bool*)bools
+{
+    size_t SetCount = 0;
+    for (size_t Loop = 0, Count = CCBitArrayGetCount(bits); Loop < Count; Loop++)
+    {
+        XCTAssertEqual(CCBitArrayGetBit(bits, Loop), bools[Loop], @"Should have the correct bit at index %zu", Loop);
+        SetCount += bools[Loop];
+    }
+    
+    XCTAssertEqual(CCBitArrayCountSet(bits), SetCount, @"Should have the correct number of set bits");
+}
+
+-(void) testSettingBits
+{
+    CCBitArray Bits = CCBitArrayCreate(CC_STD_ALLOCATOR, 130);
+    
+    XCTAssertEqual(CCBitArrayGetCount(Bits), 130, @"Should have the correct count");
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 0, @"Should start with all bits clear");
+    
+    CCBitArraySetBit(Bits, 0);
+    CCBitArraySetBit(Bits, 63);
+    CCBitArraySetBit(Bits, 64);
+    CCBitArraySetBit(Bits, 129);
+    
+    XCTAssertTrue(CCBitArrayGetBit(Bits, 0), @"Should be set");
+    XCTAssertFalse(CCBitArrayGetBit(Bits, 1), @"Should be clear");
+    XCTAssertTrue(CCBitArrayGetBit(Bits, 63), @"Should be set");
+    XCTAssertTrue(CCBitArrayGetBit(Bits, 64), @"Should be set");
+    XCTAssertTrue(CCBitArrayGetBit(Bits, 129), @"Should be set");
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 4, @"Should have the correct number of set bits");
+    
+    CCBitArrayClearBit(Bits, 63);
+    XCTAssertFalse(CCBitArrayGetBit(Bits, 63), @"Should be clear");
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 3, @"Should have the correct number of set bits");
+    
+    CCBitArraySetAll(Bits);
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 130, @"Should not set bits past the end");
+    
+    CCBitArrayClearAll(Bits);
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 0, @"Should clear all bits");
+    
+    CCBitArraySetBit(Bits, 100);
+    CCBitArray Copy = CCBitArrayCopy(CC_STD_ALLOCATOR, Bits);
+    CCBitArrayClearBit(Bits, 100);
+    
+    XCTAssertEqual(CCBitArrayGetCount(Copy), 130, @"Should copy the count");
+    XCTAssertTrue(CCBitArrayGetBit(Copy, 100), @"Should copy the bits");
+    XCTAssertEqual(CCBitArrayCountSet(Copy), 1, @"Should copy the bits");
+    
+    CCBitArrayDestroy(Copy);
+    CCBitArrayDestroy(Bits);
+}
+
+-(void) testResizing
+{
+    CCBitArray Bits = CCBitArrayCreate(CC_STD_ALLOCATOR, 10);
+    
+    CCBitArraySetAll(Bits);
+    XCTAssertTrue(CCBitArrayResize(Bits, 200), @"Should resize");
+    XCTAssertEqual(CCBitArrayGetCount(Bits), 200, @"Should have the correct count");
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 10, @"Should clear the new bits");
+    
+    CCBitArraySetBit(Bits, 199);
+    XCTAssertTrue(CCBitArrayResize(Bits, 5), @"Should resize");
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 5, @"Should drop the bits past the end");
+    
+    XCTAssertTrue(CCBitArrayResize(Bits, 64), @"Should resize");
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 5, @"Should not restore the dropped bits");
+    
+    XCTAssertTrue(CCBitArrayResize(Bits, 0), @"Should resize");
+    XCTAssertEqual(CCBitArrayCountSet(Bits), 0, @"Should be empty");
+    XCTAssertEqual(CCBitArrayFindNextSet(Bits, 0), SIZE_MAX, @"Should not find a set bit");
+    
+    CCBitArrayDestroy(Bits);
+}
+
+-(void) testOperations
+{
+    static const size_t Sizes[][2] = { { 1000, 1000 }, { 1000, 700 }, { 700, 1000 }, { 64, 63 }, { 513, 3 } };
+    
+    srand(8);
+    for (size_t Test = 0; Test < sizeof(Sizes) / sizeof(*Sizes); Test++)
+    {
+        const size_t Count = Sizes[Test][0], SourceCount = Sizes[Test][1];
+        _Bool Original[Count], Source[SourceCount], Expected[Count];
+        
+        CCBitArray Bits = CCBitArrayCreate(CC_STD_ALLOCATOR, Count), SourceBits = CCBitArrayCreate(CC_STD_ALLOCATOR, SourceCount);
+        
+        for (size_t Loop = 0; Loop < Count; Loop++) if ((Original[Loop] = rand() & 1)) CCBitArraySetBit(Bits, Loop);
+        for (size_t Loop = 0; Loop < SourceCount; Loop++) if ((Source[Loop] = rand() & 1)) CCBitArraySetBit(SourceBits, Loop);
+        
+        CCBitArray Result = CCBitArrayCopy(CC_STD_ALLOCATOR, Bits);
+        CCBitArrayAnd(Result, SourceBits);
+        for (size_t Loop = 0; Loop < Count; Loop++) Expected[Loop] = Original[Loop] && (Loop < SourceCount) && Source[Loop];
+        [self assertBitArray: Result MatchesBools: Expected];
+        CCBitArrayDestroy(Result);
+        
+        Result = CCBitArrayCopy(CC_STD_ALLOCATOR, Bits);
+        CCBitArrayOr(Result, SourceBits);
+        for (size_t Loop = 0; Loop < Count; Loop++) Expected[Loop] = Original[Loop] || ((Loop < SourceCount) && Source[Loop]);
+        [self assertBitArray: Result MatchesBools: Expected];
+        CCBitArrayDestroy(Result);
+        
+        Result = CCBitArrayCopy(CC_STD_ALLOCATOR, Bits);
+        CCBitArrayXor(Result, SourceBits);
+        for (size_t Loop = 0; Loop < Count; Loop++) Expected[Loop] = Original[Loop] != ((Loop < SourceCount) && Source[Loop]);
+        [self assertBitArray: Result MatchesBools: Expected];
+        CCBitArrayDestroy(Result);
+        
+        Result = CCBitArrayCopy(CC_STD_ALLOCATOR, Bits);
+        CCBitArrayAndNot(Result, SourceBits);
+        for (size_t Loop = 0; Loop < Count; Loop++) Expected[Loop] = Original[Loop] && !((Loop < SourceCount) && Source[Loop]);
+        [self assertBitArray: Result MatchesBools: Expected];
+        CCBitArrayDestroy(Result);
+        
+        CCBitArrayDestroy(SourceBits);
+        CCBitArrayDestroy(Bits);
+    }
+}
+
+-(void) testRankAndSelect
+{
+    const size_t Count = 1000;
+    _Bool Values[Count];
+    
+    CCBitArray Bits = CCBitArrayCreate(CC_STD_ALLOCATOR, Count);
+    
+    srand(3);
+    for (size_t Loop = 0; Loop < Count; Loop++) if ((Values[Loop] = !(rand() % 5))) CCBitArraySetBit(Bits, Loop);
+    
+    size_t Rank = 0, Next = SIZE_MAX;
+    for (size_t Loop = Count; Loop-- > 0; )
+    {
+        if (Values[Loop]) Next = Loop;
+        XCTAssertEqual(CCBitArrayFindNextSet(Bits, Loop), Next, @"Should find the next set bit from index %zu", Loop);
+    }
+    
+    XCTAssertEqual(CCBitArrayFindNextSet(Bits, Count), SIZE_MAX, @"Should not find a set bit past the end");
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        XCTAssertEqual(CCBitArrayRank(Bits, Loop), Rank, @"Should have the correct rank at index %zu", Loop);
+        
+        if (Values[Loop])
+        {
+            XCTAssertEqual(CCBitArraySelect(Bits, Rank), Loop, @"Should select the correct index for rank %zu", Rank);
+            Rank++;
+        }
+    }
+    
+    XCTAssertEqual(CCBitArrayRank(Bits, Count), Rank, @"Should have the correct rank at the end");
+    XCTAssertEqual(CCBitArraySelect(Bits, Rank), SIZE_MAX, @"Should not select past the last set bit");
+    
+    CCBitArrayDestroy(Bits);
+}
+
+@end
@@ -0,0 +1,130 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Cocoa/Cocoa.h>
+#import <XCTest/XCTest.h>
+#import "CollectionBTree.h"
+#import "OrderedCollectionTests.h"
+#import "OrderedCollection.h"
+#import "CollectionEnumerator.h"
+#import "Array.h"
+
+@interface CollectionBTreeTests : OrderedCollectionTests
+
+@end
+
+@implementation CollectionBTreeTests
+
+-(void) setUp
+{
+    [super setUp];
+    self.interface = CCCollectionBTree;
+}
+
+-(void) testSelection
+{
+    CCOrderedCollection Collection = CCCollectionCreate(CC_STD_ALLOCATOR, CCOrderedCollectionHintHeavyInserting, sizeof(int), NULL);
+    
+    XCTAssertEqual(CCCollectionGetInterface(Collection), CCCollectionBTree, @"Should select the B-tree for heavy ordered inserting");
+    
+    CCCollectionDestroy(Collection);
+}
+
+-(void) testLargeMutations
+{
+    CCOrderedCollection Collection = CCCollectionCreateWithImplementation(CC_STD_ALLOCATOR, CCCollectionHintOrdered, sizeof(int), NULL, self.interface);
+    CCArray Expected = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(int), 64);
+    
+    CCCollectionEntry First = CCOrderedCollectionAppendElement(Collection, &(int){ -1 });
+    CCArrayAppendElement(Expected, &(int){ -1 });
+    
+    for (int Loop = 0; Loop < 20000; Loop++)
+    {
+        const size_t Index = arc4random_uniform((uint32_t)CCArrayGetCount(Expected) + 1);
+        
+        CCOrderedCollectionInsertElementAtIndex(Collection, &Loop, Index);
+        if (Index == CCArrayGetCount(Expected)) CCArrayAppendElement(Expected, &Loop);
+        else CCArrayInsertElementAtIndex(Expected, Index, &Loop);
+        
+        if ((Loop % 3) == 0)
+        {
+            const size_t RemoveIndex = arc4random_uniform((uint32_t)CCArrayGetCount(Expected));
+            if (*(int*)CCArrayGetElementAtIndex(Expected, RemoveIndex) != -1)
+            {
+                CCOrderedCollectionRemoveElementAtIndex(Collection, RemoveIndex);
+                CCArrayRemoveElementAtIndex(Expected, RemoveIndex);
+            }
+        }
+    }
+    
+    XCTAssertEqual(CCCollectionGetCount(Collection), CCArrayGetCount(Expected), @"Should contain the same number of elements");
+    
+    size_t FirstIndex = SIZE_MAX;
+    for (size_t Loop = 0, Count = CCArrayGetCount(Expected); Loop < Count; Loop++)
+    {
+        const int Element = *(int*)CCArrayGetElementAtIndex(Expected, Loop);
+        
+        if (Element == -1) FirstIndex = Loop;
+        
+        XCTAssertEqual(*(int*)CCOrderedCollectionGetElementAtIndex(Collection, Loop), Element, @"Should contain the correct element");
+        XCTAssertEqual(CCOrderedCollectionGetIndex(Collection, CCOrderedCollectionGetEntryAtIndex(Collection, Loop)), Loop, @"Should return the correct index");
+    }
+    
+    XCTAssertEqual(CCOrderedCollectionGetIndex(Collection, First), FirstIndex, @"Entries should remain valid after mutations");
+    
+    CCEnumerator Enumerator;
+    CCCollectionGetEnumerator(Collection, &Enumerator);
+    
+    size_t Index = 0;
+    for (int *Element = CCCollectionEnumeratorGetCurrent(&Enumerator); Element; Element = CCCollectionEnumeratorNext(&Enumerator), Index++)
+    {
+        XCTAssertEqual(*Element, *(int*)CCArrayGetElementAtIndex(Expected, Index), @"Should enumerate in order");
+    }
+    
+    XCTAssertEqual(Index, CCArrayGetCount(Expected), @"Should enumerate all elements");
+    
+    Index = CCArrayGetCount(Expected);
+    for (int *Element = CCCollectionEnumeratorGetTail(&Enumerator); Element; Element = CCCollectionEnumeratorPrevious(&Enumerator))
+    {
+        XCTAssertEqual(*Element, *(int*)CCArrayGetElementAtIndex(Expected, --Index), @"Should enumerate in reverse order");
+    }
+    
+    XCTAssertEqual(Index, 0, @"Should enumerate all elements");
+    
+    while (CCCollectionGetCount(Collection)) CCOrderedCollectionRemoveElementAtIndex(Collection, CCCollectionGetCount(Collection) / 2);
+    
+    XCTAssertEqual(CCOrderedCollectionGetLastEntry(Collection), NULL, @"Should be empty");
+    
+    CCOrderedCollectionPrependElement(Collection, &(int){ 2 });
+    CCOrderedCollectionPrependElement(Collection, &(int){ 1 });
+    
+    XCTAssertEqual(*(int*)CCOrderedCollectionGetElementAtIndex(Collection, 0), 1, @"Should return the valid element");
+    XCTAssertEqual(*(int*)CCOrderedCollectionGetLastElement(Collection), 2, @"Should return the valid element");
+    
+    CCArrayDestroy(Expected);
+    CCCollectionDestroy(Collection);
+}
+
+@end
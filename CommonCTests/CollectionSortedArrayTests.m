@@ -0,0 +1,111 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "CollectionSortedArray.h"
+#import "Collection.h"
+#import "CollectionEnumerator.h"
+#import "CollectionTests.h"
+
+@interface CollectionSortedArrayTests : CollectionTests
+
+@end
+
+@implementation CollectionSortedArrayTests
+
+-(void) setUp
+{
+    [super setUp];
+    self.interface = CCCollectionSortedArray;
+}
+
+-(void) testCollectionFinding {}
+
+-(void) testCollectionRemoval {}
+
+-(void) testRemoval {}
+
+static CCComparisonResult IntComparator(const int *Left, const int *Right)
+{
+    return *Left < *Right ? CCComparisonResultAscending : (*Left > *Right ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+static CCComparisonResult IntEqualComparator(const int *Left, const int *Right)
+{
+    return *Left == *Right ? CCComparisonResultEqual : CCComparisonResultInvalid;
+}
+
+-(void) testSortedOrder
+{
+    CCCollection Collection = CCCollectionCreateWithImplementation(CC_STD_ALLOCATOR, 0, sizeof(int), NULL, self.interface);
+    
+    for (int Loop = 0; Loop < 500; Loop++) CCCollectionInsertElement(Collection, &(int){ (int)arc4random_uniform(1000) - 500 });
+    CCCollectionInsertElement(Collection, &(int){ 1000 });
+    
+    CCCollectionSortedArraySetComparator(Collection, (CCComparator)IntComparator);
+    
+    CCEnumerator Enumerator;
+    CCCollectionGetEnumerator(Collection, &Enumerator);
+    
+    size_t Count = 0;
+    int Previous = INT_MIN;
+    for (int *Element = CCCollectionEnumeratorGetCurrent(&Enumerator); Element; Element = CCCollectionEnumeratorNext(&Enumerator), Count++)
+    {
+        XCTAssertLessThanOrEqual(Previous, *Element, @"Should be sorted by the comparator");
+        Previous = *Element;
+    }
+    
+    XCTAssertEqual(Count, 501, @"Should contain all the elements");
+    
+    for (int Loop = 0; Loop < 500; Loop++) CCCollectionInsertElement(Collection, &(int){ (int)arc4random_uniform(1000) - 500 });
+    
+    CCCollectionGetEnumerator(Collection, &Enumerator);
+    
+    Count = 0;
+    Previous = INT_MIN;
+    for (int *Element = CCCollectionEnumeratorGetCurrent(&Enumerator); Element; Element = CCCollectionEnumeratorNext(&Enumerator), Count++)
+    {
+        XCTAssertLessThanOrEqual(Previous, *Element, @"Should insert elements in sorted order");
+        Previous = *Element;
+    }
+    
+    XCTAssertEqual(Count, 1001, @"Should contain all the elements");
+    
+    CCCollectionEntry Entry = CCCollectionFindElement(Collection, &(int){ 1000 }, (CCComparator)IntComparator);
+    XCTAssertEqual(*(int*)CCCollectionGetElement(Collection, Entry), 1000, @"Should find the element with the sorted comparator");
+    
+    Entry = CCCollectionFindElement(Collection, &(int){ 1000 }, (CCComparator)IntEqualComparator);
+    XCTAssertEqual(*(int*)CCCollectionGetElement(Collection, Entry), 1000, @"Should find the element with an equality comparator");
+    
+    Entry = CCCollectionFindElement(Collection, &(int){ 1000 }, NULL);
+    XCTAssertEqual(*(int*)CCCollectionGetElement(Collection, Entry), 1000, @"Should find the element with a memcmp");
+    
+    XCTAssertEqual(CCCollectionFindElement(Collection, &(int){ 1001 }, (CCComparator)IntComparator), NULL, @"Should not find the element");
+    XCTAssertEqual(CCCollectionFindElement(Collection, &(int){ 1001 }, (CCComparator)IntEqualComparator), NULL, @"Should not find the element");
+    
+    CCCollectionDestroy(Collection);
+}
+
+@end
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "ConcurrentPriorityQueue.h"
+#import <stdatomic.h>
+#import <pthread.h>
+
+@interface ConcurrentPriorityQueueTests : XCTestCase
+
+@end
+
+@implementation ConcurrentPriorityQueueTests
+
+static CCComparisonResult IntComparator(const int *Left, const int *Right)
+{
+    return *Left < *Right ? CCComparisonResultAscending : (*Left > *Right ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+-(void) testEmptyPops
+{
+    CCConcurrentPriorityQueue Queue = CCConcurrentPriorityQueueCreate(CC_STD_ALLOCATOR, sizeof(int), 4, (CCComparator)IntComparator, 8);
+    
+    XCTAssertFalse(CCConcurrentPriorityQueuePop(Queue, NULL), @"Should return false when nothing left to pop");
+    XCTAssertFalse(CCConcurrentPriorityQueuePop(Queue, NULL), @"Should return false when nothing left to pop");
+    XCTAssertEqual(CCConcurrentPriorityQueueGetCount(Queue), 0, @"Should be empty");
+    
+    CCConcurrentPriorityQueueDestroy(Queue);
+}
+
+-(void) testOrdering
+{
+    //A single internal queue is strictly ordered
+    CCConcurrentPriorityQueue Queue = CCConcurrentPriorityQueueCreate(CC_STD_ALLOCATOR, sizeof(int), 4, (CCComparator)IntComparator, 1);
+    
+    srand(2);
+    for (int Loop = 0; Loop < 1000; Loop++) XCTAssertTrue(CCConcurrentPriorityQueuePush(Queue, &(int){ rand() }), @"Should push the element");
+    
+    XCTAssertEqual(CCConcurrentPriorityQueueGetCount(Queue), 1000, @"Should contain all the elements");
+    
+    int Previous = INT_MIN, Value;
+    for (int Loop = 0; Loop < 1000; Loop++)
+    {
+        XCTAssertTrue(CCConcurrentPriorityQueuePop(Queue, &Value), @"Should pop an element");
+        XCTAssertLessThanOrEqual(Previous, Value, @"Should pop the elements in order");
+        Previous = Value;
+    }
+    
+    XCTAssertFalse(CCConcurrentPriorityQueuePop(Queue, &Value), @"Should return false when nothing left to pop");
+    
+    CCConcurrentPriorityQueueDestroy(Queue);
+    
+    
+    //Multiple internal queues are loosely ordered, but every element is popped
+    Queue = CCConcurrentPriorityQueueCreate(CC_STD_ALLOCATOR, sizeof(int), 4, (CCComparator)IntComparator, 8);
+    
+    for (int Loop = 0; Loop < 1000; Loop++) XCTAssertTrue(CCConcurrentPriorityQueuePush(Queue, &(int){ Loop }), @"Should push the element");
+    
+    _Bool Popped[1000] = { FALSE };
+    int FirstHalf = 0;
+    for (int Loop = 0; Loop < 1000; Loop++)
+    {
+        XCTAssertTrue(CCConcurrentPriorityQueuePop(Queue, &Value), @"Should pop an element");
+        XCTAssertFalse(Popped[Value], @"Should not pop an element more than once");
+        Popped[Value] = TRUE;
+        
+        if ((Loop < 500) && (Value < 500)) FirstHalf++;
+    }
+    
+    XCTAssertGreaterThan(FirstHalf, 400, @"Should pop mostly higher priority elements first");
+    XCTAssertFalse(CCConcurrentPriorityQueuePop(Queue, &Value), @"Should return false when nothing left to pop");
+    
+    CCConcurrentPriorityQueueDestroy(Queue);
+}
+
+#define PUSH_THREADS 8
+#define POP_THREADS 6
+
+#define ELEMENT_COUNT 100000
+
+static CCConcurrentPriorityQueue Q;
+static void *Pusher(void *Arg)
+{
+    for (int Loop = 0; Loop < ELEMENT_COUNT; Loop++)
+    {
+        CCConcurrentPriorityQueuePush(Q, &(int){ *(int*)Arg + Loop });
+    }
+    
+    return NULL;
+}
+
+static _Atomic(int) Count = ATOMIC_VAR_INIT(0);
+static void *Popper(void *Arg)
+{
+    uintptr_t Sum = 0;
+    for ( ; atomic_load_explicit(&Count, memory_order_relaxed) < (ELEMENT_COUNT * PUSH_THREADS); )
+    {
+        int Value;
+        if (CCConcurrentPriorityQueuePop(Q, &Value))
+        {
+            atomic_fetch_add_explicit(&Count, 1, memory_order_relaxed);
+            Sum += Value;
+        }
+    }
+    
+    return (void*)Sum;
+}
+
+-(void) testMultiThreading
+{
+    atomic_store(&Count, 0);
+    Q = CCConcurrentPriorityQueueCreate(CC_STD_ALLOCATOR, sizeof(int), 4, (CCComparator)IntComparator, (PUSH_THREADS + POP_THREADS) * 2);
+    
+    pthread_t Push[PUSH_THREADS], Pop[POP_THREADS];
+    int PushArgs[PUSH_THREADS];
+    
+    for (int Loop = 0; Loop < PUSH_THREADS; Loop++)
+    {
+        PushArgs[Loop] = Loop * 100;
+        pthread_create(Push + Loop, NULL, Pusher, PushArgs + Loop);
+    }
+    
+    for (int Loop = 0; Loop < POP_THREADS; Loop++)
+    {
+        pthread_create(Pop + Loop, NULL, Popper, NULL);
+    }
+    
+    for (int Loop = 0; Loop < PUSH_THREADS; Loop++)
+    {
+        pthread_join(Push[Loop], NULL);
+    }
+    
+    uintptr_t Sum = 0;
+    for (int Loop = 0; Loop < POP_THREADS; Loop++)
+    {
+        uintptr_t Result = 0;
+        pthread_join(Pop[Loop], (void**)&Result);
+        Sum += Result;
+    }
+    
+    uintptr_t Actual = 0;
+    for (int Loop = 0; Loop < PUSH_THREADS; Loop++)
+    {
+        for (int Loop2 = 0; Loop2 < ELEMENT_COUNT; Loop2++)
+        {
+            Actual += PushArgs[Loop] + Loop2;
+        }
+    }
+    
+    XCTAssertEqual(Sum, Actual, @"Should calculate the correct result");
+    XCTAssertEqual(CCConcurrentPriorityQueueGetCount(Q), 0, @"Should pop all the elements");
+    
+    CCConcurrentPriorityQueueDestroy(Q);
+}
+
+@end
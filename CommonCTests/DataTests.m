@@ -26,6 +26,7 @@
 #import "DataTests.h"
 #import "MemoryAllocation.h"
 #import "Data.h"
+#import "Hash.h"
 
 
 static void *TestConstructorCallback(CCAllocatorType Allocator, CCDataHint Hint, size_t *Data)
@@ -179,6 +180,34 @@ static CCDataInterface TestDataInternalSmallBlock = {
     CCDataDestroy(Data);
 }
 
+-(void) testHashModifiedRange
+{
+    const size_t Size = 200000;
+    CCData Data = [self createDataOfSize: Size WithHint: CCDataHintReadWrite];
+    
+    for (size_t Loop = 0; Loop < Size; Loop += sizeof(uint32_t)) CCDataWriteBuffer(Data, Loop, sizeof(uint32_t), &(uint32_t){ (uint32_t)Loop * 2654435761u });
+    
+    uint32_t Hash = CCDataGetHash(Data);
+    XCTAssertEqual(Hash, CCHashMurmur32(Data), @"Should have the correct hash");
+    
+    const size_t Offsets[] = { Size - 1, 150000, 70000, 10, 0 };
+    for (size_t Loop = 0; Loop < sizeof(Offsets) / sizeof(*Offsets); Loop++)
+    {
+        CCDataWriteBuffer(Data, Offsets[Loop], sizeof(uint8_t), &(uint8_t){ 0xff });
+        
+        uint8_t Buffer[4];
+        CCDataReadBuffer(Data, 0, sizeof(Buffer), Buffer);
+        
+        const uint32_t NewHash = CCDataGetHash(Data);
+        XCTAssertNotEqual(NewHash, Hash, @"Should update the hash after modifying offset (%zu)", Offsets[Loop]);
+        XCTAssertEqual(NewHash, CCHashMurmur32(Data), @"Should have the correct hash after modifying offset (%zu)", Offsets[Loop]);
+        
+        Hash = NewHash;
+    }
+    
+    CCDataDestroy(Data);
+}
+
 @end
 
 
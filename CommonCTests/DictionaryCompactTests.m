@@ -0,0 +1,126 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Cocoa/Cocoa.h>
+#import <XCTest/XCTest.h>
+#import "DictionaryCompact.h"
+#import "DictionaryTests.h"
+
+@interface DictionaryCompactTests : DictionaryTests
+
+@end
+
+@implementation DictionaryCompactTests
+
+-(void) setUp
+{
+    [super setUp];
+    self.interface = CCDictionaryCompact;
+}
+
+-(void) testSelection
+{
+    CCDictionary Dict = CCDictionaryCreate(CC_STD_ALLOCATOR, CCDictionaryHintSizeSmall | CCDictionaryHintHeavyFinding, sizeof(int), sizeof(int), NULL);
+    XCTAssertEqual(Dict->interface, CCDictionaryCompact, @"Should use the compact implementation for small dictionaries");
+    CCDictionaryDestroy(Dict);
+    
+    Dict = CCDictionaryCreate(CC_STD_ALLOCATOR, CCDictionaryHintSizeMedium | CCDictionaryHintHeavyFinding, sizeof(int), sizeof(int), NULL);
+    XCTAssertNotEqual(Dict->interface, CCDictionaryCompact, @"Should not use the compact implementation for larger dictionaries");
+    CCDictionaryDestroy(Dict);
+}
+
+-(void) testUpgrade
+{
+    CCDictionary Dict = CCDictionaryCreate(CC_STD_ALLOCATOR, CCDictionaryHintSizeSmall, sizeof(int), sizeof(int), NULL);
+    
+    for (int Loop = 0; Loop < CC_DICTIONARY_COMPACT_MAX_COUNT; Loop++) CCDictionarySetValue(Dict, &Loop, &(int){ Loop * 2 });
+    XCTAssertEqual(Dict->interface, CCDictionaryCompact, @"Should use the compact implementation until the threshold is reached");
+    
+    CCDictionaryEntryForKey(Dict, &(int){ -1 });
+    XCTAssertNotEqual(Dict->interface, CCDictionaryCompact, @"Should upgrade once the threshold is reached");
+    
+    for (int Loop = CC_DICTIONARY_COMPACT_MAX_COUNT; Loop < 1000; Loop++) CCDictionarySetValue(Dict, &Loop, &(int){ Loop * 2 });
+    
+    XCTAssertEqual(CCDictionaryGetCount(Dict), 1001, @"Should contain all the entries");
+    XCTAssertFalse(CCDictionaryEntryIsInitialized(Dict, CCDictionaryFindKey(Dict, &(int){ -1 })), @"Should retain uninitialized entries");
+    
+    for (int Loop = 0; Loop < 1000; Loop++)
+    {
+        int *Value = CCDictionaryGetValue(Dict, &Loop);
+        XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+    }
+    
+    CCDictionaryDestroy(Dict);
+}
+
+-(void) assertKeysOfSize: (size_t)size
+{
+    CCDictionary Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintSizeSmall, size, sizeof(int), NULL, self.interface);
+    
+    uint8_t Key[16] = { 0 };
+    for (int Loop = 0; Loop < CC_DICTIONARY_COMPACT_MAX_COUNT; Loop++)
+    {
+        //Differ only in the last byte so partial key matches are caught
+        Key[size - 1] = Loop + 1;
+        CCDictionarySetValue(Dict, Key, &Loop);
+    }
+    
+    for (int Loop = 0; Loop < CC_DICTIONARY_COMPACT_MAX_COUNT; Loop += 3)
+    {
+        Key[size - 1] = Loop + 1;
+        CCDictionaryRemoveValue(Dict, Key);
+    }
+    
+    Key[size - 1] = 0;
+    XCTAssertEqual(CCDictionaryGetValue(Dict, Key), NULL, @"Should not retrieve a value for a missing key");
+    
+    for (int Loop = 0; Loop < CC_DICTIONARY_COMPACT_MAX_COUNT; Loop++)
+    {
+        Key[size - 1] = Loop + 1;
+        
+        int *Value = CCDictionaryGetValue(Dict, Key);
+        if (Loop % 3) XCTAssertTrue((Value) && (*Value == Loop), @"Should retrieve the value");
+        else XCTAssertEqual(Value, NULL, @"Should not retrieve a removed value");
+    }
+    
+    //Removed entries should be reused
+    Key[size - 1] = 0xff;
+    CCDictionarySetValue(Dict, Key, &(int){ -1 });
+    XCTAssertEqual(CCDictionaryFindKey(Dict, Key), 1, @"Should reuse the first removed entry");
+    XCTAssertEqual(*(int*)CCDictionaryGetValue(Dict, Key), -1, @"Should retrieve the value");
+    XCTAssertEqual(Dict->interface, CCDictionaryCompact, @"Should not upgrade while below the threshold");
+    
+    CCDictionaryDestroy(Dict);
+}
+
+-(void) testKeySizes
+{
+    [self assertKeysOfSize: sizeof(uint32_t)];
+    [self assertKeysOfSize: sizeof(uint64_t)];
+    [self assertKeysOfSize: 3];
+    [self assertKeysOfSize: 16];
+}
+
+@end
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Cocoa/Cocoa.h>
+#import <XCTest/XCTest.h>
+#import "DictionaryPerfectHash.h"
+#import "DictionaryHashMap.h"
+#import "DictionaryTests.h"
+
+@interface DictionaryPerfectHashTests : DictionaryTests
+
+@end
+
+@implementation DictionaryPerfectHashTests
+
+-(void) setUp
+{
+    [super setUp];
+    self.interface = CCDictionaryPerfectHash;
+}
+
+-(void) testFreeze
+{
+    CCDictionary Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintSizeMedium, sizeof(int), sizeof(int), NULL, CCDictionaryHashMap);
+    
+    for (int Loop = 0; Loop < 10000; Loop++) CCDictionarySetValue(Dict, &Loop, &(int){ Loop * 2 });
+    CCDictionaryEntryForKey(Dict, &(int){ -1 });
+    
+    CCDictionaryFreeze(Dict);
+    
+    XCTAssertEqual(Dict->interface, CCDictionaryPerfectHash, @"Should use the perfect hash implementation");
+    XCTAssertEqual(CCDictionaryGetCount(Dict), 10001, @"Should contain all the entries");
+    XCTAssertFalse(CCDictionaryEntryIsInitialized(Dict, CCDictionaryFindKey(Dict, &(int){ -1 })), @"Should retain uninitialized entries");
+    
+    for (int Loop = 0; Loop < 10000; Loop++)
+    {
+        int *Value = CCDictionaryGetValue(Dict, &Loop);
+        XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+    }
+    
+    XCTAssertEqual(CCDictionaryGetValue(Dict, &(int){ 10000 }), NULL, @"Should not retrieve a value for a missing key");
+    
+    for (int Loop = 0; Loop < 10000; Loop += 2) CCDictionaryRemoveValue(Dict, &Loop);
+    for (int Loop = 10000; Loop < 30000; Loop++) CCDictionarySetValue(Dict, &Loop, &(int){ Loop * 2 });
+    
+    XCTAssertEqual(CCDictionaryGetCount(Dict), 25001, @"Should contain all the entries");
+    
+    CCDictionaryFreeze(Dict);
+    
+    XCTAssertEqual(CCDictionaryGetCount(Dict), 25001, @"Should contain all the entries");
+    
+    for (int Loop = 0; Loop < 30000; Loop++)
+    {
+        int *Value = CCDictionaryGetValue(Dict, &Loop);
+        if ((Loop >= 10000) || (Loop % 2)) XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+        else XCTAssertEqual(Value, NULL, @"Should not retrieve a removed value");
+    }
+    
+    CCDictionaryDestroy(Dict);
+}
+
+-(void) testIdenticalHashes
+{
+    CCDictionary Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintSizeMedium, sizeof(uint64_t) * 2, sizeof(int), NULL, self.interface);
+    
+    //The default hash only covers the start of the key, so these will all share the same hash
+    for (int Loop = 0; Loop < 100; Loop++) CCDictionarySetValue(Dict, &(uint64_t[2]){ 1, Loop }, &Loop);
+    
+    CCDictionaryFreeze(Dict);
+    
+    XCTAssertEqual(CCDictionaryGetCount(Dict), 100, @"Should contain all the entries");
+    
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        int *Value = CCDictionaryGetValue(Dict, &(uint64_t[2]){ 1, Loop });
+        XCTAssertTrue((Value) && (*Value == Loop), @"Should retrieve the value");
+    }
+    
+    CCDictionaryDestroy(Dict);
+}
+
+@end
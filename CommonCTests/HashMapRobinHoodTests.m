@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Cocoa/Cocoa.h>
+#import <XCTest/XCTest.h>
+#import "HashMapRobinHood.h"
+#import "HashMapTests.h"
+
+@interface HashMapRobinHoodTests : HashMapTests
+
+@end
+
+@implementation HashMapRobinHoodTests
+
+-(void) setUp
+{
+    [super setUp];
+    self.interface = CCHashMapRobinHood;
+}
+
+-(void) testChurn
+{
+    CCHashMap Map = CCHashMapCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 1, NULL, NULL, self.interface);
+    
+    for (int Loop = 0; Loop < 1000; Loop++) CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 1000, @"Should contain all the entries");
+    XCTAssertGreaterThan(CCHashMapGetBucketCount(Map), 1000, @"Should have grown");
+    
+    //slide the window of keys so removals are never the most recent entry
+    for (int Loop = 1000; Loop < 100000; Loop++)
+    {
+        CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+        CCHashMapRemoveValue(Map, &(int){ Loop - 1000 });
+    }
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 1000, @"Should contain all the remaining entries");
+    XCTAssertLessThan(CCHashMapGetBucketCount(Map), 4096, @"Should not grow from removed entries");
+    
+    for (int Loop = 0; Loop < 100000; Loop++)
+    {
+        int *Value = CCHashMapGetValue(Map, &Loop);
+        if (Loop >= 99000) XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+        else XCTAssertEqual(Value, NULL, @"Should not retrieve a removed value");
+    }
+    
+    CCHashMapDestroy(Map);
+}
+
+-(void) testStableEntries
+{
+    CCHashMap Map = CCHashMapCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 128, NULL, NULL, self.interface);
+    
+    CCHashMapEntry Entries[100];
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        Entries[Loop] = CCHashMapEntryForKey(Map, &Loop, NULL);
+        CCHashMapSetEntry(Map, Entries[Loop], &(int){ Loop * 2 });
+    }
+    
+    for (int Loop = 0; Loop < 100; Loop += 2) CCHashMapRemoveEntry(Map, Entries[Loop]);
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 50, @"Should contain all the remaining entries");
+    
+    for (int Loop = 1; Loop < 100; Loop += 2)
+    {
+        XCTAssertEqual(*(int*)CCHashMapGetKey(Map, Entries[Loop]), Loop, @"Should retain the entry after other removals");
+        XCTAssertEqual(*(int*)CCHashMapGetEntry(Map, Entries[Loop]), Loop * 2, @"Should retain the entry after other removals");
+        XCTAssertEqual(CCHashMapFindKey(Map, &Loop), Entries[Loop], @"Should find the same entry");
+    }
+    
+    for (int Loop = 0; Loop < 100; Loop += 2) XCTAssertEqual(CCHashMapFindKey(Map, &Loop), 0, @"Should not find a removed entry");
+    
+    CCHashMapDestroy(Map);
+}
+
+@end
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Cocoa/Cocoa.h>
+#import <XCTest/XCTest.h>
+#import "HashMapSwissTable.h"
+#import "HashMapTests.h"
+
+@interface HashMapSwissTableTests : HashMapTests
+
+@end
+
+@implementation HashMapSwissTableTests
+
+-(void) setUp
+{
+    [super setUp];
+    self.interface = CCHashMapSwissTable;
+}
+
+-(void) testGrowth
+{
+    CCHashMap Map = CCHashMapCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 1, NULL, NULL, self.interface);
+    
+    for (int Loop = 0; Loop < 1000; Loop++) CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 1000, @"Should contain all the entries");
+    XCTAssertGreaterThan(CCHashMapGetBucketCount(Map), 1000, @"Should have grown");
+    
+    for (int Loop = 0; Loop < 1000; Loop += 2) CCHashMapRemoveValue(Map, &Loop);
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 500, @"Should contain all the remaining entries");
+    
+    for (int Loop = 0; Loop < 1000; Loop++)
+    {
+        int *Value = CCHashMapGetValue(Map, &Loop);
+        if (Loop % 2) XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+        else XCTAssertEqual(Value, NULL, @"Should not retrieve a removed value");
+    }
+    
+    //churn through the tombstones
+    for (int Loop = 1000; Loop < 100000; Loop++)
+    {
+        CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+        CCHashMapRemoveValue(Map, &Loop);
+    }
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 500, @"Should contain all the remaining entries");
+    XCTAssertLessThan(CCHashMapGetBucketCount(Map), 4096, @"Should not grow from removed entries");
+    
+    for (int Loop = 1; Loop < 1000; Loop += 2)
+    {
+        int *Value = CCHashMapGetValue(Map, &Loop);
+        XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+    }
+    
+    CCHashMapDestroy(Map);
+}
+
+@end
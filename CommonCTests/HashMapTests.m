@@ -28,6 +28,7 @@
 #import "CCString.h"
 #import "CollectionEnumerator.h"
 #import "HashMapEnumerator.h"
+#import "TaskQueue.h"
 
 
 static uintmax_t StringHasher(CCString *Key)
@@ -613,4 +614,233 @@ static CCComparisonResult StringComparator(CCString *left, CCString *right)
     CCHashMapDestroy(Map);
 }
 
+
+-(void) testIncrementalRehash
+{
+    if (!self.interface) return;
+    
+    CCHashMap Map = CCHashMapCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 50, NULL, NULL, self.interface);
+    
+    for (int Loop = 0; Loop < 500; Loop++) CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+    
+    CCHashMapRehash(Map, 101);
+    
+    for (int Loop = 0; Loop < 500; Loop += 10) CCHashMapRemoveValue(Map, &Loop);
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 450, @"Should contain all the remaining entries");
+    
+    for (int Loop = 500; Loop < 510; Loop++) CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 460, @"Should contain all the remaining entries");
+    
+    for (int Loop = 0; Loop < 510; Loop++)
+    {
+        int *Value = CCHashMapGetValue(Map, &Loop);
+        if ((Loop >= 500) || (Loop % 10)) XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+        else XCTAssertEqual(Value, NULL, @"Should not retrieve a removed value");
+    }
+    
+    CCHashMapRehash(Map, 200);
+    
+    for (int Loop = 0; Loop < 500; Loop += 10) CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+    for (int Loop = 510; Loop < 600; Loop++) XCTAssertNotEqual(CCHashMapEntryForKey(Map, &Loop, NULL), 0, @"Should create an entry");
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 600, @"Should contain all the entries");
+    
+    for (int Loop = 0; Loop < 510; Loop++)
+    {
+        int *Value = CCHashMapGetValue(Map, &Loop);
+        XCTAssertTrue((Value) && (*Value == Loop * 2), @"Should retrieve the value");
+    }
+    
+    CCOrderedCollection Keys = CCHashMapGetKeys(Map);
+    XCTAssertEqual(CCCollectionGetCount(Keys), 600, @"Should enumerate over every key");
+    CCCollectionDestroy(Keys);
+    
+    CCHashMapDestroy(Map);
+}
+
+
+-(void) testFindKeyWithHash
+{
+    if (!self.interface) return;
+    
+    CCHashMap Map = CCHashMapCreate(CC_STD_ALLOCATOR, sizeof(CCString), sizeof(int), 8, (CCHashMapKeyHasher)StringHasher, (CCComparator)StringComparator, self.interface);
+    
+    CCString Keys[] = { CC_STRING("a"), CC_STRING("b"), CC_STRING("c"), CC_STRING("d") };
+    for (int Loop = 0; Loop < 3; Loop++) CCHashMapSetValue(Map, &Keys[Loop], &Loop);
+    
+    for (int Loop = 0; Loop < 3; Loop++)
+    {
+        const uintmax_t Hash = CCHashMapGetKeyHash(Map, &Keys[Loop]);
+        XCTAssertEqual(CCHashMapFindKeyWithHash(Map, &Keys[Loop], Hash), CCHashMapFindKey(Map, &Keys[Loop]), @"Should find the same entry");
+        
+        int *Value = CCHashMapGetValueWithHash(Map, &Keys[Loop], Hash);
+        XCTAssertTrue((Value) && (*Value == Loop), @"Should retrieve the value");
+    }
+    
+    XCTAssertEqual(CCHashMapFindKeyWithHash(Map, &Keys[3], CCHashMapGetKeyHash(Map, &Keys[3])), 0, @"Should not find a missing key");
+    XCTAssertEqual(CCHashMapGetValueWithHash(Map, &Keys[3], CCHashMapGetKeyHash(Map, &Keys[3])), NULL, @"Should not retrieve a missing value");
+    
+    CCHashMapDestroy(Map);
+}
+
+-(void) testFindKeys
+{
+    if (!self.interface) return;
+    
+    CCHashMap Map = CCHashMapCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 16, NULL, NULL, self.interface);
+    
+    for (int Loop = 0; Loop < 200; Loop += 2) CCHashMapSetValue(Map, &Loop, &(int){ Loop * 2 });
+    
+    int Keys[100];
+    uintmax_t Hashes[100];
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        Keys[Loop] = Loop * 3;
+        Hashes[Loop] = CCHashMapGetKeyHash(Map, &Keys[Loop]);
+    }
+    
+    CCHashMapEntry Entries[100], EntriesWithHash[100];
+    CCHashMapFindKeys(Map, Keys, NULL, 100, Entries);
+    CCHashMapFindKeys(Map, Keys, Hashes, 100, EntriesWithHash);
+    
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        XCTAssertEqual(Entries[Loop], CCHashMapFindKey(Map, &Keys[Loop]), @"Should find the same entry");
+        XCTAssertEqual(EntriesWithHash[Loop], Entries[Loop], @"Should find the same entry");
+        
+        if ((Keys[Loop] < 200) && !(Keys[Loop] % 2))
+        {
+            int *Value = CCHashMapGetEntry(Map, Entries[Loop]);
+            XCTAssertTrue((Value) && (*Value == Keys[Loop] * 2), @"Should retrieve the value");
+        }
+        
+        else XCTAssertEqual(Entries[Loop], 0, @"Should not find a missing key");
+    }
+    
+    CCHashMapFindKeys(Map, Keys, NULL, 0, NULL);
+    
+    CCHashMapDestroy(Map);
+}
+
+
+-(void) testCreateFromArrays
+{
+    if (!self.interface) return;
+    
+    int Keys[1000], Values[1000];
+    for (int Loop = 0; Loop < 1000; Loop++)
+    {
+        Keys[Loop] = Loop % 800;
+        Values[Loop] = Loop;
+    }
+    
+    CCHashMap Map = CCHashMapCreateFromArrays(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), Keys, Values, 1000, NULL, NULL, self.interface, NULL);
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 800, @"Should contain each unique key");
+    
+    for (int Loop = 0; Loop < 800; Loop++)
+    {
+        int *Value = CCHashMapGetValue(Map, &Loop);
+        XCTAssertTrue((Value) && (*Value == (Loop < 200 ? Loop + 800 : Loop)), @"Should retrieve the last value for the key");
+    }
+    
+    XCTAssertEqual(CCHashMapGetValue(Map, &(int){ 800 }), NULL, @"Should not retrieve a missing value");
+    
+    CCHashMapSetValue(Map, &(int){ 800 }, &(int){ 1 });
+    XCTAssertEqual(CCHashMapGetCount(Map), 801, @"Should be able to add entries after creation");
+    
+    CCHashMapDestroy(Map);
+    
+    
+    Map = CCHashMapCreateFromArrays(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), Keys, NULL, 800, NULL, NULL, self.interface, NULL);
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 800, @"Should contain each key");
+    XCTAssertFalse(CCHashMapEntryIsInitialized(Map, CCHashMapFindKey(Map, &(int){ 5 })), @"Should not initialize the entries");
+    
+    CCHashMapDestroy(Map);
+    
+    
+    Map = CCHashMapCreateFromArrays(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), NULL, NULL, 0, NULL, NULL, self.interface, NULL);
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), 0, @"Should be empty");
+    
+    CCHashMapDestroy(Map);
+    
+    
+    const size_t Count = 100000;
+    int *ManyKeys;
+    CC_SAFE_Malloc(ManyKeys, sizeof(int) * Count);
+    for (size_t Loop = 0; Loop < Count; Loop++) ManyKeys[Loop] = (int)Loop;
+    
+    Map = CCHashMapCreateFromArrays(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), ManyKeys, ManyKeys, Count, NULL, NULL, self.interface, CCTaskQueueDefault());
+    
+    XCTAssertEqual(CCHashMapGetCount(Map), Count, @"Should contain each key");
+    XCTAssertTrue(CCTaskQueueIsEmpty(CCTaskQueueDefault()), @"Should complete all the hashing tasks");
+    
+    size_t Matches = 0;
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        int *Value = CCHashMapGetValue(Map, &ManyKeys[Loop]);
+        if ((Value) && (*Value == ManyKeys[Loop])) Matches++;
+    }
+    
+    XCTAssertEqual(Matches, Count, @"Should retrieve every value");
+    
+    CCHashMapDestroy(Map);
+    CCFree(ManyKeys);
+}
+
+-(void) assertBatchesInMap: (CCHashMap)map
+{
+    CCEnumerator Enumerator;
+    CCHashMapGetKeyEnumerator(map, &Enumerator);
+    int *Key = CCHashMapEnumeratorGetCurrent(&Enumerator);
+    
+    size_t Count = 0;
+    CCEnumeratorState Cursor = {}, Keys, Values;
+    for (size_t BatchCount; (BatchCount = CCHashMapGetNextBatch(map, &Cursor, &Keys, &Values)); )
+    {
+        XCTAssertEqual(Keys.batch.count, BatchCount, @"Should set the number of keys");
+        XCTAssertEqual(Values.batch.count, BatchCount, @"Should set the number of values");
+        
+        for (size_t Loop = 0; Loop < BatchCount; Loop++, Count++)
+        {
+            const int BatchKey = *(int*)(Keys.batch.ptr + (Loop * Keys.batch.stride));
+            XCTAssertTrue((Key) && (*Key == BatchKey), @"Should follow the order of the enumerator");
+            XCTAssertEqual(*(int*)(Values.batch.ptr + (Loop * Values.batch.stride)), BatchKey * 2, @"Should retrieve the value");
+            
+            Key = CCHashMapEnumeratorNext(&Enumerator);
+        }
+    }
+    
+    XCTAssertEqual(Key, NULL, @"Should include every entry");
+    XCTAssertEqual(Count, CCHashMapGetCount(map), @"Should include every entry");
+    XCTAssertEqual(CCHashMapGetNextBatch(map, &Cursor, NULL, NULL), 0, @"Should remain at the end");
+}
+
+-(void) testBatches
+{
+    if (!self.interface) return;
+    
+    CCHashMapInterface Fallback = *self.interface;
+    Fallback.optional.batch = NULL;
+    
+    for (int Loop = 0; Loop < 2; Loop++)
+    {
+        CCHashMap Map = CCHashMapCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 16, NULL, NULL, Loop ? &Fallback : self.interface);
+        
+        CCEnumeratorState Cursor = {};
+        XCTAssertEqual(CCHashMapGetNextBatch(Map, &Cursor, NULL, NULL), 0, @"Should not have any batches");
+        
+        for (int Loop2 = 0; Loop2 < 1000; Loop2++) CCHashMapSetValue(Map, &Loop2, &(int){ Loop2 * 2 });
+        for (int Loop2 = 0; Loop2 < 1000; Loop2 += 3) CCHashMapRemoveValue(Map, &Loop2);
+        
+        [self assertBatchesInMap: Map];
+        
+        CCHashMapDestroy(Map);
+    }
+}
+
 @end
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "Hash.h"
+#import "DataBuffer.h"
+
+@interface HashTests : XCTestCase
+
+@end
+
+@implementation HashTests
+
+static uint8_t Bytes[2048];
+
+-(void) setUp
+{
+    [super setUp];
+    
+    for (size_t Loop = 0; Loop < sizeof(Bytes); Loop++) Bytes[Loop] = (uint8_t)Loop;
+}
+
+-(void) testXXH3
+{
+    const struct {
+        size_t size;
+        uint64_t hash;
+        uint64_t seeded;
+    } Expected[] = {
+        { 0, 0x2d06800538d394c2, 0x602b0e2cd6662c8b },
+        { 1, 0xc44bdff4074eecdb, 0x062b185e4e01441a },
+        { 3, 0x5f4299fc161c9cbb, 0xbe1fd1f503b5d59e },
+        { 4, 0x60dab036a58211f2, 0x89878861fce0da55 },
+        { 8, 0x3a1c2d7c85af88f8, 0xb82d9ef5fd6b3172 },
+        { 9, 0xe9612598145bb9dc, 0xfe11eeff350b91ef },
+        { 16, 0x8355e3a6f61770db, 0x3d392960bfd9df8a },
+        { 17, 0x9ef341a99de37328, 0x89e5f063c641de9f },
+        { 128, 0x85c6174c7ff4c46b, 0x77bf966868f4b200 },
+        { 129, 0xec7642b431ba3e5a, 0x747f159fdd2d2177 },
+        { 240, 0x375a384d957fe865, 0xe6e766db0868c372 },
+        { 241, 0x02e8cd95421c6d02, 0x172114de208c5a80 },
+        { 1024, 0xa870f92984398d22, 0x998502a823864329 },
+        { 2048, 0xdd420471ff96bd00, 0x7f738d385e516426 }
+    };
+    
+    for (size_t Loop = 0; Loop < sizeof(Expected) / sizeof(*Expected); Loop++)
+    {
+        XCTAssertEqual(CCHashXXH3Bytes(Bytes, Expected[Loop].size, 0), Expected[Loop].hash, @"Should have the correct hash for size (%zu)", Expected[Loop].size);
+        XCTAssertEqual(CCHashXXH3Bytes(Bytes, Expected[Loop].size, 0x9e3779b97f4a7c15), Expected[Loop].seeded, @"Should have the correct seeded hash for size (%zu)", Expected[Loop].size);
+    }
+}
+
+-(void) testData
+{
+    for (size_t Loop = 0; Loop < sizeof(Bytes); Loop += 61)
+    {
+        CCData Data = CCDataBufferCreate(CC_STD_ALLOCATOR, CCDataBufferHintCopy | CCDataHintRead, Loop, Bytes, NULL, NULL);
+        
+        XCTAssertEqual(CCHashXXH3(Data), CCHashXXH3Bytes(Bytes, Loop, 0), @"Should match the contiguous hash");
+        XCTAssertEqual(CCHashXXH3WithSeed(Data, 5), CCHashXXH3Bytes(Bytes, Loop, 5), @"Should match the contiguous hash");
+        XCTAssertEqual(CCHashMurmur32(Data), CCHashMurmur32Bytes(Bytes, Loop, 0), @"Should match the contiguous hash");
+        XCTAssertEqual(CCHashMurmur32WithSeed(Data, 5), CCHashMurmur32Bytes(Bytes, Loop, 5), @"Should match the contiguous hash");
+        XCTAssertEqual(CCHashJenkins32(Data), CCHashJenkins32Bytes(Bytes, Loop), @"Should match the contiguous hash");
+        
+        CCDataDestroy(Data);
+    }
+}
+
+-(void) testStreaming
+{
+    const size_t ChunkSizes[] = { 1, 3, 64, 100, 256, 257, 1000 };
+    for (size_t Loop = 0; Loop < sizeof(ChunkSizes) / sizeof(*ChunkSizes); Loop++)
+    {
+        for (size_t Size = 0; Size <= sizeof(Bytes); Size += 97)
+        {
+            CCHashXXH3State XXH3;
+            CCHashXXH3Init(&XXH3, Loop);
+            
+            CCHashMurmur32State Murmur32;
+            CCHashMurmur32Init(&Murmur32, (uint32_t)Loop);
+            
+            for (size_t Offset = 0; Offset < Size; Offset += ChunkSizes[Loop])
+            {
+                const size_t Count = (Size - Offset) < ChunkSizes[Loop] ? (Size - Offset) : ChunkSizes[Loop];
+                CCHashXXH3Update(&XXH3, Bytes + Offset, Count);
+                CCHashMurmur32Update(&Murmur32, Bytes + Offset, Count);
+            }
+            
+            XCTAssertEqual(CCHashXXH3Final(&XXH3), CCHashXXH3Bytes(Bytes, Size, Loop), @"Should match the contiguous hash for size (%zu) in chunks of (%zu)", Size, ChunkSizes[Loop]);
+            XCTAssertEqual(CCHashMurmur32Final(&Murmur32), CCHashMurmur32Bytes(Bytes, Size, (uint32_t)Loop), @"Should match the contiguous hash for size (%zu) in chunks of (%zu)", Size, ChunkSizes[Loop]);
+        }
+    }
+}
+
+-(void) testSeeds
+{
+    XCTAssertNotEqual(CCHashXXH3Bytes(Bytes, 1000, 1), CCHashXXH3Bytes(Bytes, 1000, 2), @"Should produce different hashes");
+    XCTAssertNotEqual(CCHashMurmur32Bytes(Bytes, 1000, 1), CCHashMurmur32Bytes(Bytes, 1000, 2), @"Should produce different hashes");
+}
+
+@end
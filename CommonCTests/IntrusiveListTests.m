@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "IntrusiveList.h"
+
+typedef struct {
+    int value;
+    CCLinkedListNode node;
+    CCLinkedListNode other;
+} TestObject;
+
+@interface IntrusiveListTests : XCTestCase
+
+@end
+
+@implementation IntrusiveListTests
+
+-(void) assertList: (CCIntrusiveList*)list HasValues: (const int*)values OfCount: (size_t)count
+{
+    XCTAssertEqual(CCIntrusiveListGetCount(list), count, @"Should have the correct count");
+    XCTAssertEqual(CCIntrusiveListIsEmpty(list), !count, @"Should have the correct empty state");
+    
+    size_t Index = 0;
+    CC_INTRUSIVE_LIST_FOREACH(TestObject, node, Object, list)
+    {
+        XCTAssertLessThan(Index, count, @"Should not contain more nodes than expected");
+        if (Index < count) XCTAssertEqual(Object->value, values[Index], @"Should be in the correct order");
+        Index++;
+    }
+    
+    XCTAssertEqual(Index, count, @"Should visit every node");
+    
+    Index = count;
+    for (CCLinkedListNode *Node = CCIntrusiveListGetTail(list); Node; Node = Node->prev)
+    {
+        XCTAssertGreaterThan(Index, 0, @"Should not contain more nodes than expected");
+        if (Index) XCTAssertEqual(CC_INTRUSIVE_LIST_ENTRY(Node, TestObject, node)->value, values[--Index], @"Should be in the correct order");
+    }
+    
+    XCTAssertEqual(Index, 0, @"Should visit every node in reverse");
+}
+
+-(void) testInsertion
+{
+    TestObject Objects[5] = { { .value = 0 }, { .value = 1 }, { .value = 2 }, { .value = 3 }, { .value = 4 } };
+    CCIntrusiveList List = CC_INTRUSIVE_LIST_INIT;
+    
+    [self assertList: &List HasValues: NULL OfCount: 0];
+    XCTAssertEqual(CCIntrusiveListGetHead(&List), NULL, @"Should have no head");
+    XCTAssertEqual(CCIntrusiveListGetTail(&List), NULL, @"Should have no tail");
+    
+    CCIntrusiveListAppend(&List, &Objects[2].node);
+    [self assertList: &List HasValues: (int[]){ 2 } OfCount: 1];
+    
+    CCIntrusiveListPrepend(&List, &Objects[0].node);
+    [self assertList: &List HasValues: (int[]){ 0, 2 } OfCount: 2];
+    
+    CCIntrusiveListAppend(&List, &Objects[4].node);
+    [self assertList: &List HasValues: (int[]){ 0, 2, 4 } OfCount: 3];
+    
+    CCIntrusiveListInsertAfter(&List, &Objects[0].node, &Objects[1].node);
+    [self assertList: &List HasValues: (int[]){ 0, 1, 2, 4 } OfCount: 4];
+    
+    CCIntrusiveListInsertBefore(&List, &Objects[4].node, &Objects[3].node);
+    [self assertList: &List HasValues: (int[]){ 0, 1, 2, 3, 4 } OfCount: 5];
+    
+    XCTAssertEqual(CCIntrusiveListGetHead(&List), &Objects[0].node, @"Should have the correct head");
+    XCTAssertEqual(CCIntrusiveListGetTail(&List), &Objects[4].node, @"Should have the correct tail");
+    
+    CCIntrusiveList Other = CC_INTRUSIVE_LIST_INIT;
+    CCIntrusiveListInsertAfter(&Other, (CCIntrusiveListAppend(&Other, &Objects[0].other), &Objects[0].other), &Objects[4].other);
+    CCIntrusiveListInsertBefore(&Other, &Objects[0].other, &Objects[2].other);
+    
+    XCTAssertEqual(CCIntrusiveListGetCount(&Other), 3, @"Should have the correct count");
+    XCTAssertEqual(CC_INTRUSIVE_LIST_ENTRY(CCIntrusiveListGetHead(&Other), TestObject, other)->value, 2, @"Should have the correct head");
+    XCTAssertEqual(CC_INTRUSIVE_LIST_ENTRY(CCIntrusiveListGetTail(&Other), TestObject, other)->value, 4, @"Should have the correct tail");
+    [self assertList: &List HasValues: (int[]){ 0, 1, 2, 3, 4 } OfCount: 5];
+}
+
+-(void) testRemoval
+{
+    TestObject Objects[5] = { { .value = 0 }, { .value = 1 }, { .value = 2 }, { .value = 3 }, { .value = 4 } };
+    CCIntrusiveList List = CC_INTRUSIVE_LIST_INIT;
+    
+    for (size_t Loop = 0; Loop < 5; Loop++) CCIntrusiveListAppend(&List, &Objects[Loop].node);
+    
+    CCIntrusiveListRemove(&List, &Objects[2].node);
+    [self assertList: &List HasValues: (int[]){ 0, 1, 3, 4 } OfCount: 4];
+    XCTAssertEqual(Objects[2].node.next, NULL, @"Should unlink the node");
+    XCTAssertEqual(Objects[2].node.prev, NULL, @"Should unlink the node");
+    
+    XCTAssertEqual(CCIntrusiveListRemoveHead(&List), &Objects[0].node, @"Should remove the head");
+    [self assertList: &List HasValues: (int[]){ 1, 3, 4 } OfCount: 3];
+    
+    XCTAssertEqual(CCIntrusiveListRemoveTail(&List), &Objects[4].node, @"Should remove the tail");
+    [self assertList: &List HasValues: (int[]){ 1, 3 } OfCount: 2];
+    
+    CCIntrusiveListRemove(&List, &Objects[3].node);
+    [self assertList: &List HasValues: (int[]){ 1 } OfCount: 1];
+    
+    CCIntrusiveListRemove(&List, &Objects[1].node);
+    [self assertList: &List HasValues: NULL OfCount: 0];
+    
+    XCTAssertEqual(CCIntrusiveListRemoveHead(&List), NULL, @"Should not remove anything");
+    XCTAssertEqual(CCIntrusiveListRemoveTail(&List), NULL, @"Should not remove anything");
+}
+
+-(void) testMoving
+{
+    TestObject Objects[6] = { { .value = 0 }, { .value = 1 }, { .value = 2 }, { .value = 3 }, { .value = 4 }, { .value = 5 } };
+    CCIntrusiveList Ready = CC_INTRUSIVE_LIST_INIT, Waiting = CC_INTRUSIVE_LIST_INIT;
+    
+    for (size_t Loop = 0; Loop < 3; Loop++) CCIntrusiveListAppend(&Ready, &Objects[Loop].node);
+    for (size_t Loop = 3; Loop < 6; Loop++) CCIntrusiveListAppend(&Waiting, &Objects[Loop].node);
+    
+    CCIntrusiveListMove(&Ready, &Waiting, &Objects[4].node);
+    [self assertList: &Ready HasValues: (int[]){ 0, 1, 2, 4 } OfCount: 4];
+    [self assertList: &Waiting HasValues: (int[]){ 3, 5 } OfCount: 2];
+    
+    CCIntrusiveListMove(&Waiting, &Ready, &Objects[0].node);
+    [self assertList: &Ready HasValues: (int[]){ 1, 2, 4 } OfCount: 3];
+    [self assertList: &Waiting HasValues: (int[]){ 3, 5, 0 } OfCount: 3];
+    
+    CCIntrusiveListSplice(&Ready, &Waiting);
+    [self assertList: &Ready HasValues: (int[]){ 1, 2, 4, 3, 5, 0 } OfCount: 6];
+    [self assertList: &Waiting HasValues: NULL OfCount: 0];
+    
+    CCIntrusiveListSplice(&Ready, &Waiting);
+    [self assertList: &Ready HasValues: (int[]){ 1, 2, 4, 3, 5, 0 } OfCount: 6];
+    
+    CCIntrusiveListSplice(&Waiting, &Ready);
+    [self assertList: &Waiting HasValues: (int[]){ 1, 2, 4, 3, 5, 0 } OfCount: 6];
+    [self assertList: &Ready HasValues: NULL OfCount: 0];
+}
+
+@end
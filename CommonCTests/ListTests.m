@@ -83,7 +83,7 @@
     CCListDestroy(List);
     
     
-    List = CC_STATIC_LIST(CC_STD_ALLOCATOR, 1, 0, CC_STATIC_LINKED_LIST_NODE(CCArray, (CC_STATIC_ARRAY(sizeof(int), 1))));
+    List = CC_STATIC_LIST(CC_STD_ALLOCATOR, 1, 0, ((CCArray[]){ CC_STATIC_ARRAY(sizeof(int), 1) }));
     
     XCTAssertEqual(CCListGetCount(List), 0, @"Should be empty");
     XCTAssertEqual(CCListGetElementSize(List), sizeof(int), @"Should be the size specified on creation");
@@ -91,7 +91,7 @@
     CCListDestroy(List);
     
     
-    List = CC_CONST_LIST(CC_STD_ALLOCATOR, 1, 0, CC_STATIC_LINKED_LIST_NODE(CCArray, (CC_STATIC_ARRAY(sizeof(int), 1))));
+    List = CC_CONST_LIST(CC_STD_ALLOCATOR, 1, 0, ((CCArray[]){ CC_STATIC_ARRAY(sizeof(int), 1) }));
     
     XCTAssertEqual(CCListGetCount(List), 0, @"Should be empty");
     XCTAssertEqual(CCListGetElementSize(List), sizeof(int), @"Should be the size specified on creation");
@@ -120,7 +120,7 @@
     
     for (size_t PageSize = 1; PageSize <= 3; PageSize++)
     {
-        CCList List = CC_STATIC_LIST(CC_STD_ALLOCATOR, PageSize, 0, CC_STATIC_LINKED_LIST_NODE(CCArray, (CC_STATIC_ARRAY(sizeof(int), 1))));
+        CCList List = CC_STATIC_LIST(CC_STD_ALLOCATOR, PageSize, 0, ((CCArray[]){ CC_STATIC_ARRAY(sizeof(int), 1) }));
         
         CCListAppendElement(List, &(int){ 1 });
         CCListAppendElement(List, &(int){ 2 });
@@ -135,7 +135,7 @@
     }
     
     
-    CCList List = CC_STATIC_LIST(CC_STD_ALLOCATOR, 2, 1, CC_STATIC_LINKED_LIST_NODE(CCArray, (CC_STATIC_ARRAY(sizeof(int), 2, 1, CC_STATIC_ALLOC(int[2], ({ 9 }))))));
+    CCList List = CC_STATIC_LIST(CC_STD_ALLOCATOR, 2, 1, ((CCArray[]){ CC_STATIC_ARRAY(sizeof(int), 2, 1, CC_STATIC_ALLOC(int[2], ({ 9 }))) }));
     
     CCListAppendElement(List, &(int){ 1 });
     CCListAppendElement(List, &(int){ 2 });
@@ -150,6 +150,24 @@
     CCListDestroy(List);
     
     
+    List = CC_STATIC_LIST(CC_STD_ALLOCATOR, 2, 3, ((CCArray[]){
+        CC_STATIC_ARRAY(sizeof(int), 2, 2, CC_STATIC_ALLOC(int[2], ({ 1, 2 }))),
+        CC_STATIC_ARRAY(sizeof(int), 2, 1, CC_STATIC_ALLOC(int[2], ({ 3 })))
+    }));
+    
+    CCListAppendElement(List, &(int){ 4 });
+    CCListAppendElement(List, &(int){ 5 });
+    CCListAppendElement(List, &(int){ 6 });
+    
+    XCTAssertEqual(CCListGetCount(List), 6, @"Should contain 6 elements");
+    for (size_t Loop = 0; Loop < 6; Loop++)
+    {
+        XCTAssertEqual(*(int*)CCListGetElementAtIndex(List, Loop), Loop + 1, @"Should be the correct element");
+    }
+    
+    CCListDestroy(List);
+    
+    
     for (size_t Loop = 0; Loop < 10; Loop++)
     {
         for (size_t Loop2 = 0; Loop2 < 10; Loop2++)
@@ -253,6 +271,51 @@
     }
 }
 
+-(void) testPageDirectory
+{
+    CCList List = CCListCreate(CC_STD_ALLOCATOR, sizeof(int), 4, 16);
+    
+    for (int Loop = 0; Loop < 1000; Loop++) CCListAppendElement(List, &Loop);
+    
+    int *First = CCListGetElementAtIndex(List, 0), *Middle = CCListGetElementAtIndex(List, 500), *Last = CCListGetElementAtIndex(List, 999);
+    
+    for (int Loop = 1000; Loop < 2000; Loop++) CCListAppendElement(List, &Loop);
+    CCListAppendElements(List, (int[]){ 2000, 2001, 2002 }, 3);
+    
+    XCTAssertEqual(CCListGetElementAtIndex(List, 0), First, @"Appending should not move existing elements");
+    XCTAssertEqual(CCListGetElementAtIndex(List, 500), Middle, @"Appending should not move existing elements");
+    XCTAssertEqual(CCListGetElementAtIndex(List, 999), Last, @"Appending should not move existing elements");
+    
+    XCTAssertEqual(CCListGetCount(List), 2003, @"Should contain all the elements");
+    for (size_t Loop = 0; Loop < 2003; Loop++)
+    {
+        XCTAssertEqual(*(int*)CCListGetElementAtIndex(List, Loop), Loop, @"Should be the correct element");
+    }
+    
+    for (size_t Loop = 0; Loop < 100; Loop++) CCListInsertElementAtIndex(List, Loop * 7, &(int){ -1 });
+    for (size_t Loop = 0; Loop < 100; Loop++) CCListRemoveElementAtIndex(List, (99 - Loop) * 7);
+    
+    XCTAssertEqual(CCListGetCount(List), 2003, @"Should contain all the elements");
+    for (size_t Loop = 0; Loop < 2003; Loop++)
+    {
+        XCTAssertEqual(*(int*)CCListGetElementAtIndex(List, Loop), Loop, @"Should be the correct element");
+    }
+    
+    for (size_t Loop = 0; Loop < 1990; Loop++) CCListRemoveElementAtIndex(List, CCListGetCount(List) - 1);
+    
+    XCTAssertEqual(CCListGetCount(List), 13, @"Should contain the remaining elements");
+    XCTAssertEqual(List->pageCount, 1, @"Should release the empty pages");
+    
+    CCListRemoveAllElements(List);
+    
+    XCTAssertEqual(CCListGetCount(List), 0, @"Should be empty");
+    
+    CCListAppendElements(List, (int[]){ 1, 2, 3 }, 3);
+    XCTAssertEqual(*(int*)CCListGetElementAtIndex(List, 2), 3, @"Should be the correct element");
+    
+    CCListDestroy(List);
+}
+
 -(void) testEnumerable
 {
     CCList List = CCListCreate(CC_STD_ALLOCATOR, sizeof(int), 3, 3);
@@ -0,0 +1,166 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "PriorityQueue.h"
+
+@interface PriorityQueueTests : XCTestCase
+
+@end
+
+@implementation PriorityQueueTests
+
+static CCComparisonResult IntComparator(const int *Left, const int *Right)
+{
+    return *Left < *Right ? CCComparisonResultAscending : (*Left > *Right ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+-(void) testOrdering
+{
+    static const size_t Arities[] = { 2, 3, 4, 8 };
+    
+    for (size_t Test = 0; Test < sizeof(Arities) / sizeof(*Arities); Test++)
+    {
+        CCPriorityQueue Queue = CCPriorityQueueCreate(CC_STD_ALLOCATOR, sizeof(int), Arities[Test], (CCComparator)IntComparator);
+        
+        XCTAssertEqual(CCPriorityQueueGetCount(Queue), 0, @"Should be empty");
+        XCTAssertEqual(CCPriorityQueuePeek(Queue), NULL, @"Should be empty");
+        XCTAssertFalse(CCPriorityQueuePop(Queue, NULL), @"Should not pop from an empty queue");
+        
+        srand(Test);
+        for (int Loop = 0; Loop < 10000; Loop++)
+        {
+            XCTAssertNotEqual(CCPriorityQueuePush(Queue, &(int){ rand() % 5000 }), CC_PRIORITY_QUEUE_HANDLE_INVALID, @"Should push the element");
+        }
+        
+        XCTAssertEqual(CCPriorityQueueGetCount(Queue), 10000, @"Should contain all the elements");
+        
+        int Previous = INT_MIN;
+        for (int Loop = 0; Loop < 5000; Loop++)
+        {
+            const int Front = *(int*)CCPriorityQueuePeek(Queue);
+            
+            int Value;
+            XCTAssertTrue(CCPriorityQueuePop(Queue, &Value), @"Should pop an element");
+            XCTAssertEqual(Value, Front, @"Should pop the front element");
+            XCTAssertLessThanOrEqual(Previous, Value, @"Should pop the elements in order");
+            Previous = Value;
+            
+            //Interleave pushes with pops
+            if (Loop % 4 == 0) CCPriorityQueuePush(Queue, &(int){ Value + (rand() % 100) });
+        }
+        
+        while (CCPriorityQueuePop(Queue, &(int){ 0 }) && CCPriorityQueueGetCount(Queue))
+        {
+            const int Value = *(int*)CCPriorityQueuePeek(Queue);
+            XCTAssertLessThanOrEqual(Previous, Value, @"Should pop the elements in order");
+            Previous = Value;
+        }
+        
+        XCTAssertEqual(CCPriorityQueueGetCount(Queue), 0, @"Should be empty");
+        
+        CCPriorityQueueDestroy(Queue);
+    }
+}
+
+-(void) testHandles
+{
+    CCPriorityQueue Queue = CCPriorityQueueCreate(CC_STD_ALLOCATOR, sizeof(int), 4, (CCComparator)IntComparator);
+    
+    CCPriorityQueueHandle Handles[100];
+    for (int Loop = 0; Loop < 100; Loop++) Handles[Loop] = CCPriorityQueuePush(Queue, &(int){ 1000 + Loop });
+    
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        XCTAssertTrue(CCPriorityQueueContainsHandle(Queue, Handles[Loop]), @"Should contain the handle");
+        XCTAssertEqual(*(const int*)CCPriorityQueueGetElement(Queue, Handles[Loop]), 1000 + Loop, @"Should reference the correct element");
+    }
+    
+    CCPriorityQueueUpdate(Queue, Handles[50], &(int){ 1 });
+    XCTAssertEqual(*(int*)CCPriorityQueuePeek(Queue), 1, @"Should move the decreased element to the front");
+    
+    CCPriorityQueueUpdate(Queue, Handles[50], &(int){ 5000 });
+    XCTAssertEqual(*(int*)CCPriorityQueuePeek(Queue), 1000, @"Should move the increased element back");
+    
+    CCPriorityQueueUpdate(Queue, Handles[0], &(int){ 4000 });
+    XCTAssertEqual(*(int*)CCPriorityQueuePeek(Queue), 1001, @"Should move the increased element back");
+    
+    for (int Loop = 1; Loop < 100; Loop += 2) CCPriorityQueueRemove(Queue, Handles[Loop]);
+    
+    XCTAssertEqual(CCPriorityQueueGetCount(Queue), 50, @"Should remove the elements");
+    XCTAssertFalse(CCPriorityQueueContainsHandle(Queue, Handles[1]), @"Should not contain the removed handle");
+    XCTAssertFalse(CCPriorityQueueContainsHandle(Queue, Handles[99]), @"Should not contain the removed handle");
+    XCTAssertFalse(CCPriorityQueueContainsHandle(Queue, 1000), @"Should not contain an unknown handle");
+    
+    for (int Loop = 0; Loop < 100; Loop += 2)
+    {
+        XCTAssertTrue(CCPriorityQueueContainsHandle(Queue, Handles[Loop]), @"Should contain the handle");
+        
+        const int Expected = Loop == 0 ? 4000 : (Loop == 50 ? 5000 : 1000 + Loop);
+        XCTAssertEqual(*(const int*)CCPriorityQueueGetElement(Queue, Handles[Loop]), Expected, @"Should reference the correct element");
+    }
+    
+    const CCPriorityQueueHandle Reused = CCPriorityQueuePush(Queue, &(int){ 0 });
+    XCTAssertTrue(Reused < 100, @"Should reuse a removed handle");
+    XCTAssertEqual(*(const int*)CCPriorityQueueGetElement(Queue, Reused), 0, @"Should reference the correct element");
+    
+    int Expected[] = { 0, 1002, 1004 };
+    for (size_t Loop = 0; Loop < sizeof(Expected) / sizeof(*Expected); Loop++)
+    {
+        int Value;
+        XCTAssertTrue(CCPriorityQueuePop(Queue, &Value), @"Should pop an element");
+        XCTAssertEqual(Value, Expected[Loop], @"Should pop the elements in order");
+    }
+    
+    XCTAssertFalse(CCPriorityQueueContainsHandle(Queue, Handles[2]), @"Should not contain the popped handle");
+    
+    CCPriorityQueueRemoveAll(Queue);
+    XCTAssertEqual(CCPriorityQueueGetCount(Queue), 0, @"Should be empty");
+    XCTAssertFalse(CCPriorityQueueContainsHandle(Queue, Handles[0]), @"Should not contain any handles");
+    
+    CCPriorityQueueDestroy(Queue);
+}
+
+-(void) testDefaultOrdering
+{
+    CCPriorityQueue Queue = CCPriorityQueueCreate(CC_STD_ALLOCATOR, 3, 2, NULL);
+    
+    CCPriorityQueuePush(Queue, "bca");
+    CCPriorityQueuePush(Queue, "abc");
+    CCPriorityQueuePush(Queue, "bac");
+    CCPriorityQueuePush(Queue, "aab");
+    
+    const char *Expected[] = { "aab", "abc", "bac", "bca" };
+    for (size_t Loop = 0; Loop < 4; Loop++)
+    {
+        char Value[3];
+        XCTAssertTrue(CCPriorityQueuePop(Queue, Value), @"Should pop an element");
+        XCTAssertTrue(!memcmp(Value, Expected[Loop], 3), @"Should pop the elements in order");
+    }
+    
+    CCPriorityQueueDestroy(Queue);
+}
+
+@end
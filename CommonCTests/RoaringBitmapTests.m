@@ -0,0 +1,220 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "RoaringBitmap.h"
+#import "ConcurrentIDGenerator.h"
+#import "ConsecutiveIDGenerator.h"
+
+#define TEST_CONTAINER_COUNT 5
+#define TEST_VALUE_COUNT (TEST_CONTAINER_COUNT * 65536)
+
+@interface RoaringBitmapTests : XCTestCase
+
+@end
+
+@implementation RoaringBitmapTests
+
+-(void) assertBitmap: (CCRoaringBitmap)bitmap MatchesBools: (const _Bool*)bools
+{
+    size_t Count = 0;
+    uint32_t Next = 0;
+    _Bool Found = CCRoaringBitmapFindNext(bitmap, 0, &Next);
+    for (uint32_t Loop = 0; Loop < TEST_VALUE_COUNT; Loop++)
+    {
+        if (bools[Loop])
+        {
+            XCTAssertTrue(Found, @"Should find the next value");
+            XCTAssertEqual(Next, Loop, @"Should find the next value");
+            
+            Found = CCRoaringBitmapFindNext(bitmap, Loop + 1, &Next);
+            Count++;
+        }
+    }
+    
+    XCTAssertFalse(Found, @"Should not find values past the last value");
+    XCTAssertEqual(CCRoaringBitmapGetCount(bitmap), Count, @"Should have the correct count");
+    
+    for (uint32_t Loop = 0; Loop < TEST_VALUE_COUNT; Loop += 7)
+    {
+        XCTAssertEqual(CCRoaringBitmapContains(bitmap, Loop), bools[Loop], @"Should have the correct membership for value %u", Loop);
+    }
+}
+
+-(CCRoaringBitmap) createBitmapWithBools: (_Bool*)bools Seed: (unsigned int)seed
+{
+    //Each container has a different density, so both container representations are involved
+    static const int Density[TEST_CONTAINER_COUNT] = { 2, 40, 0, 3, 100 };
+    
+    CCRoaringBitmap Bitmap = CCRoaringBitmapCreate(CC_STD_ALLOCATOR);
+    
+    srand(seed);
+    for (uint32_t Loop = 0; Loop < TEST_VALUE_COUNT; Loop++)
+    {
+        const int Chance = Density[((Loop >> 16) + seed) % TEST_CONTAINER_COUNT];
+        if ((bools[Loop] = (Chance && !(rand() % Chance)))) XCTAssertTrue(CCRoaringBitmapAdd(Bitmap, Loop), @"Should add the value");
+    }
+    
+    return Bitmap;
+}
+
+-(void) testAddingAndRemoving
+{
+    CCRoaringBitmap Bitmap = CCRoaringBitmapCreate(CC_STD_ALLOCATOR);
+    
+    XCTAssertEqual(CCRoaringBitmapGetCount(Bitmap), 0, @"Should be empty");
+    XCTAssertFalse(CCRoaringBitmapContains(Bitmap, 0), @"Should not contain the value");
+    
+    uint32_t Next;
+    XCTAssertFalse(CCRoaringBitmapFindNext(Bitmap, 0, &Next), @"Should not find a value");
+    
+    XCTAssertTrue(CCRoaringBitmapAdd(Bitmap, 70000), @"Should add the value");
+    XCTAssertTrue(CCRoaringBitmapAdd(Bitmap, 5), @"Should add the value");
+    XCTAssertTrue(CCRoaringBitmapAdd(Bitmap, UINT32_MAX), @"Should add the value");
+    XCTAssertTrue(CCRoaringBitmapAdd(Bitmap, 5), @"Should add the value");
+    
+    XCTAssertEqual(CCRoaringBitmapGetCount(Bitmap), 3, @"Should not add duplicates");
+    XCTAssertTrue(CCRoaringBitmapContains(Bitmap, 5), @"Should contain the value");
+    XCTAssertTrue(CCRoaringBitmapContains(Bitmap, 70000), @"Should contain the value");
+    XCTAssertTrue(CCRoaringBitmapContains(Bitmap, UINT32_MAX), @"Should contain the value");
+    XCTAssertFalse(CCRoaringBitmapContains(Bitmap, 6), @"Should not contain the value");
+    
+    XCTAssertTrue(CCRoaringBitmapFindNext(Bitmap, 6, &Next), @"Should find a value");
+    XCTAssertEqual(Next, 70000, @"Should find the next value in the following container");
+    XCTAssertTrue(CCRoaringBitmapFindNext(Bitmap, 70001, &Next), @"Should find a value");
+    XCTAssertEqual(Next, UINT32_MAX, @"Should find the last value");
+    
+    CCRoaringBitmapRemove(Bitmap, 70000);
+    CCRoaringBitmapRemove(Bitmap, 70000);
+    XCTAssertEqual(CCRoaringBitmapGetCount(Bitmap), 2, @"Should remove the value");
+    XCTAssertFalse(CCRoaringBitmapContains(Bitmap, 70000), @"Should not contain the value");
+    
+    //Fill a container past the array limit and back again
+    for (uint32_t Loop = 0; Loop < 65536; Loop += 2) XCTAssertTrue(CCRoaringBitmapAdd(Bitmap, 0x10000 + Loop), @"Should add the value");
+    
+    XCTAssertEqual(CCRoaringBitmapGetCount(Bitmap), 2 + 32768, @"Should add the values");
+    
+    for (uint32_t Loop = 0; Loop < 65536; Loop += 2)
+    {
+        XCTAssertTrue(CCRoaringBitmapContains(Bitmap, 0x10000 + Loop), @"Should contain the value");
+        XCTAssertFalse(CCRoaringBitmapContains(Bitmap, 0x10000 + Loop + 1), @"Should not contain the value");
+    }
+    
+    for (uint32_t Loop = 0; Loop < 65536 - 200; Loop += 2) CCRoaringBitmapRemove(Bitmap, 0x10000 + Loop);
+    
+    XCTAssertEqual(CCRoaringBitmapGetCount(Bitmap), 2 + 100, @"Should remove the values");
+    XCTAssertTrue(CCRoaringBitmapFindNext(Bitmap, 6, &Next), @"Should find a value");
+    XCTAssertEqual(Next, 0x10000 + 65536 - 200, @"Should find the first remaining value");
+    
+    CCRoaringBitmapRemoveAll(Bitmap);
+    XCTAssertEqual(CCRoaringBitmapGetCount(Bitmap), 0, @"Should be empty");
+    XCTAssertFalse(CCRoaringBitmapFindNext(Bitmap, 0, &Next), @"Should not find a value");
+    
+    CCRoaringBitmapDestroy(Bitmap);
+}
+
+-(void) testSetOperations
+{
+    _Bool *Left = malloc(TEST_VALUE_COUNT), *Right = malloc(TEST_VALUE_COUNT), *Expected = malloc(TEST_VALUE_COUNT);
+    
+    for (unsigned int Seed = 0; Seed < 2; Seed++)
+    {
+        CCRoaringBitmap LeftBitmap = [self createBitmapWithBools: Left Seed: Seed];
+        CCRoaringBitmap RightBitmap = [self createBitmapWithBools: Right Seed: Seed + 1];
+        
+        [self assertBitmap: LeftBitmap MatchesBools: Left];
+        [self assertBitmap: RightBitmap MatchesBools: Right];
+        
+        CCRoaringBitmap Result = CCRoaringBitmapCreate(CC_STD_ALLOCATOR);
+        XCTAssertTrue(CCRoaringBitmapUnion(Result, LeftBitmap), @"Should copy the bitmap");
+        CCRoaringBitmapIntersect(Result, RightBitmap);
+        for (size_t Loop = 0; Loop < TEST_VALUE_COUNT; Loop++) Expected[Loop] = Left[Loop] && Right[Loop];
+        [self assertBitmap: Result MatchesBools: Expected];
+        CCRoaringBitmapDestroy(Result);
+        
+        Result = CCRoaringBitmapCreate(CC_STD_ALLOCATOR);
+        XCTAssertTrue(CCRoaringBitmapUnion(Result, LeftBitmap), @"Should copy the bitmap");
+        XCTAssertTrue(CCRoaringBitmapUnion(Result, RightBitmap), @"Should union the bitmap");
+        for (size_t Loop = 0; Loop < TEST_VALUE_COUNT; Loop++) Expected[Loop] = Left[Loop] || Right[Loop];
+        [self assertBitmap: Result MatchesBools: Expected];
+        CCRoaringBitmapDestroy(Result);
+        
+        Result = CCRoaringBitmapCreate(CC_STD_ALLOCATOR);
+        XCTAssertTrue(CCRoaringBitmapUnion(Result, LeftBitmap), @"Should copy the bitmap");
+        CCRoaringBitmapDifference(Result, RightBitmap);
+        for (size_t Loop = 0; Loop < TEST_VALUE_COUNT; Loop++) Expected[Loop] = Left[Loop] && !Right[Loop];
+        [self assertBitmap: Result MatchesBools: Expected];
+        CCRoaringBitmapDestroy(Result);
+        
+        CCRoaringBitmapIntersect(LeftBitmap, LeftBitmap);
+        [self assertBitmap: LeftBitmap MatchesBools: Left];
+        
+        CCRoaringBitmapDifference(LeftBitmap, LeftBitmap);
+        XCTAssertEqual(CCRoaringBitmapGetCount(LeftBitmap), 0, @"Should remove all values");
+        
+        CCRoaringBitmapDestroy(RightBitmap);
+        CCRoaringBitmapDestroy(LeftBitmap);
+    }
+    
+    free(Expected);
+    free(Right);
+    free(Left);
+}
+
+-(void) testGeneratorIDs
+{
+    CCConcurrentIDGenerator Generator = CCConcurrentIDGeneratorCreate(CC_STD_ALLOCATOR, 100000, CCConsecutiveIDGenerator);
+    CCRoaringBitmap Live = CCRoaringBitmapCreate(CC_STD_ALLOCATOR), Recycled = CCRoaringBitmapCreate(CC_STD_ALLOCATOR);
+    
+    for (size_t Loop = 0; Loop < 100000; Loop++)
+    {
+        const uintptr_t ID = CCConcurrentIDGeneratorAssign(Generator);
+        XCTAssertFalse(CCRoaringBitmapContains(Live, (uint32_t)ID), @"Should not assign an ID more than once");
+        XCTAssertTrue(CCRoaringBitmapAdd(Live, (uint32_t)ID), @"Should add the ID");
+    }
+    
+    XCTAssertEqual(CCRoaringBitmapGetCount(Live), 100000, @"Should contain every ID");
+    
+    for (uint32_t ID = 0; ID < 100000; ID += 3)
+    {
+        CCConcurrentIDGeneratorRecycle(Generator, ID);
+        XCTAssertTrue(CCRoaringBitmapAdd(Recycled, ID), @"Should add the ID");
+    }
+    
+    CCRoaringBitmapDifference(Live, Recycled);
+    XCTAssertEqual(CCRoaringBitmapGetCount(Live), 100000 - 33334, @"Should remove the recycled IDs");
+    
+    uint32_t ID = 0;
+    for (_Bool Found = CCRoaringBitmapFindNext(Live, 0, &ID); Found; Found = (ID != UINT32_MAX) && CCRoaringBitmapFindNext(Live, ID + 1, &ID))
+    {
+        XCTAssertNotEqual(ID % 3, 0, @"Should only contain live IDs");
+    }
+    
+    CCRoaringBitmapDestroy(Recycled);
+    CCRoaringBitmapDestroy(Live);
+    CCConcurrentIDGeneratorDestroy(Generator);
+}
+
+@end
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "Allocator.h"
+#import "MemoryAllocation.h"
+#import "SamplingAllocator.h"
+
+@interface SamplingAllocatorTests : XCTestCase
+
+@end
+
+@implementation SamplingAllocatorTests
+
+-(void) tearDown
+{
+    CCSamplingAllocatorSetRate(512 * 1024);
+    
+    [super tearDown];
+}
+
+-(void) testSampling
+{
+    CCSamplingAllocatorSetRate(1);
+    
+    const CCSamplingAllocatorStatistics Initial = CCSamplingAllocatorGetStatistics();
+    
+    void *Ptr[10];
+    for (size_t Loop = 0; Loop < 10; Loop++) Ptr[Loop] = CCMalloc(CC_SAMPLING_ALLOCATOR, 64, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    CCSamplingAllocatorStatistics Statistics = CCSamplingAllocatorGetStatistics();
+    XCTAssertEqual(Statistics.allocated.count - Initial.allocated.count, 10, @"Should sample every allocation");
+    XCTAssertEqual(Statistics.inUse.count - Initial.inUse.count, 10, @"Should have all allocations in use");
+    XCTAssertGreaterThanOrEqual(Statistics.inUse.size - Initial.inUse.size, 640, @"Should include the size of the allocations");
+    
+    Ptr[0] = CCRealloc(CC_SAMPLING_ALLOCATOR, Ptr[0], 128, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    Statistics = CCSamplingAllocatorGetStatistics();
+    XCTAssertEqual(Statistics.allocated.count - Initial.allocated.count, 11, @"Should sample the reallocation");
+    XCTAssertEqual(Statistics.inUse.count - Initial.inUse.count, 10, @"Should release the previous sample");
+    
+    for (size_t Loop = 0; Loop < 10; Loop++) CCFree(Ptr[Loop]);
+    
+    Statistics = CCSamplingAllocatorGetStatistics();
+    XCTAssertEqual(Statistics.allocated.count - Initial.allocated.count, 11, @"Should keep the allocation history");
+    XCTAssertEqual(Statistics.inUse.count, Initial.inUse.count, @"Should not have any allocations in use");
+    XCTAssertEqual(Statistics.inUse.size, Initial.inUse.size, @"Should not have any allocations in use");
+}
+
+-(void) testDisabled
+{
+    CCSamplingAllocatorSetRate(0);
+    
+    const CCSamplingAllocatorStatistics Initial = CCSamplingAllocatorGetStatistics();
+    
+    void *Ptr = CCMalloc(CC_SAMPLING_ALLOCATOR, 1024 * 1024, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    const CCSamplingAllocatorStatistics Statistics = CCSamplingAllocatorGetStatistics();
+    XCTAssertEqual(Statistics.allocated.count, Initial.allocated.count, @"Should not sample any allocations");
+    
+    CCFree(Ptr);
+}
+
+-(void) testProfile
+{
+    CCSamplingAllocatorSetRate(1);
+    
+    void *Ptr = CCMalloc(CC_SAMPLING_ALLOCATOR, 64, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    char *Buffer = NULL;
+    size_t Size = 0;
+    FILE *File = open_memstream(&Buffer, &Size);
+    CCSamplingAllocatorWrite(File, CCSamplingAllocatorFormatPprof);
+    fclose(File);
+    
+    XCTAssertTrue(!strncmp(Buffer, "heap profile: ", 14), @"Should write a pprof heap profile header");
+    XCTAssertTrue(strstr(Buffer, "@ heap_v2/1\n"), @"Should write the sampling rate");
+    
+    free(Buffer);
+    
+    Buffer = NULL;
+    Size = 0;
+    File = open_memstream(&Buffer, &Size);
+    CCSamplingAllocatorWrite(File, CCSamplingAllocatorFormatFlat);
+    fclose(File);
+    
+    XCTAssertTrue(!strncmp(Buffer, "Sampling rate: 1 bytes\n", 23), @"Should write the sampling rate");
+    XCTAssertTrue(strstr(Buffer, "in use"), @"Should write the call sites");
+    
+    free(Buffer);
+    
+    CCFree(Ptr);
+}
+
+@end
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "Scratch.h"
+#import <pthread.h>
+
+@interface ScratchTests : XCTestCase
+
+@end
+
+@implementation ScratchTests
+
+-(void) testAllocation
+{
+    const CCScratchMark Mark = CCScratchGetMark();
+    
+    uint8_t *A = CCScratchAllocate(10);
+    XCTAssertTrue(A, @"Should allocate scratch memory");
+    XCTAssertEqual((uintptr_t)A % (sizeof(void*) * 2), 0, @"Should be aligned");
+    memset(A, 1, 10);
+    
+    const CCScratchMark Mark2 = CCScratchGetMark();
+    
+    for (size_t Loop = 0; Loop < 100; Loop++)
+    {
+        uint8_t *Ptr = CCScratchAllocate(100000);
+        XCTAssertTrue(Ptr, @"Should allocate scratch memory");
+        memset(Ptr, 2, 100000);
+    }
+    
+    _Bool Retained = YES;
+    for (size_t Loop = 0; Loop < 10; Loop++) Retained &= A[Loop] == 1;
+    XCTAssertTrue(Retained, @"Should not modify earlier allocations");
+    
+    CCScratchRelease(Mark2);
+    
+    uint8_t *B = CCScratchAllocate(10);
+    XCTAssertEqual(B, A + (sizeof(void*) * 2), @"Should reuse the released memory");
+    
+    CCScratchRelease(Mark);
+    
+    uint8_t *C = CCScratchAllocate(10);
+    XCTAssertTrue(C, @"Should allocate scratch memory");
+    
+    CCScratchRelease(Mark);
+    
+    XCTAssertEqual(CCScratchAllocate(10), C, @"Should reuse the released memory");
+    
+    CCScratchRelease(Mark);
+    CCScratchPurge();
+}
+
+-(void) testReleaseAcrossBlocks
+{
+    const CCScratchMark Mark = CCScratchGetMark();
+    
+    uint8_t *A = CCScratchAllocate(60000);
+    XCTAssertTrue(A, @"Should allocate scratch memory");
+    
+    const CCScratchMark Mark2 = CCScratchGetMark();
+    
+    uint8_t *B = CCScratchAllocate(10000);
+    XCTAssertTrue(B, @"Should allocate scratch memory");
+    XCTAssertTrue((B < A) || (B >= (A + 60000)), @"Should spill into a new block");
+    XCTAssertEqual((uintptr_t)B % (sizeof(void*) * 2), 0, @"Should be aligned");
+    
+    CCScratchRelease(Mark2);
+    
+    XCTAssertEqual(CCScratchAllocate(16), A + 60000, @"Should resume from the mark in the earlier block");
+    
+    CCScratchRelease(Mark);
+    CCScratchPurge();
+}
+
+static void *ThreadAllocate(void *Arg)
+{
+    const CCScratchMark Mark = CCScratchGetMark();
+    
+    *(void**)Arg = CCScratchAllocate(16);
+    memset(*(void**)Arg, 0, 16);
+    
+    CCScratchRelease(Mark);
+    
+    return NULL;
+}
+
+-(void) testThreadLocal
+{
+    const CCScratchMark Mark = CCScratchGetMark();
+    
+    void *Ptr = CCScratchAllocate(16), *ThreadPtr = NULL;
+    
+    pthread_t Thread;
+    pthread_create(&Thread, NULL, ThreadAllocate, &ThreadPtr);
+    pthread_join(Thread, NULL);
+    
+    XCTAssertNotEqual(Ptr, ThreadPtr, @"Should use separate scratch memory per thread");
+    
+    CCScratchRelease(Mark);
+}
+
+@end
@@ -0,0 +1,183 @@
+/*
+ *  Copyright (c) 2021, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Cocoa/Cocoa.h>
+#import <XCTest/XCTest.h>
+#import "SoAArray.h"
+#import "Types.h"
+
+@interface SoAArrayTests : XCTestCase
+
+@end
+
+@implementation SoAArrayTests
+
+-(void) setUp
+{
+    [super setUp];
+}
+
+-(void) tearDown
+{
+    [super tearDown];
+}
+
+-(void) testCreation
+{
+    CCSoAArray Array = CCSoAArrayCreate(CC_STD_ALLOCATOR, (CCSoAArrayField[]){ CC_SOA_ARRAY_FIELD(int), CC_SOA_ARRAY_FIELD(CCVector4D), CC_SOA_ARRAY_FIELD(char) }, 3, 4);
+    
+    XCTAssertEqual(CCSoAArrayGetCount(Array), 0, @"Should be empty");
+    XCTAssertEqual(CCSoAArrayGetCapacity(Array), 4, @"Should have the capacity of the chunk size");
+    XCTAssertEqual(CCSoAArrayGetFieldCount(Array), 3, @"Should have the fields specified on creation");
+    XCTAssertEqual(CCSoAArrayGetFieldSize(Array, 0), sizeof(int), @"Should be the size specified on creation");
+    XCTAssertEqual(CCSoAArrayGetFieldSize(Array, 1), sizeof(CCVector4D), @"Should be the size specified on creation");
+    XCTAssertEqual(CCSoAArrayGetFieldSize(Array, 2), sizeof(char), @"Should be the size specified on creation");
+    
+    for (size_t Loop = 0; Loop < 3; Loop++)
+    {
+        XCTAssertEqual((uintptr_t)CCSoAArrayGetColumn(Array, Loop) % CC_SOA_ARRAY_ALIGNMENT, 0, @"Should be aligned");
+    }
+    
+    CCSoAArrayDestroy(Array);
+    
+    
+    Array = CCSoAArrayCreate(CC_STD_ALLOCATOR, (CCSoAArrayField[]){ CC_SOA_ARRAY_FIELD(char), { .size = CC_SOA_ARRAY_ALIGNMENT * 4, .alignment = CC_SOA_ARRAY_ALIGNMENT * 4 } }, 2, 1);
+    
+    XCTAssertEqual((uintptr_t)CCSoAArrayGetColumn(Array, 0) % CC_SOA_ARRAY_ALIGNMENT, 0, @"Should be aligned");
+    XCTAssertEqual((uintptr_t)CCSoAArrayGetColumn(Array, 1) % (CC_SOA_ARRAY_ALIGNMENT * 4), 0, @"Should be aligned to the field's alignment");
+    
+    CCSoAArrayDestroy(Array);
+}
+
+-(void) testInsertion
+{
+    CCSoAArray Array = CCSoAArrayCreate(CC_STD_ALLOCATOR, (CCSoAArrayField[]){ CC_SOA_ARRAY_FIELD(int), CC_SOA_ARRAY_FIELD(CCVector4D), CC_SOA_ARRAY_FIELD(char) }, 3, 4);
+    
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        const CCVector4D Vector = { Loop, Loop * 2, Loop * 3, Loop * 4 };
+        const char Char = Loop;
+        
+        XCTAssertEqual(CCSoAArrayAppendElement(Array, (const void*[]){ &Loop, &Vector, &Char }), Loop, @"Should append to the end");
+    }
+    
+    XCTAssertEqual(CCSoAArrayGetCount(Array), 100, @"Should contain all the appended records");
+    XCTAssertEqual(CCSoAArrayGetCapacity(Array) % 4, 0, @"Should be a multiple of the chunk size");
+    
+    for (size_t Loop = 0; Loop < 3; Loop++)
+    {
+        XCTAssertEqual((uintptr_t)CCSoAArrayGetColumn(Array, Loop) % CC_SOA_ARRAY_ALIGNMENT, 0, @"Should remain aligned after growing");
+    }
+    
+    const int *Ints = CCSoAArrayGetColumn(Array, 0);
+    const CCVector4D *Vectors = CCSoAArrayGetColumn(Array, 1);
+    const char *Chars = CCSoAArrayGetColumn(Array, 2);
+    for (int Loop = 0; Loop < 100; Loop++)
+    {
+        XCTAssertEqual(Ints[Loop], Loop, @"Should contain the appended field");
+        XCTAssertEqual(Vectors[Loop].y, Loop * 2, @"Should contain the appended field");
+        XCTAssertEqual(Vectors[Loop].w, Loop * 4, @"Should contain the appended field");
+        XCTAssertEqual(Chars[Loop], (char)Loop, @"Should contain the appended field");
+        XCTAssertEqual(*(int*)CCSoAArrayGetFieldAtIndex(Array, 0, Loop), Loop, @"Should contain the appended field");
+    }
+    
+    CCSoAArrayReplaceElementAtIndex(Array, 5, (const void*[]){ &(int){ -1 }, NULL, &(char){ 'x' } });
+    
+    XCTAssertEqual(*(int*)CCSoAArrayGetFieldAtIndex(Array, 0, 5), -1, @"Should replace the field");
+    XCTAssertEqual(((CCVector4D*)CCSoAArrayGetFieldAtIndex(Array, 1, 5))->x, 5, @"Should leave the field unchanged");
+    XCTAssertEqual(*(char*)CCSoAArrayGetFieldAtIndex(Array, 2, 5), 'x', @"Should replace the field");
+    
+    CCSoAArrayRemoveAllElements(Array);
+    
+    XCTAssertEqual(CCSoAArrayGetCount(Array), 0, @"Should be empty");
+    
+    int Values[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    char Letters[10] = "abcdefghij";
+    XCTAssertEqual(CCSoAArrayAppendElements(Array, (const void*[]){ Values, NULL, Letters }, 10), 0, @"Should append to the end");
+    XCTAssertEqual(CCSoAArrayAppendElements(Array, (const void*[]){ Values, NULL, Letters }, 10), 10, @"Should append to the end");
+    XCTAssertEqual(CCSoAArrayGetCount(Array), 20, @"Should contain all the appended records");
+    
+    for (int Loop = 0; Loop < 20; Loop++)
+    {
+        XCTAssertEqual(*(int*)CCSoAArrayGetFieldAtIndex(Array, 0, Loop), Values[Loop % 10], @"Should contain the appended field");
+        XCTAssertEqual(*(char*)CCSoAArrayGetFieldAtIndex(Array, 2, Loop), Letters[Loop % 10], @"Should contain the appended field");
+    }
+    
+    CCSoAArrayDestroy(Array);
+}
+
+-(void) testRemoval
+{
+    CCSoAArray Array = CCSoAArrayCreate(CC_STD_ALLOCATOR, (CCSoAArrayField[]){ CC_SOA_ARRAY_FIELD(int), CC_SOA_ARRAY_FIELD(double) }, 2, 8);
+    
+    for (int Loop = 0; Loop < 10; Loop++) CCSoAArrayAppendElement(Array, (const void*[]){ &Loop, &(double){ Loop * 0.5 } });
+    
+    CCSoAArrayRemoveElementAtIndex(Array, 2);
+    CCSoAArrayRemoveElementAtIndex(Array, 8);
+    
+    XCTAssertEqual(CCSoAArrayGetCount(Array), 8, @"Should remove the records");
+    
+    const int Ordered[] = { 0, 1, 3, 4, 5, 6, 7, 8 };
+    for (size_t Loop = 0; Loop < 8; Loop++)
+    {
+        XCTAssertEqual(*(int*)CCSoAArrayGetFieldAtIndex(Array, 0, Loop), Ordered[Loop], @"Should preserve the order");
+        XCTAssertEqual(*(double*)CCSoAArrayGetFieldAtIndex(Array, 1, Loop), Ordered[Loop] * 0.5, @"Should keep the fields of a record together");
+    }
+    
+    CCSoAArraySwapRemoveElementAtIndex(Array, 1);
+    
+    const int Swapped[] = { 0, 8, 3, 4, 5, 6, 7 };
+    XCTAssertEqual(CCSoAArrayGetCount(Array), 7, @"Should remove the record");
+    for (size_t Loop = 0; Loop < 7; Loop++)
+    {
+        XCTAssertEqual(*(int*)CCSoAArrayGetFieldAtIndex(Array, 0, Loop), Swapped[Loop], @"Should move the last record into the removed record's place");
+        XCTAssertEqual(*(double*)CCSoAArrayGetFieldAtIndex(Array, 1, Loop), Swapped[Loop] * 0.5, @"Should keep the fields of a record together");
+    }
+    
+    CCSoAArraySwapRemoveElementAtIndex(Array, 6);
+    
+    XCTAssertEqual(CCSoAArrayGetCount(Array), 6, @"Should remove the last record");
+    XCTAssertEqual(*(int*)CCSoAArrayGetFieldAtIndex(Array, 0, 5), 6, @"Should not change the other records");
+    
+    CCSoAArrayDestroy(Array);
+}
+
+-(void) testCapacity
+{
+    CCSoAArray Array = CCSoAArrayCreate(CC_STD_ALLOCATOR, (CCSoAArrayField[]){ CC_SOA_ARRAY_FIELD(float), CC_SOA_ARRAY_FIELD(uint8_t) }, 2, 16);
+    
+    XCTAssertTrue(CCSoAArrayReserve(Array, 20), @"Should reserve the capacity");
+    XCTAssertEqual(CCSoAArrayGetCapacity(Array), 32, @"Should round the capacity to the chunk size");
+    
+    float *Column = CCSoAArrayGetColumn(Array, 0);
+    for (int Loop = 0; Loop < 32; Loop++) CCSoAArrayAppendElement(Array, (const void*[]){ &(float){ Loop }, &(uint8_t){ Loop } });
+    
+    XCTAssertEqual(CCSoAArrayGetCapacity(Array), 32, @"Should not need to grow");
+    XCTAssertEqual(CCSoAArrayGetColumn(Array, 0), Column, @"Should not need to reallocate");
+    
+    CCSoAArrayDestroy(Array);
+}
+
+@end